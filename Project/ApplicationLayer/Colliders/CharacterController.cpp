@@ -0,0 +1,475 @@
+#define NOMINMAX
+#include "CharacterController.h"
+#include "CollisionUtility.h"
+#include "StaticMeshBVH.h"
+#include "JobSystem.h"
+#include <LogString.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// サブステップを数えるときの誤差の許容（1/60 秒を 1/120 秒2回に確実に分けるため）
+	constexpr float kTimeEpsilon = 1.0e-6f;
+
+	// 押し出しを打ち切るめり込み量
+	constexpr float kDepthEpsilon = 1.0e-5f;
+}
+
+
+/// -------------------------------------------------------------
+///				　			初期化処理
+/// -------------------------------------------------------------
+void CharacterController::Initialize(const Vector3& position, const Settings& settings)
+{
+	settings_ = settings;
+	position_ = position;
+	velocity_ = {};
+	accumulator_ = 0.0f;
+	isGrounded_ = false;
+	groundNormal_ = { 0.0f, 1.0f, 0.0f };
+	contactCount_ = 0;
+}
+
+
+/// -------------------------------------------------------------
+///				　			更新処理
+/// -------------------------------------------------------------
+void CharacterController::Update(const StaticCollisionWorld& world, float deltaTime)
+{
+	// フレームの長さによらず同じ刻みで進める（刻みが揃うので接触の揺れ方も毎フレーム同じ）
+	accumulator_ += deltaTime;
+
+	uint32_t stepCount = 0;
+	while (accumulator_ + kTimeEpsilon >= settings_.fixedStep && stepCount < settings_.maxSubsteps)
+	{
+		Step(world, settings_.fixedStep);
+		accumulator_ = std::max(accumulator_ - settings_.fixedStep, 0.0f);
+		++stepCount;
+	}
+
+	// 追いつけなかった分は捨てる（重いフレームの後にまとめて進めない）
+	if (accumulator_ + kTimeEpsilon >= settings_.fixedStep) accumulator_ = 0.0f;
+}
+
+
+/// -------------------------------------------------------------
+///				　		1サブステップ
+/// -------------------------------------------------------------
+void CharacterController::Step(const StaticCollisionWorld& world, float step)
+{
+	const bool wasGrounded = isGrounded_;
+
+	velocity_.y -= settings_.gravity * step;
+	Move(world, velocity_ * step);
+
+	// 接地していたのに離れた（下り坂・段差）ときは下へ吸い付ける（ジャンプで上向きのときは除く）
+	if (wasGrounded && !isGrounded_ && velocity_.y <= 0.0f && settings_.groundSnap > 0.0f)
+	{
+		const Vector3 previous = position_;
+		position_.y -= settings_.groundSnap;
+		Depenetrate(world);
+
+		if (isGrounded_)
+		{
+			velocity_ = ClipByContacts(velocity_);
+		}
+		else
+		{
+			// 下に地面がなければ元の位置で接触を集め直す
+			position_ = previous;
+			Depenetrate(world);
+		}
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　	動かして滑らせる
+/// -------------------------------------------------------------
+void CharacterController::Move(const StaticCollisionWorld& world, const Vector3& displacement)
+{
+	// 1回に動かす距離を半径の半分までにして、薄い箱をすり抜けないようにする
+	const float maxMove = settings_.radius * kMaxMoveRatio;
+	const float length = Vector3::Length(displacement);
+	const uint32_t pieceCount = std::max(1u, static_cast<uint32_t>(std::ceil(length / maxMove)));
+
+	Vector3 piece = displacement * (1.0f / static_cast<float>(pieceCount));
+	for (uint32_t i = 0; i < pieceCount; ++i)
+	{
+		position_ += piece;
+		Depenetrate(world);
+
+		// 残りの移動も当たった面に沿わせる
+		piece = ClipByContacts(piece);
+	}
+
+	velocity_ = ClipByContacts(velocity_);
+}
+
+
+/// -------------------------------------------------------------
+///				　		接触を列挙
+/// -------------------------------------------------------------
+template<typename Callback>
+void CharacterController::ForEachContact(const StaticCollisionWorld& world, const uint32_t* boxes, uint32_t boxCount, float margin, Callback&& callback) const
+{
+	// depth = (半径 + skinWidth) - 距離。callback の中で位置が動くので形状ごとに読み直す
+	const float offset = settings_.radius + settings_.skinWidth;
+
+	// 床
+	if (world.HasGround())
+	{
+		const float depth = offset - (GetBottom().y - world.GetGroundHeight());
+		if (depth > -margin) callback(Vector3{ 0.0f, 1.0f, 0.0f }, depth);
+	}
+
+	// 箱
+	for (uint32_t i = 0; i < boxCount; ++i)
+	{
+		Vector3 normal{};
+		float distance = 0.0f;
+		if (!ComputeBoxContact(world.GetBox(boxes[i]), GetBottom(), GetTop(), offset + margin, normal, distance)) continue;
+		callback(normal, offset - distance);
+	}
+
+	// 静的メッシュ（最も深い接触だけ。反復の中で次に深いものが出てくる）
+	if (const StaticMeshBVH* mesh = world.GetStaticMesh())
+	{
+		const Capsule capsule{ { GetBottom(), GetTop() }, offset + margin }; // diff は終点
+		StaticMeshBVH::Contact contact;
+		if (mesh->OverlapCapsule(capsule, contact)) callback(contact.normal, contact.depth - margin);
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　	めり込みを解消する
+/// -------------------------------------------------------------
+void CharacterController::Depenetrate(const StaticCollisionWorld& world)
+{
+	// 押し出しで動く分も含めて近くの箱を一度だけ集める
+	const float margin = settings_.skinWidth + settings_.radius * kMaxMoveRatio;
+	GatherBoxes(world, margin);
+	const uint32_t* boxes = candidateBoxes_.data();
+	const uint32_t boxCount = static_cast<uint32_t>(candidateBoxes_.size());
+
+	// 1つずつ押し出して、押し出すものがなくなるまで繰り返す
+	for (uint32_t iteration = 0; iteration < settings_.maxIterations; ++iteration)
+	{
+		bool isPushed = false;
+		ForEachContact(world, boxes, boxCount, 0.0f, [&](const Vector3& normal, float depth) {
+			if (depth <= kDepthEpsilon) return;
+
+			// 歩ける面は真上に押し上げる（重力で坂を滑り落ちないように）
+			if (IsWalkable(normal)) position_.y += depth / normal.y;
+			else position_ += normal * depth;
+			isPushed = true;
+			});
+
+		if (!isPushed) break;
+	}
+
+	// 押し出した後の位置で、skinWidth の範囲で触れている面を集め直す
+	contactCount_ = 0;
+	isGrounded_ = false;
+	groundNormal_ = { 0.0f, 1.0f, 0.0f };
+
+	float bestGroundY = -1.0f;
+	ForEachContact(world, boxes, boxCount, settings_.skinWidth, [&](const Vector3& normal, float depth) {
+		AddContact(normal, depth);
+
+		// 最も平らな歩ける面を地面にする
+		if (IsWalkable(normal) && normal.y > bestGroundY)
+		{
+			bestGroundY = normal.y;
+			groundNormal_ = normal;
+			isGrounded_ = true;
+		}
+		});
+}
+
+
+/// -------------------------------------------------------------
+///				　			箱との接触
+/// -------------------------------------------------------------
+bool CharacterController::ComputeBoxContact(const StaticCollisionWorld::Box& box, const Vector3& bottom, const Vector3& top, float contactRadius, Vector3& outNormal, float& outDistance)
+{
+	// 箱のローカル空間へ（AABB は平行移動だけ）
+	auto toLocal = [&](const Vector3& v) {
+		const Vector3 r = { v.x - box.center.x, v.y - box.center.y, v.z - box.center.z };
+		if (box.isAxisAligned) return r;
+		return Vector3{
+			r.x * box.axes[0].x + r.y * box.axes[0].y + r.z * box.axes[0].z,
+			r.x * box.axes[1].x + r.y * box.axes[1].y + r.z * box.axes[1].z,
+			r.x * box.axes[2].x + r.y * box.axes[2].y + r.z * box.axes[2].z };
+		};
+	const Vector3 p = toLocal(bottom);
+	const Vector3 q = toLocal(top);
+	const Vector3 d = { q.x - p.x, q.y - p.y, q.z - p.z };
+	const Vector3& h = box.halfSize;
+
+	float s = 0.0f;
+	Vector3 boxPoint{};
+	const float dist2 = CollisionUtility::ClosestPointSegmentBox(p, d, h, s, boxPoint);
+	if (dist2 > contactRadius * contactRadius) return false;
+
+	Vector3 localNormal{};
+	if (dist2 > 1.0e-10f)
+	{
+		// 軸が箱の外にあるときは最近接点どうしの向きと距離
+		const float dist = std::sqrt(dist2);
+		const float invDist = 1.0f / dist;
+		localNormal = { (p.x + d.x * s - boxPoint.x) * invDist, (p.y + d.y * s - boxPoint.y) * invDist, (p.z + d.z * s - boxPoint.z) * invDist };
+		outDistance = dist;
+	}
+	else
+	{
+		// 軸が箱に入っているときは、軸全体を外に出すのに必要な量が最小の面から出す（距離は負）
+		float best = FLT_MAX;
+		for (int i = 0; i < 3; ++i)
+		{
+			const float lo = std::min(p[i], p[i] + d[i]);
+			const float hi = std::max(p[i], p[i] + d[i]);
+
+			const float toPlus = h[i] - lo;
+			const float toMinus = hi + h[i];
+			if (toPlus < best) { best = toPlus; localNormal = {}; localNormal[i] = 1.0f; }
+			if (toMinus < best) { best = toMinus; localNormal = {}; localNormal[i] = -1.0f; }
+		}
+		outDistance = -best;
+	}
+
+	// ワールドへ戻す
+	if (box.isAxisAligned)
+	{
+		outNormal = localNormal;
+	}
+	else
+	{
+		outNormal = {
+			box.axes[0].x * localNormal.x + box.axes[1].x * localNormal.y + box.axes[2].x * localNormal.z,
+			box.axes[0].y * localNormal.x + box.axes[1].y * localNormal.y + box.axes[2].y * localNormal.z,
+			box.axes[0].z * localNormal.x + box.axes[1].z * localNormal.y + box.axes[2].z * localNormal.z };
+	}
+	return true;
+}
+
+
+/// -------------------------------------------------------------
+///				　		近くの箱を集める
+/// -------------------------------------------------------------
+void CharacterController::GatherBoxes(const StaticCollisionWorld& world, float margin)
+{
+	const float reach = settings_.radius + settings_.skinWidth + margin;
+	const Vector3 bottom = GetBottom();
+	const Vector3 top = GetTop();
+	const AABB bounds{
+		{ bottom.x - reach, bottom.y - reach, bottom.z - reach },
+		{ top.x + reach, top.y + reach, top.z + reach } };
+
+	// 細かい箱が密集していても打ち切らない（取りこぼした箱にはめり込んだままになる）
+	candidateBoxes_.clear();
+	world.QueryBoxes(bounds, [&](uint32_t index) {
+		candidateBoxes_.push_back(index);
+		return true;
+		});
+}
+
+
+/// -------------------------------------------------------------
+///				　	接触面で速度・移動量を削る
+/// -------------------------------------------------------------
+Vector3 CharacterController::ClipByContacts(const Vector3& vector) const
+{
+	constexpr float kEpsilon = 1.0e-6f;
+	auto dot = [](const Vector3& a, const Vector3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; };
+
+	// 歩ける面は下向きだけを止める（坂で横の速度を落とさない）
+	bool isOnWalkable = false;
+	for (uint32_t i = 0; i < contactCount_; ++i) isOnWalkable |= IsWalkable(contacts_[i].normal);
+
+	Vector3 result = vector;
+	if (isOnWalkable && result.y < 0.0f) result.y = 0.0f;
+
+	// それ以外の面には沿わせる（2枚の間では折れ目の向き、3枚目にもぶつかれば止める）
+	for (uint32_t i = 0; i < contactCount_; ++i)
+	{
+		const Vector3& ni = contacts_[i].normal;
+		if (IsWalkable(ni) || dot(result, ni) >= 0.0f) continue;
+
+		const float intoI = dot(result, ni);
+		result = { result.x - ni.x * intoI, result.y - ni.y * intoI, result.z - ni.z * intoI };
+
+		for (uint32_t j = 0; j < contactCount_; ++j)
+		{
+			const Vector3& nj = contacts_[j].normal;
+			if (j == i || IsWalkable(nj) || dot(result, nj) >= -kEpsilon) continue;
+
+			Vector3 crease = Vector3::Cross(ni, nj);
+			const float creaseLength = Vector3::Length(crease);
+			if (creaseLength < kEpsilon) return {};
+
+			crease = crease * (1.0f / creaseLength);
+			result = crease * dot(result, crease);
+
+			for (uint32_t k = 0; k < contactCount_; ++k)
+			{
+				if (k == i || k == j || IsWalkable(contacts_[k].normal)) continue;
+				if (dot(result, contacts_[k].normal) < -kEpsilon) return {};
+			}
+		}
+
+		if (isOnWalkable && result.y < 0.0f) result.y = 0.0f;
+	}
+
+	// 面に沿わせて上向きの成分が増えた分は捨てる（急な坂を歩いて登れないように）
+	result.y = std::min(result.y, std::max(vector.y, 0.0f));
+	return result;
+}
+
+
+/// -------------------------------------------------------------
+///				　		接触面を覚える
+/// -------------------------------------------------------------
+void CharacterController::AddContact(const Vector3& normal, float depth)
+{
+	constexpr float kSameNormalCos = 0.999f;
+
+	for (uint32_t i = 0; i < contactCount_; ++i)
+	{
+		ContactPlane& contact = contacts_[i];
+		if (contact.normal.x * normal.x + contact.normal.y * normal.y + contact.normal.z * normal.z > kSameNormalCos)
+		{
+			contact.depth = std::max(contact.depth, depth);
+			return;
+		}
+	}
+
+	if (contactCount_ < kMaxContacts) contacts_[contactCount_++] = { normal, depth };
+}
+
+
+/// -------------------------------------------------------------
+///				　			ベンチマーク
+/// -------------------------------------------------------------
+CharacterController::BenchmarkResult CharacterController::RunBenchmark(uint32_t controllerCount, uint32_t boxCount)
+{
+	using Clock = std::chrono::steady_clock;
+	constexpr uint32_t kFrameCount = 60;
+	constexpr float kDeltaTime = 1.0f / 60.0f;
+	constexpr float kWalkSpeed = 4.0f;
+	constexpr float kJumpSpeed = 6.0f;
+	constexpr size_t kGrain = 64;
+
+	std::mt19937 random(2024);
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+	// 箱の間隔がおよそ4mになる広さに、床に置いた箱・回した箱・傾けた坂を並べる
+	const float halfSide = std::sqrt(static_cast<float>(std::max(boxCount, controllerCount))) * 2.0f;
+	auto coordinate = [&]() { return (unit(random) * 2.0f - 1.0f) * halfSide; };
+
+	StaticCollisionWorld world;
+	world.SetGroundHeight(0.0f);
+	for (uint32_t i = 0; i < boxCount; ++i)
+	{
+		const Vector3 halfSize = { 0.5f + unit(random) * 2.0f, 0.25f + unit(random) * 1.25f, 0.5f + unit(random) * 2.0f };
+		const Vector3 center = { coordinate(), halfSize.y, coordinate() };
+
+		if (i % 2 == 0)
+		{
+			world.AddBox(AABB{ center - halfSize, center + halfSize });
+			continue;
+		}
+
+		// 奇数番はY軸まわりに回し、4つに1つは坂になるように傾ける
+		const float yaw = unit(random) * 6.2831853f;
+		const float pitch = (i % 4 == 1) ? 0.35f : 0.0f;
+		const Vector3 up = { 0.0f, 1.0f, 0.0f };
+		const Vector3 axisX = { std::cos(yaw), 0.0f, -std::sin(yaw) };
+		const Vector3 flatZ = { std::sin(yaw), 0.0f, std::cos(yaw) };
+
+		OBB obb{};
+		obb.center = center;
+		obb.orientations[0] = axisX;
+		obb.orientations[1] = up * std::cos(pitch) + flatZ * std::sin(pitch);
+		obb.orientations[2] = flatZ * std::cos(pitch) - up * std::sin(pitch);
+		obb.size = halfSize;
+		world.AddBox(obb);
+	}
+	world.Build();
+
+	// 空中から落として、決まった向きに歩かせ続ける
+	Settings settings{};
+	std::vector<CharacterController> initial(controllerCount);
+	std::vector<Vector3> walkVelocities(controllerCount);
+	for (uint32_t i = 0; i < controllerCount; ++i)
+	{
+		initial[i].Initialize({ coordinate(), 1.0f + unit(random) * 3.0f, coordinate() }, settings);
+		const float angle = unit(random) * 6.2831853f;
+		walkVelocities[i] = { std::cos(angle) * kWalkSpeed, 0.0f, std::sin(angle) * kWalkSpeed };
+	}
+
+	auto updateRange = [&](std::vector<CharacterController>& controllers, uint32_t frame, size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i)
+		{
+			CharacterController& controller = controllers[i];
+			Vector3 velocity = { walkVelocities[i].x, controller.GetVelocity().y, walkVelocities[i].z };
+			if (controller.IsGrounded() && (i + frame) % 90 == 0) velocity.y = kJumpSpeed;
+			controller.SetVelocity(velocity);
+			controller.Update(world, kDeltaTime);
+		}
+		};
+
+	BenchmarkResult result;
+	result.controllerCount = controllerCount;
+	result.boxCount = boxCount;
+	result.frameCount = kFrameCount;
+
+	// 直列
+	std::vector<CharacterController> serial = initial;
+	auto startTime = Clock::now();
+	for (uint32_t frame = 0; frame < kFrameCount; ++frame) updateRange(serial, frame, 0, serial.size());
+	result.serialMilliseconds = std::chrono::duration<float, std::milli>(Clock::now() - startTime).count() / kFrameCount;
+
+	// 並列（1体ずつ独立なので直列と同じ結果になる）
+	std::vector<CharacterController> parallel = initial;
+	startTime = Clock::now();
+	for (uint32_t frame = 0; frame < kFrameCount; ++frame)
+	{
+		JobSystem::GetInstance()->ParallelFor(parallel.size(), kGrain, [&](size_t begin, size_t end) { updateRange(parallel, frame, begin, end); });
+	}
+	result.parallelMilliseconds = std::chrono::duration<float, std::milli>(Clock::now() - startTime).count() / kFrameCount;
+
+	// 全箱と総当たりで残っためり込みを調べる（グリッドの取りこぼしもここで分かる）
+	uint32_t groundedCount = 0;
+	for (uint32_t i = 0; i < controllerCount; ++i)
+	{
+		const CharacterController& controller = serial[i];
+		const Vector3 diff = controller.GetPosition() - parallel[i].GetPosition();
+		result.maxParallelError = std::max({ result.maxParallelError, std::abs(diff.x), std::abs(diff.y), std::abs(diff.z) });
+		if (controller.IsGrounded()) ++groundedCount;
+
+		const float radius = controller.GetSettings().radius;
+		result.maxPenetration = std::max(result.maxPenetration, radius - (controller.GetBottom().y - world.GetGroundHeight()));
+		for (uint32_t b = 0; b < world.GetBoxCount(); ++b)
+		{
+			Vector3 normal{};
+			float distance = 0.0f;
+			if (ComputeBoxContact(world.GetBox(b), controller.GetBottom(), controller.GetTop(), radius, normal, distance))
+			{
+				result.maxPenetration = std::max(result.maxPenetration, radius - distance);
+			}
+		}
+	}
+	result.groundedRatio = static_cast<float>(groundedCount) / static_cast<float>(std::max(controllerCount, 1u));
+
+	Log(std::format("[CharacterController] {} controllers / {} boxes : serial {:.3f} ms parallel {:.3f} ms per frame (grounded {:.0f}%, max penetration {:.2e}, parallel error {:.1e})\n",
+		controllerCount, boxCount, result.serialMilliseconds, result.parallelMilliseconds, result.groundedRatio * 100.0f, result.maxPenetration, result.maxParallelError));
+	return result;
+}
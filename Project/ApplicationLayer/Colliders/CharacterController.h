@@ -0,0 +1,143 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "Vector3.h"
+#include "AABB.h"
+#include "Capsule.h"
+#include "StaticCollisionWorld.h"
+
+
+/// -------------------------------------------------------------
+///		キャラクター移動（立ったカプセルを静的な形状に沿って動かす）
+/// -------------------------------------------------------------
+class CharacterController
+{
+public: /// ---------- 構造体 ---------- ///
+
+	// 設定
+	struct Settings
+	{
+		float radius = 0.3f;              // カプセルの半径
+		float height = 1.0f;              // 下の球の中心から上の球の中心までの長さ
+		float skinWidth = 0.01f;          // 面から浮かせておく距離（接触し続けても揺れないように）
+		float maxSlopeCos = 0.64f;        // 歩ける面の法線Yの下限（約50度）
+		float groundSnap = 0.05f;         // 接地中に下へ吸い付ける距離（下り坂で浮かないように）
+		float gravity = 18.0f;            // 重力加速度（単位/秒²）
+		float fixedStep = 1.0f / 120.0f;  // サブステップの長さ（秒）
+		uint32_t maxSubsteps = 8;         // 1回の Update で進める最大数（超えた分は捨てる）
+		uint32_t maxIterations = 4;       // 押し出しの反復回数
+	};
+
+	// 接触面
+	struct ContactPlane
+	{
+		Vector3 normal; // 形状からキャラクターへ
+		float depth;    // skinWidth まで離すのに必要な量（負なら離れている）
+	};
+
+	// ベンチマークの結果
+	struct BenchmarkResult
+	{
+		uint32_t controllerCount = 0;
+		uint32_t boxCount = 0;
+		uint32_t frameCount = 0;
+		float serialMilliseconds = 0.0f;   // 1フレームあたり（直列）
+		float parallelMilliseconds = 0.0f; // 1フレームあたり（並列）
+		float groundedRatio = 0.0f;        // 最後のフレームで接地していた割合
+		float maxPenetration = 0.0f;       // 最後のフレームで残っためり込みの最大（全箱と総当たりで確認）
+		float maxParallelError = 0.0f;     // 直列と並列の位置の差の最大
+	};
+
+public: /// ---------- メンバ関数 ---------- ///
+
+	// 初期化処理（position は足元＝カプセルの一番下）
+	void Initialize(const Vector3& position, const Settings& settings);
+
+	// 速度で deltaTime 秒進める（固定サブステップ。余りは次の呼び出しに持ち越す）
+	void Update(const StaticCollisionWorld& world, float deltaTime);
+
+	// 1サブステップ：重力 → 移動と滑り → 接地判定
+	void Step(const StaticCollisionWorld& world, float step);
+
+	// displacement だけ動かしてめり込みを解消し、接触面に沿うように速度を削る
+	void Move(const StaticCollisionWorld& world, const Vector3& displacement);
+
+	// めり込みを解消して接触面を集め直す
+	void Depenetrate(const StaticCollisionWorld& world);
+
+	// controllerCount 体を boxCount 個の箱の間で動かして計測（結果はログにも出る）
+	static BenchmarkResult RunBenchmark(uint32_t controllerCount, uint32_t boxCount);
+
+public: /// ---------- 設定 ---------- ///
+
+	// 位置を直接変える（ワープ。接地は次のステップで判定し直す）
+	void SetPosition(const Vector3& position) { position_ = position; }
+
+	void SetVelocity(const Vector3& velocity) { velocity_ = velocity; }
+	void SetSettings(const Settings& settings) { settings_ = settings; }
+
+public: /// ---------- ゲッター ---------- ///
+
+	const Vector3& GetPosition() const { return position_; }
+	const Vector3& GetVelocity() const { return velocity_; }
+	const Settings& GetSettings() const { return settings_; }
+
+	bool IsGrounded() const { return isGrounded_; }
+	const Vector3& GetGroundNormal() const { return groundNormal_; }
+
+	// 直前のステップの接触面
+	uint32_t GetContactCount() const { return contactCount_; }
+	const ContactPlane& GetContact(uint32_t index) const { return contacts_[index]; }
+
+	// 下の球と上の球の中心
+	Vector3 GetBottom() const { return { position_.x, position_.y + settings_.radius, position_.z }; }
+	Vector3 GetTop() const { return { position_.x, position_.y + settings_.radius + settings_.height, position_.z }; }
+
+	// 描画用のカプセル（segment.diff は始点からの差分。Wireframe::DrawCapsule と同じ）
+	Capsule GetCapsule() const { return { { GetBottom(), { 0.0f, settings_.height, 0.0f } }, settings_.radius }; }
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	// 箱との接触（contactRadius より離れていれば false）
+	static bool ComputeBoxContact(const StaticCollisionWorld::Box& box, const Vector3& bottom, const Vector3& top, float contactRadius, Vector3& outNormal, float& outDistance);
+
+	// 現在の位置で、半径 + skinWidth + margin の範囲にある接触を列挙（callback(normal, depth)）
+	template <typename Callback>
+	void ForEachContact(const StaticCollisionWorld& world, const uint32_t* boxes, uint32_t boxCount, float margin, Callback&& callback) const;
+
+	// 近くの箱を candidateBoxes_ に集める（押し出しの反復中は同じ候補を使い回す）
+	void GatherBoxes(const StaticCollisionWorld& world, float margin);
+
+	// 集めた接触面で速度・移動量を削る（歩ける面は下向きだけ、それ以外は面に沿わせる。上向きには増やさない）
+	Vector3 ClipByContacts(const Vector3& vector) const;
+
+	// 接触面を覚える（ほぼ同じ向きの面はまとめる）
+	void AddContact(const Vector3& normal, float depth);
+
+	// 歩ける面か
+	bool IsWalkable(const Vector3& normal) const { return normal.y >= settings_.maxSlopeCos; }
+
+private: /// ---------- 定数 ---------- ///
+
+	static constexpr uint32_t kMaxContacts = 8;        // 覚えておく接触面の上限
+	static constexpr float kMaxMoveRatio = 0.5f;       // 1回に動かす距離の上限（半径に対する割合。すり抜け防止）
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	Settings settings_{};
+
+	Vector3 position_{};
+	Vector3 velocity_{};
+	float accumulator_ = 0.0f;
+
+	bool isGrounded_ = false;
+	Vector3 groundNormal_{ 0.0f, 1.0f, 0.0f };
+
+	std::array<ContactPlane, kMaxContacts> contacts_{};
+	uint32_t contactCount_ = 0;
+
+	// 近くの箱（数に上限を設けず、1体ごとに持って使い回すので確保は最初の数回だけ）
+	std::vector<uint32_t> candidateBoxes_;
+};
@@ -1,9 +1,40 @@
 #define NOMINMAX
 #include "Collider.h"
+#include "CollisionManager.h"
 #include <Wireframe.h>
 
 #include <imgui.h>
 
+/// -------------------------------------------------------------
+///						　	デストラクタ
+/// -------------------------------------------------------------
+Collider::~Collider()
+{
+	// 破棄されたコライダーを判定に残さない
+	Unregister();
+}
+
+
+/// -------------------------------------------------------------
+///						　	登録先から外す
+/// -------------------------------------------------------------
+void Collider::Unregister()
+{
+	if (collisionManager_) collisionManager_->RemoveCollider(this);
+}
+
+
+/// -------------------------------------------------------------
+///						　形状の更新を知らせる
+/// -------------------------------------------------------------
+void Collider::MarkShapeDirty()
+{
+	// 未登録、またはすでに更新待ちなら何もしない
+	if (!collisionManager_ || isShapeDirty_) return;
+	collisionManager_->MarkDirty(this);
+}
+
+
 /// -------------------------------------------------------------
 ///						　	OBBを取得
 /// -------------------------------------------------------------
@@ -97,16 +128,16 @@ void Collider::DrawImGui()
 		ImGui::ColorEdit4("Color", &debugColor_.x);
 
 		// -------- Capsule -------- //
-		if (ImGui::Checkbox("Use Capsule", &useCapsule_)) {}
+		if (ImGui::Checkbox("Use Capsule", &useCapsule_)) { MarkShapeDirty(); }
 		if (useCapsule_)
 		{
 			Vector3 pA = capsule_.segment.origin;
 			Vector3 pB = capsule_.segment.diff;
 			float   r = capsule_.radius;
 
-			if (ImGui::DragFloat3("Point A", &pA.x, 0.05f)) capsule_.segment.origin = pA;
-			if (ImGui::DragFloat3("Point B", &pB.x, 0.05f)) capsule_.segment.diff = pB;
-			if (ImGui::DragFloat("Radius", &r, 0.01f))  capsule_.radius = std::max(0.0f, r);
+			if (ImGui::DragFloat3("Point A", &pA.x, 0.05f)) { capsule_.segment.origin = pA; MarkShapeDirty(); }
+			if (ImGui::DragFloat3("Point B", &pB.x, 0.05f)) { capsule_.segment.diff = pB; MarkShapeDirty(); }
+			if (ImGui::DragFloat("Radius", &r, 0.01f)) { capsule_.radius = std::max(0.0f, r); MarkShapeDirty(); }
 		}
 
 		ImGui::TreePop();
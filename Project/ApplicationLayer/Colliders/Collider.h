@@ -1,9 +1,11 @@
 #pragma once
 #include <cstdint>
+#include <span>
 #include "Vector3.h"
 #include "Vector4.h"
 #include "Matrix4x4.h"
 #include "IDGenerator.h"
+#include "SlotMap.h"
 
 #include "OBB.h"
 #include "Segment.h"
@@ -11,6 +13,10 @@
 #include "Sphere.h"
 
 
+/// ---------- 前方宣言 ---------- ///
+class CollisionManager;
+
+
 /// -------------------------------------------------------------
 ///                     当たり判定クラス
 /// -------------------------------------------------------------
@@ -21,8 +27,8 @@ public: /// ---------- 純粋仮想関数 ---------- ///
 	// コンストラクタ
 	Collider() : serialNumber_(IDGenerator::Generate()) {} // シリアルナンバーを生成
 
-	// 仮想デストラクタ
-	virtual ~Collider() = default;
+	// 仮想デストラクタ（登録されていれば CollisionManager から外す）
+	virtual ~Collider();
 
 	// 衝突時に呼ばれる仮想関数
 	virtual void OnCollision([[maybe_unused]] Collider* other) {}
@@ -31,36 +37,39 @@ public: /// ---------- OBBのメンバ関数 ---------- ///
 
 	// 中心座標取得・設定
 	virtual Vector3 GetCenterPosition() const { return colliderPosition_; }
-	virtual void SetCenterPosition(const Vector3& pos) { colliderPosition_ = pos; }
+	virtual void SetCenterPosition(const Vector3& pos) { colliderPosition_ = pos; MarkShapeDirty(); }
 
 	// 半サイズ取得・設定
 	virtual Vector3 GetOBBHalfSize() const { return colliderHalfSize_; }
-	virtual void SetOBBHalfSize(const Vector3& halfSize) { colliderHalfSize_ = halfSize; }
+	virtual void SetOBBHalfSize(const Vector3& halfSize) { colliderHalfSize_ = halfSize; MarkShapeDirty(); }
 
 	// 回転（オイラー角）取得・設定
 	virtual Vector3 GetOrientation() const { return orientation_; }
-	virtual void SetOrientation(const Vector3& rot) { orientation_ = rot; }
+	virtual void SetOrientation(const Vector3& rot) { orientation_ = rot; MarkShapeDirty(); }
 
 	OBB GetOBB() const;
 
 public: /// ---------- セグメントのメンバ関数 ---------- ///
 
 	// セグメントを設定（衝突判定用）
-	void SetSegment(const Segment& segment) { segment_ = segment; }
+	void SetSegment(const Segment& segment) { segment_ = segment; MarkShapeDirty(); }
 	// セグメントを取得
 	virtual Segment GetSegment() const { return segment_; }
 
 public: /// ---------- Sphere のメンバ関数 ---------- ///
 
 	// Sphereを設定（衝突判定用）
-	void SetSphere(Sphere& spere) { sphere_ = spere; useSphere_ = true; }
+	void SetSphere(Sphere& spere) { sphere_ = spere; useSphere_ = true; MarkShapeDirty(); }
 	// Sphereを取得
 	virtual Sphere GetSphere() const { return sphere_; }
 
+	// 使用フラグ
+	bool HasSphere() const { return useSphere_; }
+
 public: /// ---------- Capsule のメンバ関数 ---------- ///
 
 	// Capsule を設定
-	virtual void SetCapsule(const Capsule& capsule) { capsule_ = capsule; useCapsule_ = true; }
+	virtual void SetCapsule(const Capsule& capsule) { capsule_ = capsule; useCapsule_ = true; MarkShapeDirty(); }
 
 	// Capsule を取得
 	virtual Capsule GetCapsule() const { return capsule_; }
@@ -71,6 +80,9 @@ public: /// ---------- Capsule のメンバ関数 ---------- ///
 	void SetCapsuleVisible(bool v) { drawCapsule_ = v; }
 	bool IsCapsuleVisible() const { return drawCapsule_; }
 
+	// 子カプセル（複合コライダーだけが返す。Capsule は外形として扱い、当たったときだけ子を調べる）
+	virtual std::span<const Capsule> GetChildCapsules() const { return {}; }
+
 public: /// ---------- デバッグ用メンバ関数 ---------- ///
 
 	// 初期化処理
@@ -80,7 +92,7 @@ public: /// ---------- デバッグ用メンバ関数 ---------- ///
 	void Update();
 
 	// 描画処理（OBBの可視化）
-	void Draw();
+	virtual void Draw();
 
 	// ImGui描画処理
 	void DrawImGui();
@@ -91,13 +103,27 @@ public: /// ---------- 設定 ---------- ///
 	uint32_t GetTypeID() const { return typeID_; }
 
 	// 識別IDを設定
-	void SetTypeID(uint32_t typeID) { typeID_ = typeID; }
+	void SetTypeID(uint32_t typeID) { typeID_ = typeID; MarkShapeDirty(); }
 	// シリアルナンバーを取得
 	uint32_t GetUniqueID() const { return serialNumber_; }
 
 	template<class T> void SetOwner(T* ptr) { owner_ = ptr; }
 	template<class T> T* GetOwner() const { return static_cast<T*>(owner_); }
 
+public: /// ---------- 登録 ---------- ///
+
+	// 登録先の CollisionManager（未登録なら nullptr。生成した弾や部位を同じマネージャーに登録するときに使う）
+	CollisionManager* GetCollisionManager() const { return collisionManager_; }
+
+	// 登録先でのハンドル（未登録なら無効。CollisionManager::GetCollider で生きているか確かめて引ける）
+	SlotHandle GetCollisionHandle() const { return collisionHandle_; }
+
+	// 登録先から外す（死亡時など。実際の削除は次の判定の先頭でまとめて行われる）
+	void Unregister();
+
+	// 形状が変わったことを登録先に知らせる（基底の Set 関数は自動で呼ぶ。独自の値で形状を返す派生クラスは動かしたときに呼ぶ）
+	void MarkShapeDirty();
+
 private: /// ---------- メンバ変数 ---------- ///
 
 	// 識別ID
@@ -105,6 +131,14 @@ private: /// ---------- メンバ変数 ---------- ///
 
 	void* owner_ = nullptr;
 
+private: /// ---------- 登録情報（CollisionManager が書き換える） ---------- ///
+
+	friend class CollisionManager;
+
+	CollisionManager* collisionManager_ = nullptr; // 登録先
+	SlotHandle collisionHandle_{};                 // 登録先でのハンドル（削除時の入れ替えでも変わらない）
+	bool isShapeDirty_ = false;                    // 形状の更新待ちか
+
 private: /// ---------- OBBのメンバ変数 ---------- ///
 
 	// OBBの半サイズ
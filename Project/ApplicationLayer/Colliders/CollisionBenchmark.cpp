@@ -0,0 +1,1538 @@
+#define NOMINMAX
+#include "CollisionBenchmark.h"
+#include "CollisionManager.h"
+#include "CollisionUtility.h"
+#include "CollisionTypeIdDef.h"
+#include "CollisionDispatchTable.h"
+#include "CollisionLayerMatrix.h"
+#include "ShapeProxyBuffer.h"
+#include "ContactRecord.h"
+#include "StaticMeshBVH.h"
+#include "CharacterController.h"
+#include "Collider.h"
+#include "Matrix4x4.h"
+#include "JobSystem.h"
+#include "SlotMap.h"
+#include <LogString.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <memory>
+#include <thread>
+#include <imgui.h>
+
+namespace
+{
+	using Random = std::mt19937;
+	using Clock = std::chrono::steady_clock;
+
+	/// ---------- 乱数で形状を作る ---------- ///
+
+	float Range(Random& random, float min, float max)
+	{
+		return std::uniform_real_distribution<float>(min, max)(random);
+	}
+
+	Vector3 RandomPoint(Random& random, float extent)
+	{
+		return { Range(random, -extent, extent), Range(random, -extent, extent), Range(random, -extent, extent) };
+	}
+
+	// Collider::GetOBB と同じ作り方の軸
+	void SetAxes(OBB& obb, const Vector3& rotate)
+	{
+		const Matrix4x4 rotation = Matrix4x4::MakeRotateMatrix(rotate);
+		for (int i = 0; i < 3; ++i) obb.orientations[i] = { rotation.m[0][i], rotation.m[1][i], rotation.m[2][i] };
+	}
+
+	// size は半サイズ（scale で大きさだけ変える）
+	OBB RandomOBB(Random& random, float extent, float scale = 1.0f, bool rotate = true)
+	{
+		OBB obb{};
+		obb.center = RandomPoint(random, extent);
+		SetAxes(obb, rotate ? RandomPoint(random, 3.1415926f) : Vector3{});
+		obb.size = Vector3{ Range(random, 0.2f, 2.0f), Range(random, 0.2f, 2.0f), Range(random, 0.2f, 2.0f) } * scale;
+		return obb;
+	}
+
+	AABB RandomAABB(Random& random, float extent, float scale = 1.0f)
+	{
+		const Vector3 center = RandomPoint(random, extent);
+		const Vector3 half = Vector3{ Range(random, 0.2f, 2.0f), Range(random, 0.2f, 2.0f), Range(random, 0.2f, 2.0f) } * scale;
+		return { center - half, center + half };
+	}
+
+	Sphere RandomSphere(Random& random, float extent, float scale = 1.0f)
+	{
+		return { RandomPoint(random, extent), Range(random, 0.2f, 2.0f) * scale };
+	}
+
+	// diff は始点からの差分
+	Segment RandomSegment(Random& random, float extent)
+	{
+		return { RandomPoint(random, extent), RandomPoint(random, 2.0f) };
+	}
+
+	// segment.diff は終点
+	Capsule RandomCapsule(Random& random, float extent, float scale = 1.0f)
+	{
+		Capsule capsule{};
+		capsule.segment.origin = RandomPoint(random, extent);
+		capsule.segment.diff = capsule.segment.origin + RandomPoint(random, 1.5f);
+		capsule.radius = Range(random, 0.1f, 1.0f) * scale;
+		return capsule;
+	}
+
+	Plane RandomPlane(Random& random, float extent)
+	{
+		Vector3 normal = RandomPoint(random, 1.0f);
+		if (Vector3::Length(normal) < 1.0e-3f) normal = { 0.0f, 1.0f, 0.0f };
+		return { Vector3::Normalize(normal), Range(random, -extent, extent) };
+	}
+
+	Triangle RandomTriangle(Random& random, float extent)
+	{
+		const Vector3 center = RandomPoint(random, extent);
+		return { { center + RandomPoint(random, 2.0f), center + RandomPoint(random, 2.0f), center + RandomPoint(random, 2.0f) } };
+	}
+
+	// 人型くらいの広がりに子カプセルを並べた体（segment.diff は終点）
+	using Body = std::array<Capsule, 14>;
+	Body RandomBody(Random& random, float extent, float scale = 1.0f)
+	{
+		const Vector3 root = RandomPoint(random, extent);
+		Body body{};
+		for (Capsule& part : body)
+		{
+			part.segment.origin = root + Vector3{ Range(random, -0.5f, 0.5f), Range(random, 0.0f, 1.8f), Range(random, -0.3f, 0.3f) };
+			part.segment.diff = part.segment.origin + RandomPoint(random, 0.3f);
+			part.radius = Range(random, 0.05f, 0.15f) * scale;
+		}
+		return body;
+	}
+
+	// 中心と軸を同じ回転で回す
+	OBB RotateOBB(const OBB& obb, const Matrix4x4& rotation)
+	{
+		OBB rotated = obb;
+		rotated.center = Vector3::Transform(obb.center, rotation);
+		for (int i = 0; i < 3; ++i) rotated.orientations[i] = Vector3::Transform(obb.orientations[i], rotation);
+		return rotated;
+	}
+
+	// 軸がそろったOBBと同じ範囲のAABB
+	AABB ToAABB(const OBB& obb)
+	{
+		return { obb.center - obb.size, obb.center + obb.size };
+	}
+
+	// 点のカプセル
+	Capsule ToCapsule(const Sphere& sphere)
+	{
+		Capsule capsule{};
+		capsule.segment = { sphere.center, sphere.center };
+		capsule.radius = sphere.radius;
+		return capsule;
+	}
+
+	// AABB との判定用（diff を終点から差分に直す）
+	Capsule ToDeltaCapsule(const Capsule& capsule)
+	{
+		Capsule delta = capsule;
+		delta.segment.diff = capsule.segment.diff - capsule.segment.origin;
+		return delta;
+	}
+
+	// 一括判定用に詰める
+	void FillBatch(Random& random, float extent, CapsuleBatch& batch)
+	{
+		for (uint32_t i = 0; i < kShapeBatchWidth; ++i)
+		{
+			const Capsule capsule = RandomCapsule(random, extent);
+			batch.ax[i] = capsule.segment.origin.x; batch.ay[i] = capsule.segment.origin.y; batch.az[i] = capsule.segment.origin.z;
+			batch.bx[i] = capsule.segment.diff.x; batch.by[i] = capsule.segment.diff.y; batch.bz[i] = capsule.segment.diff.z;
+			batch.radius[i] = capsule.radius;
+		}
+	}
+
+	void FillBatch(Random& random, float extent, OBBBatch& batch)
+	{
+		for (uint32_t i = 0; i < kShapeBatchWidth; ++i)
+		{
+			const OBB obb = RandomOBB(random, extent);
+			batch.cx[i] = obb.center.x; batch.cy[i] = obb.center.y; batch.cz[i] = obb.center.z;
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				batch.axis[axis][0][i] = obb.orientations[axis].x;
+				batch.axis[axis][1][i] = obb.orientations[axis].y;
+				batch.axis[axis][2][i] = obb.orientations[axis].z;
+			}
+			batch.sx[i] = obb.size.x; batch.sy[i] = obb.size.y; batch.sz[i] = obb.size.z;
+		}
+	}
+
+	// 一括判定のレーン i を取り出す
+	Capsule GetLane(const CapsuleBatch& batch, uint32_t i)
+	{
+		Capsule capsule{};
+		capsule.segment = { { batch.ax[i], batch.ay[i], batch.az[i] }, { batch.bx[i], batch.by[i], batch.bz[i] } };
+		capsule.radius = batch.radius[i];
+		return capsule;
+	}
+
+	OBB GetLane(const OBBBatch& batch, uint32_t i)
+	{
+		OBB obb{};
+		obb.center = { batch.cx[i], batch.cy[i], batch.cz[i] };
+		for (int axis = 0; axis < 3; ++axis) obb.orientations[axis] = { batch.axis[axis][0][i], batch.axis[axis][1][i], batch.axis[axis][2][i] };
+		obb.size = { batch.sx[i], batch.sy[i], batch.sz[i] };
+		return obb;
+	}
+
+
+	/// ---------- 以前の行列を使うOBB判定（一致テストの基準） ---------- ///
+
+	// 中心を回転のあとに引くので、回転したOBBが原点から離れていると正しくない（比べるときは中心を原点に置く）
+	bool ReferenceIsCollision(const OBB& obb, const Sphere& sphere)
+	{
+		Matrix4x4 obbWorldMatrix = Matrix4x4::MakeAffineMatrix(Vector3{ 1.0f, 1.0f, 1.0f }, Vector3{}, obb.center);
+		Matrix4x4 obbRotationMatrix = Matrix4x4::MakeAffineMatrix(Vector3{ 1.0f, 1.0f, 1.0f }, Vector3{}, Vector3{});
+		for (int i = 0; i < 3; ++i)
+		{
+			obbRotationMatrix.m[i][0] = obb.orientations[i].x;
+			obbRotationMatrix.m[i][1] = obb.orientations[i].y;
+			obbRotationMatrix.m[i][2] = obb.orientations[i].z;
+		}
+
+		obbWorldMatrix = Matrix4x4::Multiply(obbWorldMatrix, obbRotationMatrix);
+		const Vector3 centerInOBBLocalSpace = Vector3::Transform(sphere.center, Matrix4x4::Inverse(obbWorldMatrix));
+
+		Vector3 closestPoint = centerInOBBLocalSpace;
+		closestPoint.x = std::max(-obb.size.x * 0.5f, std::min(closestPoint.x, obb.size.x * 0.5f));
+		closestPoint.y = std::max(-obb.size.y * 0.5f, std::min(closestPoint.y, obb.size.y * 0.5f));
+		closestPoint.z = std::max(-obb.size.z * 0.5f, std::min(closestPoint.z, obb.size.z * 0.5f));
+
+		const Vector3 difference = centerInOBBLocalSpace - closestPoint;
+		return Vector3::Dot(difference, difference) <= sphere.radius * sphere.radius;
+	}
+
+	bool ReferenceIsCollision(const OBB& obb, const Segment& segment)
+	{
+		const Matrix4x4 rotationMatrix = {
+			obb.orientations[0].x, obb.orientations[0].y, obb.orientations[0].z, 0.0f,
+			obb.orientations[1].x, obb.orientations[1].y, obb.orientations[1].z, 0.0f,
+			obb.orientations[2].x, obb.orientations[2].y, obb.orientations[2].z, 0.0f,
+			0.0f, 0.0f, 0.0f, 1.0f
+		};
+
+		// 回転の逆行列に平行移動の逆変換を足す
+		Matrix4x4 obbWorldMatrixInverse = Matrix4x4::Inverse(rotationMatrix);
+		for (int j = 0; j < 3; ++j)
+		{
+			obbWorldMatrixInverse.m[3][j] = -(obb.center.x * obbWorldMatrixInverse.m[0][j] + obb.center.y * obbWorldMatrixInverse.m[1][j] + obb.center.z * obbWorldMatrixInverse.m[2][j]);
+		}
+
+		const Vector3 localOrigin = Vector3::Transform(segment.origin, obbWorldMatrixInverse);
+		const Vector3 localEnd = Vector3::Transform(segment.origin + segment.diff, obbWorldMatrixInverse);
+		const Segment localSegment = { localOrigin, localEnd - localOrigin };
+
+		const AABB aabbOBBLocal{ -obb.size, obb.size };
+		return CollisionUtility::IsCollision(aabbOBBLocal, localSegment);
+	}
+
+	// 15軸それぞれを正規化して両方のOBBを射影する
+	bool ReferenceIsCollision(const OBB& obb1, const OBB& obb2)
+	{
+		const float epsilon = 1e-5f;
+
+		Vector3 axes[15] = { obb1.orientations[0], obb1.orientations[1], obb1.orientations[2], obb2.orientations[0], obb2.orientations[1], obb2.orientations[2] };
+		for (int i = 0; i < 3; ++i)
+		{
+			for (int j = 0; j < 3; ++j) axes[6 + i * 3 + j] = Vector3::Cross(obb1.orientations[i], obb2.orientations[j]);
+		}
+
+		auto project = [](const OBB& obb, const Vector3& axis, float& min, float& max) {
+			const float center = Vector3::Dot(obb.center, axis);
+			const float extent =
+				std::abs(Vector3::Dot(obb.orientations[0] * obb.size.x, axis)) +
+				std::abs(Vector3::Dot(obb.orientations[1] * obb.size.y, axis)) +
+				std::abs(Vector3::Dot(obb.orientations[2] * obb.size.z, axis));
+			min = center - extent;
+			max = center + extent;
+			};
+
+		for (const Vector3& candidate : axes)
+		{
+			if (Vector3::Length(candidate) < epsilon) continue; // 平行な辺の外積は無視
+
+			const Vector3 axis = Vector3::Normalize(candidate);
+			float min1, max1, min2, max2;
+			project(obb1, axis, min1, max1);
+			project(obb2, axis, min2, max2);
+			if (max1 < min2 || max2 < min1) return false;
+		}
+		return true;
+	}
+
+	/// ---------- BVH を使わずに全三角形をなめる（BVH の一致テストの基準） ---------- ///
+
+	// 三角形をばらまいたスープ（重なりや貫通もそのまま）
+	std::vector<Triangle> RandomSoup(Random& random, float extent)
+	{
+		std::vector<Triangle> soup(1 + random() % 96);
+		for (Triangle& triangle : soup) triangle = RandomTriangle(random, extent);
+		return soup;
+	}
+
+	// 線分（origin + diff * t, t ∈ [0, maxT]）が最初に当たる t（当たらなければ -1）
+	float LinearClosestT(const std::vector<Triangle>& soup, const Vector3& origin, const Vector3& diff, float maxT)
+	{
+		float closest = -1.0f;
+		for (const Triangle& triangle : soup)
+		{
+			float t = 0.0f;
+			if (StaticMeshBVH::IntersectTriangle(triangle, origin, diff, maxT, t) && (closest < 0.0f || t < closest)) closest = t;
+		}
+		return closest;
+	}
+
+	// 最も深い接触のめり込み量（接触がなければ -1）
+	template <typename Shape, typename ContactFunction>
+	float LinearDeepest(const std::vector<Triangle>& soup, const Shape& shape, ContactFunction&& contactFunction)
+	{
+		float deepest = -1.0f;
+		for (const Triangle& triangle : soup)
+		{
+			StaticMeshBVH::Contact contact;
+			if (contactFunction(shape, triangle, StaticMeshBVH::ComputeNormal(triangle), contact) && (deepest < 0.0f || contact.depth > deepest)) deepest = contact.depth;
+		}
+		return deepest;
+	}
+
+
+	/// ---------- シナリオ用のコライダー ---------- ///
+
+	// 応答処理に届いた組をハッシュにまとめる（応答処理は ID 順なので方式によらず同じ値になる）
+	class BenchmarkCollider : public Collider
+	{
+	public:
+		explicit BenchmarkCollider(uint64_t* hash) : hash_(hash) {}
+
+		void OnCollision(Collider* other) override
+		{
+			const uint64_t pair = (static_cast<uint64_t>(GetUniqueID()) << 32) | other->GetUniqueID();
+			*hash_ = (*hash_ ^ pair) * 1099511628211ull;
+		}
+
+	private:
+		uint64_t* hash_;
+	};
+
+	// 動かす前の形状
+	struct SceneEntry
+	{
+		std::unique_ptr<BenchmarkCollider> collider;
+		Vector3 position;
+		Segment segment;
+		Capsule capsule;
+		Sphere sphere;
+		Vector3 velocity;
+	};
+
+	// フレーム frame の位置に置く（方式ごとに同じ動きを再現する）
+	void PlaceEntry(SceneEntry& entry, uint32_t frame)
+	{
+		const Vector3 offset = entry.velocity * static_cast<float>(frame);
+		BenchmarkCollider& collider = *entry.collider;
+		collider.SetCenterPosition(entry.position + offset);
+		collider.SetSegment({ entry.segment.origin + offset, entry.segment.diff });
+		if (collider.HasCapsule())
+		{
+			Capsule capsule = entry.capsule;
+			capsule.segment.origin += offset;
+			capsule.segment.diff += offset;
+			collider.SetCapsule(capsule);
+
+			Sphere sphere = { entry.sphere.center + offset, entry.sphere.radius };
+			collider.SetSphere(sphere);
+		}
+	}
+
+	const char* const kModeNames[] = { "BruteForce", "Tree", "Grid" };
+
+
+	/// ---------- 以前のディスパッチ（std::map + std::function） ---------- ///
+
+	using LegacyCollisionFunc = std::function<bool(Collider*, Collider*)>;
+	using LegacyCollisionTable = std::map<std::pair<uint32_t, uint32_t>, LegacyCollisionFunc>;
+
+	// 以前の CollisionManager::RegisterCollisionFuncsions と同じ登録（敵→弾の向きがないので、当たりの数は今のテーブルより少ない）
+	LegacyCollisionTable MakeLegacyCollisionTable()
+	{
+		using CU = CollisionUtility;
+		constexpr uint32_t kPlayer = static_cast<uint32_t>(CollisionTypeIdDef::kPlayer);
+		constexpr uint32_t kEnemy = static_cast<uint32_t>(CollisionTypeIdDef::kEnemy);
+		constexpr uint32_t kBullet = static_cast<uint32_t>(CollisionTypeIdDef::kBullet);
+		constexpr uint32_t kItem = static_cast<uint32_t>(CollisionTypeIdDef::kItem);
+		constexpr uint32_t kBoss = static_cast<uint32_t>(CollisionTypeIdDef::kBoss);
+		constexpr uint32_t kBossBullet = static_cast<uint32_t>(CollisionTypeIdDef::kBossBullet);
+
+		LegacyCollisionTable table;
+		table[{ kBoss, kPlayer }] = [](Collider* a, Collider* b) { return CU::IsCollision(a->GetCapsule(), b->GetSphere()); };
+		table[{ kPlayer, kBoss }] = [](Collider* a, Collider* b) { return CU::IsCollision(b->GetCapsule(), a->GetSphere()); };
+		table[{ kEnemy, kPlayer }] = [](Collider* a, Collider* b) { return CU::IsCollision(a->GetCapsule(), b->GetSphere()); };
+		table[{ kBullet, kEnemy }] = [](Collider* a, Collider* b) {
+			if (b->HasCapsule()) return CU::IsCollision(a->GetSegment(), b->GetCapsule());
+			else                 return CU::IsCollision(a->GetSegment(), b->GetOBB()); };
+		table[{ kBoss, kBullet }] = [](Collider* a, Collider* b) {
+			if (a->HasCapsule()) return CU::IsCollision(a->GetCapsule(), b->GetSegment());
+			else                 return CU::IsCollision(a->GetOBB(), b->GetSegment()); };
+		table[{ kBullet, kBoss }] = [](Collider* a, Collider* b) {
+			if (b->HasCapsule()) return CU::IsCollision(a->GetSegment(), b->GetCapsule());
+			else                 return CU::IsCollision(a->GetSegment(), b->GetOBB()); };
+		table[{ kPlayer, kBossBullet }] = [](Collider* a, Collider* b) { return CU::IsCollision(a->GetCapsule(), b->GetSegment()); };
+		table[{ kBossBullet, kPlayer }] = [](Collider* a, Collider* b) { return CU::IsCollision(b->GetCapsule(), a->GetSegment()); };
+		table[{ kPlayer, kItem }] = [](Collider* a, Collider* b) { return CU::IsCollision(a->GetOBB(), b->GetOBB()); };
+		table[{ kItem, kPlayer }] = [](Collider* a, Collider* b) { return CU::IsCollision(a->GetOBB(), b->GetOBB()); };
+		return table;
+	}
+
+
+	/// ---------- 弾の並列更新 ---------- ///
+
+	// Bullet::Simulate と同じ計算をする弾（モデル・コライダーなし）
+	struct SimulatedBullet
+	{
+		Vector3 position;
+		Vector3 previousPosition;
+		Vector3 velocity;
+		Segment segment;
+		float distanceTraveled = 0.0f;
+	};
+
+	void SimulateBullets(std::vector<SimulatedBullet>& bullets, size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			SimulatedBullet& bullet = bullets[i];
+			bullet.previousPosition = bullet.position;
+			bullet.position += bullet.velocity;
+			bullet.distanceTraveled += Vector3::Length(bullet.velocity);
+			const Vector3 dir = bullet.position - bullet.previousPosition;
+			bullet.segment.origin = bullet.previousPosition;
+			bullet.segment.diff = dir + Vector3::Normalize(dir) * 0.2f;
+		}
+	}
+
+	// 以前の Weapon::Update（256個未満はその場で、それ以上は弾256個/スレッドを目安に毎フレーム起動して join）
+	void SimulateWithThreads(std::vector<SimulatedBullet>& bullets)
+	{
+		const size_t count = bullets.size();
+		if (count < 256)
+		{
+			SimulateBullets(bullets, 0, count);
+			return;
+		}
+
+		const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+		const unsigned threadCount = std::max(1u, std::min<unsigned>(hw, static_cast<unsigned>((count + 255) / 256)));
+		const size_t stride = (count + threadCount - 1) / threadCount;
+
+		std::vector<std::thread> threads;
+		threads.reserve(threadCount);
+		for (unsigned t = 0; t < threadCount; ++t)
+		{
+			const size_t begin = t * stride;
+			const size_t end = std::min(count, begin + stride);
+			if (begin < end) threads.emplace_back(SimulateBullets, std::ref(bullets), begin, end);
+		}
+		for (std::thread& thread : threads) thread.join();
+	}
+
+	/// ---------- 敵弾とプレイヤー ---------- ///
+
+	// EnemyBullet と同じ値（Enemy の bulletSpeed・弾の寿命・プレイヤーの当たり半径）
+	constexpr float kEnemyBulletSpeed = 24.0f;
+	constexpr float kEnemyBulletLife = 3.0f;
+	constexpr float kEnemyBulletRadius = 0.6f;
+
+	struct Projectile
+	{
+		Vector3 position;
+		Vector3 velocity;
+	};
+
+	// EnemyBullet::UpdateAll と同じ順番（寿命を減らす → 移動 → 判定）で1発を飛ばし、当たったかを返す
+	// hitTest(移動前, 移動量) で判定し、frameCount に進めたフレーム数を足す
+	template <typename HitTest>
+	bool FlyProjectile(const Projectile& projectile, float dt, HitTest&& hitTest, uint64_t& frameCount)
+	{
+		Vector3 position = projectile.position;
+		const Vector3 move = projectile.velocity * dt;
+		for (float life = kEnemyBulletLife - dt; life > 0.0f; life -= dt)
+		{
+			++frameCount;
+			const Vector3 start = position;
+			position += move;
+			if (hitTest(start, move)) return true;
+		}
+		return false;
+	}
+
+	// 寿命が尽きるまでに進む経路と原点の最短距離（double で求める）
+	double PathDistance(const Projectile& projectile, float dt)
+	{
+		uint64_t frameCount = 0;
+		FlyProjectile(projectile, dt, [](const Vector3&, const Vector3&) { return false; }, frameCount);
+
+		// 毎フレーム同じ移動量を足すので、経路は1本の線分になる
+		const double p[3] = { projectile.position.x, projectile.position.y, projectile.position.z };
+		const double d[3] = { projectile.velocity.x * static_cast<double>(dt) * frameCount, projectile.velocity.y * static_cast<double>(dt) * frameCount, projectile.velocity.z * static_cast<double>(dt) * frameCount };
+		const double dd = d[0] * d[0] + d[1] * d[1] + d[2] * d[2];
+		const double t = dd > 0.0 ? std::clamp(-(p[0] * d[0] + p[1] * d[1] + p[2] * d[2]) / dd, 0.0, 1.0) : 0.0;
+		const double c[3] = { p[0] + d[0] * t, p[1] + d[1] * t, p[2] + d[2] * t };
+		return std::sqrt(c[0] * c[0] + c[1] * c[1] + c[2] * c[2]);
+	}
+
+
+	/// ---------- コライダーの入れ物 ---------- ///
+
+	// 以前の CollisionManager と同じ std::vector のポインタ（削除・生きているかの確認は線形探索）
+	struct PointerStore
+	{
+		using Key = const uint32_t*;
+		std::vector<const uint32_t*> objects;
+
+		Key Insert(const uint32_t* object) { objects.push_back(object); return object; }
+		void Erase(Key key) { objects.erase(std::remove(objects.begin(), objects.end(), key), objects.end()); }
+		bool Contains(Key key) const { return std::find(objects.begin(), objects.end(), key) != objects.end(); }
+		template <typename Func> void ForEach(Func&& func) const { for (const uint32_t* object : objects) func(*object); }
+	};
+
+	// 今の CollisionManager と同じ SlotMap（ハンドルの世代で古い参照を見分ける）
+	struct SlotMapStore
+	{
+		using Key = SlotHandle;
+		SlotMap<const uint32_t*> objects;
+
+		Key Insert(const uint32_t* object) { return objects.Insert(object); }
+		void Erase(Key key) { objects.Erase(key); }
+		bool Contains(Key key) const { return objects.Contains(key); }
+		template <typename Func> void ForEach(Func&& func) const { for (const uint32_t* object : objects) func(*object); }
+	};
+
+	// count 個を入れてから、毎フレーム 1/20 を入れ替え・同じ数の参照を確認・全走査する（弾の生成と消滅）
+	// 1フレームあたりのミリ秒を返し、checksum に結果を足し込む（乱数列は入れ物によらず同じ）
+	template <typename Store>
+	float MeasureContainer(uint32_t count, uint32_t frameCount, uint64_t& checksum)
+	{
+		const uint32_t churn = std::max(1u, count / 20);
+		std::vector<uint32_t> ids(count + churn * frameCount);
+		for (uint32_t i = 0; i < ids.size(); ++i) ids[i] = i;
+
+		Random random(count);
+		Store store;
+		std::vector<typename Store::Key> live;
+		std::vector<typename Store::Key> dead;
+		uint32_t next = 0;
+		for (; next < count; ++next) live.push_back(store.Insert(&ids[next]));
+
+		const auto startTime = Clock::now();
+		for (uint32_t frame = 0; frame < frameCount; ++frame)
+		{
+			for (uint32_t i = 0; i < churn; ++i)
+			{
+				const uint32_t index = random() % live.size();
+				store.Erase(live[index]);
+				dead.push_back(live[index]);
+				live[index] = live.back();
+				live.pop_back();
+			}
+			for (uint32_t i = 0; i < churn; ++i) live.push_back(store.Insert(&ids[next++]));
+
+			// 前のフレームで覚えた相手がまだ生きているか（半分は削除済み）
+			for (uint32_t i = 0; i < churn; ++i)
+			{
+				const bool pickDead = (random() % 2) != 0;
+				const uint32_t index = random();
+				checksum += store.Contains(pickDead ? dead[index % dead.size()] : live[index % live.size()]);
+			}
+
+			store.ForEach([&checksum](uint32_t id) { checksum += id; });
+		}
+		return std::chrono::duration<float, std::milli>(Clock::now() - startTime).count() / frameCount;
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　			すべて実行
+/// -------------------------------------------------------------
+void CollisionBenchmark::Run()
+{
+	const auto startTime = Clock::now();
+
+	pairResults_.clear();
+	propertyResults_.clear();
+	sceneResults_.clear();
+	threadSweepResults_.clear();
+	jobResults_.clear();
+	projectileResults_.clear();
+	containerResults_.clear();
+
+	RunPairBenchmarks();
+	RunDispatchBenchmarks();
+	RunPropertyTests();
+	RunSceneBenchmarks();
+	RunJobBenchmarks();
+	RunProjectileBenchmarks();
+	RunContainerBenchmarks();
+
+	totalMilliseconds_ = std::chrono::duration<float, std::milli>(Clock::now() - startTime).count();
+	hasRun_ = true;
+
+	LogResults();
+}
+
+
+/// -------------------------------------------------------------
+///				　		性質テストの失敗数
+/// -------------------------------------------------------------
+uint32_t CollisionBenchmark::GetTotalFailureCount() const
+{
+	uint32_t total = 0;
+	for (const PropertyResult& result : propertyResults_) total += result.failureCount;
+	return total;
+}
+
+
+/// -------------------------------------------------------------
+///				　	組ごとに同じ形状で計測
+/// -------------------------------------------------------------
+template <typename MakeA, typename MakeB, typename Test>
+void CollisionBenchmark::MeasurePair(const char* name, MakeA&& makeA, MakeB&& makeB, Test&& test)
+{
+	// 組ごとに固定の乱数列（組を増やしても他の組の形状は変わらない）
+	Random random(static_cast<uint32_t>(pairResults_.size()) * 7919u + 1u);
+
+	using A = decltype(makeA(random));
+	using B = decltype(makeB(random));
+	std::vector<A> shapesA;
+	std::vector<B> shapesB;
+	shapesA.reserve(kPairSampleCount);
+	shapesB.reserve(kPairSampleCount);
+	for (uint32_t i = 0; i < kPairSampleCount; ++i)
+	{
+		shapesA.push_back(makeA(random));
+		shapesB.push_back(makeB(random));
+	}
+
+	uint32_t hitCount = 0;
+	const auto startTime = Clock::now();
+	for (uint32_t repeat = 0; repeat < kPairRepeatCount; ++repeat)
+	{
+		for (uint32_t i = 0; i < kPairSampleCount; ++i) hitCount += test(shapesA[i], shapesB[i]);
+	}
+	const float nanoseconds = std::chrono::duration<float, std::nano>(Clock::now() - startTime).count();
+
+	PairResult result;
+	result.name = name;
+	result.nsPerTest = nanoseconds / static_cast<float>(kPairSampleCount * kPairRepeatCount);
+	result.hitCount = hitCount / kPairRepeatCount;
+	pairResults_.push_back(result);
+}
+
+
+/// -------------------------------------------------------------
+///				　	性質を件数分調べる
+/// -------------------------------------------------------------
+template <typename Case>
+void CollisionBenchmark::CheckProperty(const char* name, bool exact, Case&& testCase, uint32_t caseCount)
+{
+	PropertyResult result;
+	result.name = name;
+	result.caseCount = caseCount;
+
+	const uint32_t seed = static_cast<uint32_t>(propertyResults_.size()) * 1000003u;
+	for (uint32_t i = 0; i < caseCount; ++i)
+	{
+		// 同じ乱数列で大きさだけ変えて評価できるようにする
+		auto evaluate = [&](float scale) {
+			Random random(seed + i);
+			return testCase(random, scale);
+			};
+
+		const auto [lhs, rhs] = evaluate(1.0f);
+		if (lhs == rhs) continue;
+
+		// 大きさを少し変えると結果が変わるなら境界付近の丸め誤差なので数えない
+		if (!exact)
+		{
+			const auto [lhsSmall, rhsSmall] = evaluate(1.0f - kBoundaryTolerance);
+			const auto [lhsLarge, rhsLarge] = evaluate(1.0f + kBoundaryTolerance);
+			if (lhsSmall != lhsLarge || rhsSmall != rhsLarge) continue;
+		}
+
+		++result.failureCount;
+	}
+
+	propertyResults_.push_back(result);
+}
+
+
+/// -------------------------------------------------------------
+///				　	形状の組ごとの ns/回
+/// -------------------------------------------------------------
+void CollisionBenchmark::RunPairBenchmarks()
+{
+	using CU = CollisionUtility;
+	const float e = 3.0f; // 中心をばらまく範囲（半分前後が当たる程度）
+
+	auto sphere = [e](Random& r) { return RandomSphere(r, e); };
+	auto aabb = [e](Random& r) { return RandomAABB(r, e); };
+	auto obb = [e](Random& r) { return RandomOBB(r, e); };
+	auto segment = [e](Random& r) { return RandomSegment(r, e); };
+	auto capsule = [e](Random& r) { return RandomCapsule(r, e); };
+	auto plane = [e](Random& r) { return RandomPlane(r, e); };
+	auto triangle = [e](Random& r) { return RandomTriangle(r, e); };
+	auto point = [e](Random& r) { return RandomPoint(r, e); };
+	auto capsuleBatch = [e](Random& r) { CapsuleBatch batch; FillBatch(r, e, batch); return batch; };
+	auto obbBatch = [e](Random& r) { OBBBatch batch; FillBatch(r, e, batch); return batch; };
+	auto body = [e](Random& r) { return RandomBody(r, e); };
+	auto compound = [e](Random& r) { const Body parts = RandomBody(r, e); return std::pair{ CU::ComputeBoundingCapsule(parts), parts }; };
+
+	MeasurePair("Sphere - Sphere", sphere, sphere, [](const Sphere& a, const Sphere& b) { return CU::IsCollision(a, b); });
+	MeasurePair("Sphere - Plane", sphere, plane, [](const Sphere& a, const Plane& b) { return CU::IsCollision(a, b); });
+	MeasurePair("Segment - Plane", segment, plane, [](const Segment& a, const Plane& b) { return CU::IsCollision(a, b); });
+	MeasurePair("Triangle - Segment", triangle, segment, [](const Triangle& a, const Segment& b) { return CU::IsCollision(a, b); });
+	MeasurePair("AABB - Point", aabb, point, [](const AABB& a, const Vector3& b) { return CU::IsCollision(a, b); });
+	MeasurePair("AABB - AABB", aabb, aabb, [](const AABB& a, const AABB& b) { return CU::IsCollision(a, b); });
+	MeasurePair("AABB - Plane", aabb, plane, [](const AABB& a, const Plane& b) { return CU::IsCollision(a, b); });
+	MeasurePair("AABB - Sphere", aabb, sphere, [](const AABB& a, const Sphere& b) { return CU::IsCollision(a, b); });
+	MeasurePair("AABB - Segment", aabb, segment, [](const AABB& a, const Segment& b) { return CU::IsCollision(a, b); });
+	MeasurePair("OBB - Sphere", obb, sphere, [](const OBB& a, const Sphere& b) { return CU::IsCollision(a, b); });
+	MeasurePair("OBB - Segment", obb, segment, [](const OBB& a, const Segment& b) { return CU::IsCollision(a, b); });
+	MeasurePair("OBB - OBB", obb, obb, [](const OBB& a, const OBB& b) { return CU::IsCollision(a, b); });
+	MeasurePair("Capsule - Capsule", capsule, capsule, [](const Capsule& a, const Capsule& b) { return CU::IsCollision(a, b); });
+	MeasurePair("Capsule - OBB", capsule, obb, [](const Capsule& a, const OBB& b) { return CU::IsCollision(a, b); });
+	MeasurePair("Capsule - AABB", capsule, aabb, [](const Capsule& a, const AABB& b) { return CU::IsCollision(a, b); });
+	MeasurePair("Capsule - Sphere", capsule, sphere, [](const Capsule& a, const Sphere& b) { return CU::IsCollision(a, b); });
+	MeasurePair("Capsule - Segment", capsule, segment, [](const Capsule& a, const Segment& b) { return CU::IsCollision(a, b); });
+	MeasurePair("Capsule - Plane", capsule, plane, [](const Capsule& a, const Plane& b) { return CU::IsCollision(a, b); });
+
+	MeasurePair("Sweep Sphere - Sphere", sphere, sphere, [](const Sphere& a, const Sphere& b) { float t; return CU::SweepSphere(a, b.center - a.center, b, t); });
+	MeasurePair("Sweep Sphere - Capsule", sphere, capsule, [](const Sphere& a, const Capsule& b) { float t; return CU::SweepSphere(a, b.segment.origin - a.center, b, t); });
+	MeasurePair("TOI Segment - Sphere", segment, sphere, [](const Segment& a, const Sphere& b) { float t; return CU::IntersectSegmentSphere(a, b, t); });
+	MeasurePair("TOI Segment - AABB", segment, aabb, [](const Segment& a, const AABB& b) { float t; return CU::IntersectSegmentAABB(a, b, t); });
+	MeasurePair("TOI Segment - OBB", segment, obb, [](const Segment& a, const OBB& b) { float t; return CU::IntersectSegmentOBB(a, b, t); });
+	MeasurePair("TOI Segment - Capsule", segment, capsule, [](const Segment& a, const Capsule& b) { float t; return CU::IntersectSegmentCapsule(a, b, t); });
+
+	// 一括判定は1回で kShapeBatchWidth 組（ns は1回あたり）
+	MeasurePair("Segment - Capsule x8 (Batch)", segment, capsuleBatch, [](const Segment& a, const CapsuleBatch& b) { return std::popcount(CU::IsCollisionBatch(a, b, kShapeBatchWidth)); });
+	MeasurePair("Segment - OBB x8 (Batch)", segment, obbBatch, [](const Segment& a, const OBBBatch& b) { return std::popcount(CU::IsCollisionBatch(a, b, kShapeBatchWidth)); });
+
+	// 体の部位ごとに別々のコライダーで持つ場合と、外形に当たったときだけ子を調べる場合
+	MeasurePair("Segment - Body x14 (Separate)", segment, body, [](const Segment& a, const Body& b) {
+		return std::any_of(b.begin(), b.end(), [&](const Capsule& part) { return CU::IsCollision(part, a); }); });
+	MeasurePair("Segment - Body (Compound)", segment, compound, [](const Segment& a, const std::pair<Capsule, Body>& b) {
+		return CU::IsCollision(b.first, a) && std::any_of(b.second.begin(), b.second.end(), [&](const Capsule& part) { return CU::IsCollision(part, a); }); });
+}
+
+
+/// -------------------------------------------------------------
+///				　	ディスパッチの1組あたりの計測
+/// -------------------------------------------------------------
+void CollisionBenchmark::RunDispatchBenchmarks()
+{
+	static constexpr uint32_t kColliderCount = 256;
+	static constexpr CollisionTypeIdDef kTypes[] = {
+		CollisionTypeIdDef::kPlayer, CollisionTypeIdDef::kEnemy, CollisionTypeIdDef::kBullet,
+		CollisionTypeIdDef::kItem, CollisionTypeIdDef::kBoss, CollisionTypeIdDef::kBossBullet,
+	};
+
+	// 型ごとにゲームと同じ形状を持たせたコライダー（登録のない組も混ざる）
+	Random random(kColliderCount);
+	uint64_t hash = 0;
+	std::vector<std::unique_ptr<BenchmarkCollider>> colliders(kColliderCount);
+	ShapeProxyBuffer proxies;
+	for (uint32_t i = 0; i < kColliderCount; ++i)
+	{
+		colliders[i] = std::make_unique<BenchmarkCollider>(&hash);
+		BenchmarkCollider& collider = *colliders[i];
+		const CollisionTypeIdDef type = kTypes[i % std::size(kTypes)];
+		const Vector3 position = RandomPoint(random, 4.0f);
+		collider.SetTypeID(static_cast<uint32_t>(type));
+		collider.SetCenterPosition(position);
+		collider.SetOBBHalfSize({ 1.0f, 1.0f, 1.0f });
+		collider.SetOrientation({ 0.0f, Range(random, -3.0f, 3.0f), 0.0f });
+		collider.SetSegment({ position, RandomPoint(random, 3.0f) });
+		if (type == CollisionTypeIdDef::kPlayer || type == CollisionTypeIdDef::kBoss || (type == CollisionTypeIdDef::kEnemy && i % 2 == 0))
+		{
+			Capsule capsule{};
+			capsule.segment = { position, position + Vector3{ 0.0f, 2.0f, 0.0f } };
+			capsule.radius = 0.5f;
+			Sphere sphere = { position, 0.8f };
+			collider.SetCapsule(capsule);
+			collider.SetSphere(sphere);
+		}
+		proxies.UpdateSlot(proxies.AddSlot(collider), collider);
+	}
+
+	auto index = [](Random& r) { return static_cast<uint32_t>(r() % kColliderCount); };
+
+	// 以前：型の組をキーに std::map を引き、std::function 越しにコライダーから形状を取り出して判定
+	const LegacyCollisionTable legacyTable = MakeLegacyCollisionTable();
+	MeasurePair("Dispatch std::map + std::function", index, index, [&](uint32_t a, uint32_t b) {
+		Collider* colliderA = colliders[a].get();
+		Collider* colliderB = colliders[b].get();
+		auto it = legacyTable.find(std::make_pair(colliderA->GetTypeID(), colliderB->GetTypeID()));
+		if (it == legacyTable.end()) return false;
+		return it->second(colliderA, colliderB); });
+
+	// 今：[typeA][typeB] の関数ポインタを引き、形状プロキシのスロットで判定（CollisionManager::TestCollisionPair）
+	MeasurePair("Dispatch flat table", index, index, [&](uint32_t a, uint32_t b) {
+		const CollisionDispatch::Func func = CollisionDispatch::Find(proxies.GetTypeID(a), proxies.GetTypeID(b));
+		return func && func(proxies, a, b); });
+}
+
+
+/// -------------------------------------------------------------
+///				　			性質・一致テスト
+/// -------------------------------------------------------------
+void CollisionBenchmark::RunPropertyTests()
+{
+	using CU = CollisionUtility;
+	using Result = std::pair<bool, bool>;
+	const float e = 3.0f;
+
+	// ---------- 引数の順番を入れ替えても同じ ---------- //
+	CheckProperty("Symmetry Segment/OBB", true, [e](Random& r, float) {
+		const OBB o = RandomOBB(r, e); const Segment s = RandomSegment(r, e);
+		return Result{ CU::IsCollision(o, s), CU::IsCollision(s, o) }; });
+	CheckProperty("Symmetry Capsule/OBB", true, [e](Random& r, float) {
+		const Capsule c = RandomCapsule(r, e); const OBB o = RandomOBB(r, e);
+		return Result{ CU::IsCollision(c, o), CU::IsCollision(o, c) }; });
+	CheckProperty("Symmetry Capsule/AABB", true, [e](Random& r, float) {
+		const Capsule c = RandomCapsule(r, e); const AABB a = RandomAABB(r, e);
+		return Result{ CU::IsCollision(c, a), CU::IsCollision(a, c) }; });
+	CheckProperty("Symmetry Capsule/Sphere", true, [e](Random& r, float) {
+		const Capsule c = RandomCapsule(r, e); const Sphere s = RandomSphere(r, e);
+		return Result{ CU::IsCollision(c, s), CU::IsCollision(s, c) }; });
+	CheckProperty("Symmetry Capsule/Segment", true, [e](Random& r, float) {
+		const Capsule c = RandomCapsule(r, e); const Segment s = RandomSegment(r, e);
+		return Result{ CU::IsCollision(c, s), CU::IsCollision(s, c) }; });
+	CheckProperty("Symmetry Capsule/Plane", true, [e](Random& r, float) {
+		const Capsule c = RandomCapsule(r, e); const Plane p = RandomPlane(r, e);
+		return Result{ CU::IsCollision(c, p), CU::IsCollision(p, c) }; });
+	CheckProperty("Symmetry OBB/OBB", true, [e](Random& r, float) {
+		const OBB a = RandomOBB(r, e); const OBB b = RandomOBB(r, e);
+		return Result{ CU::IsCollision(a, b), CU::IsCollision(b, a) }; });
+
+	// ---------- 軸がそろったOBBはAABBと同じ ---------- //
+	CheckProperty("Axis-aligned OBB = AABB (Segment)", false, [e](Random& r, float scale) {
+		const OBB o = RandomOBB(r, e, scale, false); const Segment s = RandomSegment(r, e);
+		return Result{ CU::IsCollision(o, s), CU::IsCollision(ToAABB(o), s) }; });
+	CheckProperty("Axis-aligned OBB = AABB (OBB)", false, [e](Random& r, float scale) {
+		const OBB a = RandomOBB(r, e, scale, false); const OBB b = RandomOBB(r, e, 1.0f, false);
+		return Result{ CU::IsCollision(a, b), CU::IsCollision(ToAABB(a), ToAABB(b)) }; });
+	CheckProperty("Axis-aligned OBB = AABB (Capsule)", false, [e](Random& r, float scale) {
+		const OBB o = RandomOBB(r, e, scale, false); const Capsule c = RandomCapsule(r, e);
+		return Result{ CU::IsCollision(c, o), CU::IsCollision(ToDeltaCapsule(c), ToAABB(o)) }; });
+
+	// ---------- 回転させても同じ ---------- //
+	CheckProperty("Rotation invariance OBB/OBB", false, [e](Random& r, float scale) {
+		const OBB a = RandomOBB(r, e, scale); const OBB b = RandomOBB(r, e);
+		const Matrix4x4 rotation = Matrix4x4::MakeRotateMatrix(RandomPoint(r, 3.1415926f));
+		return Result{ CU::IsCollision(a, b), CU::IsCollision(RotateOBB(a, rotation), RotateOBB(b, rotation)) }; });
+
+	// ---------- 点のカプセルは球と同じ ---------- //
+	CheckProperty("Point capsule = Sphere (Sphere)", false, [e](Random& r, float scale) {
+		const Sphere a = RandomSphere(r, e, scale); const Sphere b = RandomSphere(r, e);
+		return Result{ CU::IsCollision(ToCapsule(a), b), CU::IsCollision(a, b) }; });
+	CheckProperty("Point capsule = Sphere (Capsule)", false, [e](Random& r, float scale) {
+		const Sphere a = RandomSphere(r, e, scale); const Sphere b = RandomSphere(r, e);
+		return Result{ CU::IsCollision(ToCapsule(a), ToCapsule(b)), CU::IsCollision(a, b) }; });
+	CheckProperty("Point capsule = Sphere (TOI)", false, [e](Random& r, float scale) {
+		const Sphere a = RandomSphere(r, e, scale); const Segment s = RandomSegment(r, e);
+		float t0 = 0.0f, t1 = 0.0f;
+		return Result{ CU::IntersectSegmentCapsule(s, ToCapsule(a), t0), CU::IntersectSegmentSphere(s, a, t1) }; });
+
+	// ---------- 最初に触れる時刻が求まるなら判定も当たり ---------- //
+	CheckProperty("TOI = IsCollision (OBB)", false, [e](Random& r, float scale) {
+		const OBB o = RandomOBB(r, e, scale); const Segment s = RandomSegment(r, e);
+		float t = 0.0f;
+		return Result{ CU::IntersectSegmentOBB(s, o, t), CU::IsCollision(s, o) }; });
+	CheckProperty("TOI = IsCollision (AABB)", false, [e](Random& r, float scale) {
+		const AABB a = RandomAABB(r, e, scale); const Segment s = RandomSegment(r, e);
+		float t = 0.0f;
+		return Result{ CU::IntersectSegmentAABB(s, a, t), CU::IsCollision(a, s) }; });
+	CheckProperty("TOI = IsCollision (Capsule)", false, [e](Random& r, float scale) {
+		const Capsule c = RandomCapsule(r, e, scale); const Segment s = RandomSegment(r, e);
+		float t = 0.0f;
+		return Result{ CU::IntersectSegmentCapsule(s, c, t), CU::IsCollision(c, s) }; });
+	CheckProperty("Sweep(0) = IsCollision (Sphere)", false, [e](Random& r, float scale) {
+		const Sphere a = RandomSphere(r, e, scale); const Sphere b = RandomSphere(r, e);
+		float t = 0.0f;
+		return Result{ CU::SweepSphere(a, Vector3{}, b, t), CU::IsCollision(a, b) }; });
+
+	// ---------- 一括判定はスカラー版とビット単位で同じ ---------- //
+	CheckProperty("Batch = Scalar (Capsule)", true, [e](Random& r, float) {
+		const Segment s = RandomSegment(r, e);
+		CapsuleBatch batch; FillBatch(r, e, batch);
+		const uint32_t mask = CU::IsCollisionBatch(s, batch, kShapeBatchWidth);
+		uint32_t expected = 0;
+		for (uint32_t i = 0; i < kShapeBatchWidth; ++i) expected |= static_cast<uint32_t>(CU::IsCollision(s, GetLane(batch, i))) << i;
+		return Result{ mask == expected, true }; });
+	CheckProperty("Batch = Scalar (OBB)", true, [e](Random& r, float) {
+		const Segment s = RandomSegment(r, e);
+		OBBBatch batch; FillBatch(r, e, batch);
+		const uint32_t mask = CU::IsCollisionBatch(s, batch, kShapeBatchWidth);
+		uint32_t expected = 0;
+		for (uint32_t i = 0; i < kShapeBatchWidth; ++i) expected |= static_cast<uint32_t>(CU::IsCollision(s, GetLane(batch, i))) << i;
+		return Result{ mask == expected, true }; });
+
+	// ---------- 複合コライダーの外形は子をすべて囲む ---------- //
+	CheckProperty("Compound bound contains children", false, [e](Random& r, float scale) {
+		const Body parts = RandomBody(r, e, scale); const Segment s = RandomSegment(r, e);
+		const bool childHit = std::any_of(parts.begin(), parts.end(), [&](const Capsule& part) { return CU::IsCollision(part, s); });
+		return Result{ childHit, childHit && CU::IsCollision(CU::ComputeBoundingCapsule(parts), s) }; });
+
+	// ---------- 以前の行列を使う実装と同じ（境界から 0.1% 以内の差は数えない） ---------- //
+	CheckProperty("Reference OBB/OBB", false, [e](Random& r, float scale) {
+		const OBB a = RandomOBB(r, e, scale); const OBB b = RandomOBB(r, e);
+		return Result{ CU::IsCollision(a, b), ReferenceIsCollision(a, b) }; }, kReferenceCaseCount);
+	CheckProperty("Reference OBB/Segment", false, [e](Random& r, float scale) {
+		const OBB o = RandomOBB(r, e, scale); const Segment s = RandomSegment(r, e);
+		return Result{ CU::IsCollision(o, s), ReferenceIsCollision(o, s) }; }, kReferenceCaseCount);
+	CheckProperty("Reference OBB/Sphere (centered OBB)", false, [e](Random& r, float scale) {
+		OBB o = RandomOBB(r, e, scale); const Sphere s = RandomSphere(r, e);
+		o.center = {};
+		return Result{ CU::IsCollision(o, s), ReferenceIsCollision(o, s) }; }, kReferenceCaseCount);
+
+	// ---------- 静的メッシュの BVH は全三角形をなめた結果と同じ（三角形ごとの式は共通なので完全一致） ---------- //
+	const float soupExtent = e * 2.0f;
+	CheckProperty("BVH IntersectSegment = linear scan", true, [soupExtent](Random& r, float) {
+		const std::vector<Triangle> soup = RandomSoup(r, soupExtent);
+		const Segment s = { RandomPoint(r, soupExtent * 1.5f), RandomPoint(r, soupExtent * 2.0f) };
+		StaticMeshBVH bvh; bvh.Build(soup);
+		StaticMeshBVH::Hit hit;
+		const float t = bvh.IntersectSegment(s, hit) ? hit.t : -1.0f;
+		return Result{ t == LinearClosestT(soup, s.origin, s.diff, 1.0f), true }; });
+	CheckProperty("BVH Raycast = linear scan", true, [soupExtent](Random& r, float) {
+		const std::vector<Triangle> soup = RandomSoup(r, soupExtent);
+		const Vector3 origin = RandomPoint(r, soupExtent * 1.5f);
+		Vector3 direction = RandomPoint(r, 1.0f);
+		direction = Vector3::Dot(direction, direction) > 1.0e-6f ? Vector3::Normalize(direction) : Vector3{ 0.0f, -1.0f, 0.0f };
+		const float maxDistance = Range(r, 1.0f, soupExtent * 4.0f);
+		StaticMeshBVH bvh; bvh.Build(soup);
+		StaticMeshBVH::Hit hit;
+		const float t = bvh.Raycast(origin, direction, maxDistance, hit) ? hit.t : -1.0f;
+		return Result{ t == LinearClosestT(soup, origin, direction, maxDistance), true }; });
+	CheckProperty("BVH OverlapSphere = linear scan", true, [soupExtent](Random& r, float) {
+		const std::vector<Triangle> soup = RandomSoup(r, soupExtent);
+		const Sphere s = RandomSphere(r, soupExtent);
+		StaticMeshBVH bvh; bvh.Build(soup);
+		StaticMeshBVH::Contact contact;
+		const float depth = bvh.OverlapSphere(s, contact) ? contact.depth : -1.0f;
+		return Result{ depth == LinearDeepest(soup, s, StaticMeshBVH::ContactSphere), true }; });
+	CheckProperty("BVH OverlapCapsule = linear scan", true, [soupExtent](Random& r, float) {
+		const std::vector<Triangle> soup = RandomSoup(r, soupExtent);
+		const Capsule c = RandomCapsule(r, soupExtent);
+		StaticMeshBVH bvh; bvh.Build(soup);
+		StaticMeshBVH::Contact contact;
+		const float depth = bvh.OverlapCapsule(c, contact) ? contact.depth : -1.0f;
+		return Result{ depth == LinearDeepest(soup, c, StaticMeshBVH::ContactCapsule), true }; });
+
+	// ---------- キャラクター移動は細かい箱が密集していても取りこぼさない ---------- //
+	// 0.1m 角のタイルを敷いた床（床の平面なし。1体の周りの候補は 32 個を大きく超える）
+	StaticCollisionWorld tileWorld;
+	for (int32_t x = -10; x < 10; ++x)
+	{
+		for (int32_t z = -10; z < 10; ++z)
+		{
+			const Vector3 corner = { static_cast<float>(x) * 0.1f, -0.1f, static_cast<float>(z) * 0.1f };
+			tileWorld.AddBox(AABB{ corner, corner + Vector3{ 0.1f, 0.1f, 0.1f } });
+		}
+	}
+	tileWorld.Build();
+	CheckProperty("CharacterController on dense tiles", true, [&tileWorld](Random& r, float) {
+		CharacterController controller;
+		controller.Initialize({ Range(r, -0.5f, 0.5f), Range(r, 0.0f, 1.0f), Range(r, -0.5f, 0.5f) }, CharacterController::Settings{});
+		const Vector3 walk = { Range(r, -0.4f, 0.4f), 0.0f, Range(r, -0.4f, 0.4f) };
+		for (uint32_t frame = 0; frame < 60; ++frame)
+		{
+			controller.SetVelocity({ walk.x, controller.GetVelocity().y, walk.z });
+			controller.Update(tileWorld, 1.0f / 60.0f);
+		}
+		// タイルの上面（y = 0）に立っていて、沈んでいない
+		return Result{ controller.IsGrounded() && controller.GetPosition().y >= -1.0e-3f, true }; }, 500);
+
+	// ---------- 衝突マトリクス（両方の行で許可された組だけが衝突し、どちらの行で外しても無効になる） ---------- //
+	CheckProperty("LayerMatrix SetMasks = AND of both rows", true, [](Random& r, float) {
+		constexpr uint32_t kLayers = CollisionLayerMatrix::kMaxLayers;
+		std::array<uint32_t, kLayers> masks{};
+		for (uint32_t& mask : masks) mask = static_cast<uint32_t>(r()) | static_cast<uint32_t>(r());
+		CollisionLayerMatrix matrix;
+		matrix.SetMasks(masks);
+		bool ok = true;
+		for (uint32_t a = 0; a < kLayers; ++a)
+		{
+			for (uint32_t b = 0; b < kLayers; ++b)
+			{
+				const bool expected = (masks[a] >> b & 1u) && (masks[b] >> a & 1u);
+				ok &= matrix.CanCollide(a, b) == expected;
+				// 判定する組はどちらか一方の行にだけ入る
+				const bool isChecked = (matrix.GetCheckMask(a) >> b & 1u) || (matrix.GetCheckMask(b) >> a & 1u);
+				ok &= isChecked == (expected && CollisionDispatch::kTable[a][b].test != nullptr);
+			}
+		}
+		// そろえた結果を入れ直しても変わらない（設定ファイルに書き戻した値で読み直した場合）
+		const std::array<uint32_t, kLayers> normalized = matrix.GetMasks();
+		matrix.SetMasks(normalized);
+		ok &= matrix.GetMasks() == normalized;
+		return Result{ ok, true }; });
+
+	// ---------- 接触履歴（入った・続いている・離れた・入り直した） ---------- //
+	using State = ContactRecord::State;
+	CheckProperty("ContactRecord enter/stay/exit", true, [](Random& r, float) {
+		ContactRecord record;
+		const uint32_t id = r() % 1000;
+		bool ok = record.GetState(id) == State::kNone;
+		record.NextFrame(); ok &= record.Touch(id) == State::kEnter && record.GetState(id) == State::kEnter;
+		record.NextFrame(); ok &= record.Touch(id) == State::kStay && record.GetState(id) == State::kStay;
+		record.NextFrame(); ok &= record.GetState(id) == State::kExit;
+		uint32_t exits = 0; record.ForEachExit([&](uint32_t number) { exits += (number == id); });
+		record.NextFrame(); ok &= record.GetState(id) == State::kNone && record.Check(id);
+		record.NextFrame(); ok &= record.Touch(id) == State::kEnter; // 離れてから入り直し
+		return Result{ ok && exits == 1 && record.GetCount() == 1, true }; });
+	CheckProperty("ContactRecord = reference (growth, Clear)", true, [](Random& r, float) {
+		// 8件（内部の配列）を超えて広がる数の相手で、毎フレーム半分ずつ触れる
+		ContactRecord record;
+		std::vector<uint32_t> ids(1 + r() % 40);
+		for (uint32_t& id : ids) id = r() % 100000;
+		std::map<uint32_t, std::pair<uint32_t, uint32_t>> expected; // 番号 → (触れ始め, 最後に触れた)
+		bool ok = true;
+		uint32_t frame = 1;
+		for (uint32_t step = 0; step < 16; ++step)
+		{
+			if (r() % 8 == 0) { record.Clear(); expected.clear(); ok &= record.GetCount() == 0; }
+			record.NextFrame(); ++frame;
+			for (uint32_t id : ids)
+			{
+				if (r() % 2 != 0) continue;
+				auto [it, inserted] = expected.try_emplace(id, frame, frame);
+				if (!inserted && it->second.second != frame)
+				{
+					if (it->second.second + 1 < frame) it->second.first = frame;
+					it->second.second = frame;
+				}
+				ok &= record.Touch(id) == (it->second.first == frame ? State::kEnter : State::kStay);
+			}
+			std::vector<uint32_t> exits;
+			record.ForEachExit([&](uint32_t number) { exits.push_back(number); });
+			uint32_t expectedExits = 0;
+			for (const auto& [id, frames] : expected)
+			{
+				const State state = (frames.second == frame) ? (frames.first == frame ? State::kEnter : State::kStay) : (frames.second + 1 == frame ? State::kExit : State::kNone);
+				ok &= record.GetState(id) == state && record.Check(id);
+				if (state == State::kExit) { ++expectedExits; ok &= std::find(exits.begin(), exits.end(), id) != exits.end(); }
+			}
+			ok &= exits.size() == expectedExits && record.GetCount() == expected.size();
+		}
+		return Result{ ok, true }; });
+
+	// ---------- スロットマップ（削除したハンドルは使い回されても古いまま） ---------- //
+	using Handles = std::vector<std::pair<SlotHandle, uint32_t>>;
+	CheckProperty("SlotMap stale handles", true, [](Random& r, float) {
+		SlotMap<uint32_t> map; Handles live, dead;
+		bool ok = true;
+		for (uint32_t op = 0; op < 64; ++op)
+		{
+			if (live.empty() || r() % 3 != 0) { const uint32_t value = r(); const SlotHandle h = map.Insert(value); ok &= h.IsValid(); live.push_back({ h, value }); continue; }
+			const uint32_t index = r() % live.size();
+			ok &= map.Erase(live[index].first);
+			dead.push_back(live[index]); live[index] = live.back(); live.pop_back();
+		}
+		for (const auto& [h, value] : live) ok &= map.Contains(h) && map.Get(h) && *map.Get(h) == value;
+		for (const auto& [h, value] : dead) ok &= !map.Contains(h) && !map.Get(h) && !map.Erase(h);
+		return Result{ ok && map.GetCount() == live.size(), true }; });
+	CheckProperty("SlotMap erase -> reuse", true, [](Random& r, float) {
+		SlotMap<uint32_t> map; Handles live;
+		for (uint32_t i = 1 + r() % 16; i > 0; --i) { const uint32_t value = r(); live.push_back({ map.Insert(value), value }); }
+		const uint32_t index = r() % live.size();
+		const SlotHandle erased = live[index].first;
+		map.Erase(erased); live[index] = live.back(); live.pop_back();
+		const SlotHandle reused = map.Insert(7u);
+		bool ok = reused.index == erased.index && reused.generation != erased.generation;
+		ok &= !map.Contains(erased) && !map.Get(erased) && map.Get(reused) && *map.Get(reused) == 7u;
+		for (const auto& [h, value] : live) ok &= map.Get(h) && *map.Get(h) == value;
+		return Result{ ok, true }; });
+	CheckProperty("SlotMap EraseIf", true, [](Random& r, float) {
+		SlotMap<uint32_t> map; Handles all;
+		for (uint32_t i = r() % 64; i > 0; --i) { const uint32_t value = r(); all.push_back({ map.Insert(value), value }); }
+		const uint32_t erased = map.EraseIf([](uint32_t value) { return value % 3 == 0; });
+		uint32_t expected = 0;
+		bool ok = true;
+		for (const auto& [h, value] : all)
+		{
+			const bool remove = value % 3 == 0;
+			expected += remove;
+			ok &= remove ? !map.Contains(h) : (map.Get(h) && *map.Get(h) == value);
+		}
+		return Result{ ok && erased == expected && map.GetCount() + erased == all.size(), true }; });
+	CheckProperty("SlotMap generation wrap", true, [](Random& r, float) {
+		// 世代が1周しても0（無効なハンドル）にはならず、削除前のハンドルとも一致しない
+		const uint32_t generation = (r() % 4 == 0) ? ~0u : std::max(1u, static_cast<uint32_t>(r()));
+		const uint32_t next = SlotMap<uint32_t>::NextGeneration(generation);
+		return Result{ next != 0u && next != generation, true }; });
+}
+
+
+/// -------------------------------------------------------------
+///				ワールド全体（規模を変えたもの・弾幕のピーク）
+/// -------------------------------------------------------------
+void CollisionBenchmark::RunSceneBenchmarks()
+{
+	static constexpr uint32_t kScales[] = { 500, 2000, 8000 };
+
+	uint64_t hash = 0;
+
+	// 1つの方式で作り直したマネージャーに同じコライダーを登録し直して計測する（応答処理に届いた組のハッシュを返す）
+	auto measureMode = [&hash](std::vector<SceneEntry>& entries, int32_t mode, SceneResult& result)
+	{
+		CollisionManager manager;
+		manager.SetBroadphaseMode(static_cast<CollisionManager::BroadphaseMode>(mode));
+		for (SceneEntry& entry : entries)
+		{
+			PlaceEntry(entry, 0);
+			manager.AddCollider(entry.collider.get());
+		}
+
+		result.colliderCount = static_cast<uint32_t>(entries.size());
+		result.broadphaseMode = mode;
+
+		hash = 1469598103934665603ull;
+		uint64_t candidatePairs = 0, hitPairs = 0;
+		for (uint32_t frame = 0; frame < kSceneFrameCount; ++frame)
+		{
+			if (frame > 0) for (SceneEntry& entry : entries) PlaceEntry(entry, frame);
+
+			// 最初のフレームだけ総当たりと組そのものを突き合わせる（計測時間には含まれない）
+			manager.SetVerifyBroadphase(mode != 0 && frame == 0);
+			manager.CheckAllCollisions();
+			if (frame == 0) result.matchesBruteForce = (manager.GetVerifyMismatchCount() == 0);
+			result.milliseconds += manager.GetCheckMilliseconds();
+			candidatePairs += manager.GetCandidatePairCount();
+			hitPairs += manager.GetHitPairCount();
+		}
+
+		result.milliseconds /= static_cast<float>(kSceneFrameCount);
+		result.candidatePairs = static_cast<uint32_t>(candidatePairs / kSceneFrameCount);
+		result.hitPairs = static_cast<uint32_t>(hitPairs / kSceneFrameCount);
+		result.pairsPerSecond = (result.milliseconds > 0.0f) ? static_cast<float>(result.candidatePairs) * 1000.0f / result.milliseconds : 0.0f;
+
+		// マネージャーより先にコライダーを外しておく
+		for (SceneEntry& entry : entries) entry.collider->Unregister();
+		return hash;
+	};
+
+	// 3方式で計測して総当たりと比べる（総当たりのハッシュを返す）
+	auto measure = [this, &measureMode](const char* name, std::vector<SceneEntry>& entries)
+	{
+		uint64_t bruteForceHash = 0;
+		for (int32_t mode = 0; mode < 3; ++mode)
+		{
+			SceneResult result;
+			result.name = name;
+			const uint64_t sceneHash = measureMode(entries, mode, result);
+
+			if (mode == 0) bruteForceHash = sceneHash;
+			result.matchesBruteForce = result.matchesBruteForce && (sceneHash == bruteForceHash);
+			sceneResults_.push_back(result);
+		}
+		return bruteForceHash;
+	};
+
+	for (uint32_t colliderCount : kScales)
+	{
+		// 密度をそろえるため数に合わせてワールドを広げる（2500個で半径30程度）
+		const float extent = 30.0f * std::sqrt(static_cast<float>(colliderCount) / 2500.0f);
+		Random random(colliderCount);
+
+		// ゲームと同じくらいの比率（敵:弾:プレイヤー・ボス:アイテム・ボス弾）
+		std::vector<SceneEntry> entries(colliderCount);
+		for (uint32_t i = 0; i < colliderCount; ++i)
+		{
+			SceneEntry& entry = entries[i];
+			entry.collider = std::make_unique<BenchmarkCollider>(&hash);
+			entry.position = { Range(random, -extent, extent), 0.0f, Range(random, -extent, extent) };
+			entry.velocity = { Range(random, -0.3f, 0.3f), 0.0f, Range(random, -0.3f, 0.3f) };
+			BenchmarkCollider& collider = *entry.collider;
+
+			const uint32_t kind = i % 50;
+			if (kind < 8)
+			{
+				collider.SetTypeID(static_cast<uint32_t>(CollisionTypeIdDef::kEnemy));
+				collider.SetOBBHalfSize({ 1.0f, 1.0f, 1.0f });
+				collider.SetOrientation({ 0.0f, Range(random, -3.0f, 3.0f), 0.0f });
+			}
+			else if (kind < 48)
+			{
+				collider.SetTypeID(static_cast<uint32_t>(CollisionTypeIdDef::kBullet));
+				entry.position.y = Range(random, -3.0f, 3.0f);
+				entry.segment = { entry.position, { Range(random, -3.0f, 3.0f), Range(random, -0.6f, 0.6f), Range(random, -3.0f, 3.0f) } };
+			}
+			else if (kind == 48)
+			{
+				collider.SetTypeID(static_cast<uint32_t>((i / 50) % 2 ? CollisionTypeIdDef::kBoss : CollisionTypeIdDef::kPlayer));
+				entry.capsule.segment = { entry.position, entry.position + Vector3{ 0.0f, 2.0f, 0.0f } };
+				entry.capsule.radius = 0.5f;
+				entry.sphere = { entry.position, 0.8f };
+				collider.SetCapsule(entry.capsule);
+				collider.SetSphere(entry.sphere);
+			}
+			else
+			{
+				collider.SetTypeID(static_cast<uint32_t>((i / 50) % 2 ? CollisionTypeIdDef::kBossBullet : CollisionTypeIdDef::kItem));
+				collider.SetOBBHalfSize({ 0.5f, 0.5f, 0.5f });
+				entry.segment = { entry.position, { Range(random, -3.0f, 3.0f), 0.0f, Range(random, -3.0f, 3.0f) } };
+			}
+		}
+
+		measure("Mixed", entries);
+	}
+
+	// 弾幕のピーク（敵1000体に弾の線分20000本。判定するのは敵と弾の組だけ）
+	{
+		static constexpr uint32_t kEnemyCount = 1000;
+		static constexpr uint32_t kBulletCount = 20000;
+		static constexpr float kExtent = 60.0f;
+		Random random(kEnemyCount + kBulletCount);
+
+		std::vector<SceneEntry> entries(kEnemyCount + kBulletCount);
+		for (uint32_t i = 0; i < kEnemyCount + kBulletCount; ++i)
+		{
+			SceneEntry& entry = entries[i];
+			entry.collider = std::make_unique<BenchmarkCollider>(&hash);
+			entry.position = { Range(random, -kExtent, kExtent), 0.0f, Range(random, -kExtent, kExtent) };
+			BenchmarkCollider& collider = *entry.collider;
+
+			if (i < kEnemyCount)
+			{
+				entry.velocity = { Range(random, -0.1f, 0.1f), 0.0f, Range(random, -0.1f, 0.1f) };
+				collider.SetTypeID(static_cast<uint32_t>(CollisionTypeIdDef::kEnemy));
+				collider.SetOBBHalfSize({ 1.0f, 1.0f, 1.0f });
+				collider.SetOrientation({ 0.0f, Range(random, -3.0f, 3.0f), 0.0f });
+			}
+			else
+			{
+				// 1フレームに進む分（+ Bullet::Simulate の余白）を線分にする
+				entry.velocity = { Range(random, -1.5f, 1.5f), 0.0f, Range(random, -1.5f, 1.5f) };
+				entry.position.y = Range(random, 0.0f, 1.5f);
+				entry.segment = { entry.position, entry.velocity + Vector3::Normalize(entry.velocity) * 0.2f };
+				collider.SetTypeID(static_cast<uint32_t>(CollisionTypeIdDef::kBullet));
+			}
+		}
+
+		const uint64_t bruteForceHash = measure("Barrage", entries);
+
+		// ワーカー数を変えて同じ弾幕を判定（呼び出しスレッドも手伝うので、ワーカーは スレッド数 - 1）
+		JobSystem* jobSystem = JobSystem::GetInstance();
+		const uint32_t workerCount = jobSystem->GetWorkerCount();
+		for (uint32_t threadCount : kSweepThreadCounts)
+		{
+			jobSystem->Finalize();
+			jobSystem->Initialize(threadCount - 1);
+
+			for (int32_t mode : { 0, 2 })
+			{
+				SceneResult scene;
+				const uint64_t sceneHash = measureMode(entries, mode, scene);
+
+				ThreadSweepResult result;
+				result.threadCount = threadCount;
+				result.broadphaseMode = mode;
+				result.milliseconds = scene.milliseconds;
+				result.matchesBruteForce = scene.matchesBruteForce && (sceneHash == bruteForceHash);
+				threadSweepResults_.push_back(result);
+			}
+		}
+
+		// 元のワーカー数に戻す（動いていなかったら止めたまま）
+		jobSystem->Finalize();
+		if (workerCount > 0) jobSystem->Initialize(workerCount);
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　弾の更新（std::thread と JobSystem）
+/// -------------------------------------------------------------
+void CollisionBenchmark::RunJobBenchmarks()
+{
+	static constexpr uint32_t kBulletCounts[] = { 1000, 10000, 100000 };
+
+	// Weapon::Update と同じ分割
+	static constexpr size_t kSimulateGrain = 128;
+
+	for (uint32_t bulletCount : kBulletCounts)
+	{
+		Random random(bulletCount);
+		std::vector<SimulatedBullet> bullets(bulletCount);
+		for (SimulatedBullet& bullet : bullets)
+		{
+			bullet.position = RandomPoint(random, 50.0f);
+			bullet.velocity = RandomPoint(random, 1.0f);
+		}
+
+		JobResult result;
+		result.bulletCount = bulletCount;
+
+		auto startTime = Clock::now();
+		for (uint32_t frame = 0; frame < kJobFrameCount; ++frame) SimulateWithThreads(bullets);
+		result.threadMilliseconds = std::chrono::duration<float, std::milli>(Clock::now() - startTime).count() / kJobFrameCount;
+
+		startTime = Clock::now();
+		for (uint32_t frame = 0; frame < kJobFrameCount; ++frame)
+		{
+			JobSystem::GetInstance()->ParallelFor(bullets.size(), kSimulateGrain, [&bullets](size_t begin, size_t end) { SimulateBullets(bullets, begin, end); });
+		}
+		result.jobMilliseconds = std::chrono::duration<float, std::milli>(Clock::now() - startTime).count() / kJobFrameCount;
+
+		jobResults_.push_back(result);
+	}
+}
+
+
+/// -------------------------------------------------------------
+///			　敵弾の当たり（離散判定・分割・SweepSphere）
+/// -------------------------------------------------------------
+void CollisionBenchmark::RunProjectileBenchmarks()
+{
+	static constexpr float kDts[] = { 1.0f / 120.0f, 1.0f / 60.0f, 1.0f / 30.0f, 0.1f };
+
+	// プレイヤーは原点。8〜20m 先から、狙いを的の半径より少し広くばらして撃つ（半分前後が当たる）
+	Random random(9);
+	std::vector<Projectile> projectiles(kProjectileCount);
+	for (Projectile& projectile : projectiles)
+	{
+		Vector3 direction = RandomPoint(random, 1.0f);
+		if (Vector3::Dot(direction, direction) < 1.0e-4f) direction = { 0.0f, 0.0f, 1.0f };
+		projectile.position = Vector3::Normalize(direction) * Range(random, 8.0f, 20.0f);
+		const Vector3 aim = RandomPoint(random, kEnemyBulletRadius * 1.5f);
+		projectile.velocity = Vector3::Normalize(aim - projectile.position) * kEnemyBulletSpeed;
+	}
+
+	const Sphere target = { {}, kEnemyBulletRadius };
+	const float radius2 = kEnemyBulletRadius * kEnemyBulletRadius;
+
+	for (float dt : kDts)
+	{
+		ProjectileResult result;
+		result.dt = dt;
+		result.subStepCount = static_cast<uint32_t>(std::ceil(kEnemyBulletSpeed * dt / kEnemyBulletRadius));
+
+		// 経路が的を通るか（境界から 0.1% 以内は丸め誤差でどちらにもなるので数えない）
+		std::vector<int8_t> expected(kProjectileCount);
+		uint32_t pathHitCount = 0;
+		for (uint32_t i = 0; i < kProjectileCount; ++i)
+		{
+			const double distance = PathDistance(projectiles[i], dt);
+			expected[i] = std::fabs(distance - kEnemyBulletRadius) <= kBoundaryTolerance * kEnemyBulletRadius ? -1 : static_cast<int8_t>(distance < kEnemyBulletRadius);
+			pathHitCount += expected[i] == 1;
+		}
+
+		// 方式ごとに全弾を飛ばして、当たった数と弾1発・1フレームあたりの時間を求める
+		auto measure = [&](auto&& hitTest, float& outHitRate, float& outNs, bool mustHitPath) {
+			std::vector<uint8_t> hits(kProjectileCount);
+			uint64_t frameCount = 0;
+			const auto startTime = Clock::now();
+			for (uint32_t i = 0; i < kProjectileCount; ++i) hits[i] = FlyProjectile(projectiles[i], dt, hitTest, frameCount);
+			const float nanoseconds = std::chrono::duration<float, std::nano>(Clock::now() - startTime).count();
+
+			uint32_t hitCount = 0;
+			for (uint32_t i = 0; i < kProjectileCount; ++i)
+			{
+				if (expected[i] < 0) continue;
+				hitCount += hits[i] && expected[i] == 1;
+				if (hits[i] && expected[i] == 0) result.matchesPath = false;
+				if (mustHitPath && !hits[i] && expected[i] == 1) result.matchesPath = false;
+			}
+			outHitRate = pathHitCount > 0 ? static_cast<float>(hitCount) / static_cast<float>(pathHitCount) : 1.0f;
+			outNs = nanoseconds / static_cast<float>(std::max<uint64_t>(frameCount, 1));
+			};
+
+		// 以前の EnemyBullet（移動後の位置が的に入っているか）
+		measure([&](const Vector3& start, const Vector3& move) {
+			const Vector3 d = start + move - target.center;
+			return Vector3::Dot(d, d) <= radius2; }, result.discreteHitRate, result.discreteNs, false);
+
+		// 移動を subStepCount 回に分けて同じ判定
+		const float subStep = 1.0f / static_cast<float>(result.subStepCount);
+		measure([&](const Vector3& start, const Vector3& move) {
+			for (uint32_t step = 1; step <= result.subStepCount; ++step)
+			{
+				const Vector3 d = start + move * (subStep * static_cast<float>(step)) - target.center;
+				if (Vector3::Dot(d, d) <= radius2) return true;
+			}
+			return false; }, result.subStepHitRate, result.subStepNs, false);
+
+		// 今の EnemyBullet（移動前後を掃引）
+		measure([&](const Vector3& start, const Vector3& move) {
+			float toi = 0.0f;
+			return CollisionUtility::SweepSphere(Sphere{ start, 0.0f }, move, target, toi); }, result.sweepHitRate, result.sweepNs, true);
+
+		projectileResults_.push_back(result);
+	}
+}
+
+
+/// -------------------------------------------------------------
+///			　コライダーの入れ物（std::vector と SlotMap）
+/// -------------------------------------------------------------
+void CollisionBenchmark::RunContainerBenchmarks()
+{
+	static constexpr uint32_t kElementCounts[] = { 1000, 10000 };
+
+	for (uint32_t elementCount : kElementCounts)
+	{
+		uint64_t pointerChecksum = 0;
+		uint64_t slotMapChecksum = 0;
+
+		ContainerResult result;
+		result.elementCount = elementCount;
+		result.pointerMilliseconds = MeasureContainer<PointerStore>(elementCount, kContainerFrameCount, pointerChecksum);
+		result.slotMapMilliseconds = MeasureContainer<SlotMapStore>(elementCount, kContainerFrameCount, slotMapChecksum);
+		result.matches = pointerChecksum == slotMapChecksum;
+		containerResults_.push_back(result);
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　			結果をログに出す
+/// -------------------------------------------------------------
+void CollisionBenchmark::LogResults() const
+{
+	Log(std::format("[CollisionBenchmark] total {:.1f} ms, backend {}\n", totalMilliseconds_, CollisionUtility::GetBatchBackendName()));
+
+	for (const PairResult& result : pairResults_)
+	{
+		Log(std::format("  {:<32} {:8.2f} ns/test ({} hits / {})\n", result.name, result.nsPerTest, result.hitCount, kPairSampleCount));
+	}
+
+	for (const PropertyResult& result : propertyResults_)
+	{
+		Log(std::format("  {:<40} {} / {} failed\n", result.name, result.failureCount, result.caseCount));
+	}
+
+	for (const SceneResult& result : sceneResults_)
+	{
+		Log(std::format("  {:<8} {:5} colliders {:<10} {:8.3f} ms {:9} pairs {:8.2f} M pairs/s {:6} hits {}\n",
+			result.name, result.colliderCount, kModeNames[result.broadphaseMode], result.milliseconds, result.candidatePairs,
+			result.pairsPerSecond * 1.0e-6f, result.hitPairs, result.matchesBruteForce ? "OK" : "MISMATCH"));
+	}
+
+	for (const ThreadSweepResult& result : threadSweepResults_)
+	{
+		Log(std::format("  Barrage  {:2} threads {:<10} {:8.3f} ms {}\n",
+			result.threadCount, kModeNames[result.broadphaseMode], result.milliseconds, result.matchesBruteForce ? "OK" : "MISMATCH"));
+	}
+
+	for (const JobResult& result : jobResults_)
+	{
+		Log(std::format("  {:6} bullets std::thread {:8.3f} ms JobSystem {:8.3f} ms ({} workers)\n",
+			result.bulletCount, result.threadMilliseconds, result.jobMilliseconds, JobSystem::GetInstance()->GetWorkerCount()));
+	}
+
+	for (const ProjectileResult& result : projectileResults_)
+	{
+		Log(std::format("  EnemyBullet dt {:.4f} : discrete {:5.1f}% {:5.1f} ns, x{} sub-steps {:5.1f}% {:5.1f} ns, sweep {:5.1f}% {:5.1f} ns {}\n",
+			result.dt, result.discreteHitRate * 100.0f, result.discreteNs, result.subStepCount, result.subStepHitRate * 100.0f, result.subStepNs,
+			result.sweepHitRate * 100.0f, result.sweepNs, result.matchesPath ? "OK" : "MISMATCH"));
+	}
+
+	for (const ContainerResult& result : containerResults_)
+	{
+		Log(std::format("  {:6} colliders std::vector {:8.3f} ms SlotMap {:8.3f} ms {}\n",
+			result.elementCount, result.pointerMilliseconds, result.slotMapMilliseconds, result.matches ? "OK" : "MISMATCH"));
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　			ImGui描画処理
+/// -------------------------------------------------------------
+void CollisionBenchmark::DrawImGui() const
+{
+	if (!hasRun_) return;
+
+	ImGui::Text("Benchmark : %.1f ms (%s)", totalMilliseconds_, CollisionUtility::GetBatchBackendName());
+
+	if (ImGui::CollapsingHeader("Shape Pairs"))
+	{
+		for (const PairResult& result : pairResults_)
+			ImGui::Text("%-32s %8.2f ns (%u hits)", result.name, result.nsPerTest, result.hitCount);
+	}
+
+	if (ImGui::CollapsingHeader("Properties", ImGuiTreeNodeFlags_DefaultOpen))
+	{
+		ImGui::Text("Failures : %u", GetTotalFailureCount());
+		for (const PropertyResult& result : propertyResults_)
+		{
+			if (result.failureCount == 0) continue;
+			ImGui::Text("%-40s %u / %u", result.name, result.failureCount, result.caseCount);
+		}
+	}
+
+	if (ImGui::CollapsingHeader("Scenes", ImGuiTreeNodeFlags_DefaultOpen))
+	{
+		for (const SceneResult& result : sceneResults_)
+		{
+			ImGui::Text("%-8s %5u %-10s %8.3f ms %9u pairs %7.2f M/s %s",
+				result.name, result.colliderCount, kModeNames[result.broadphaseMode], result.milliseconds, result.candidatePairs,
+				result.pairsPerSecond * 1.0e-6f, result.matchesBruteForce ? "OK" : "MISMATCH");
+		}
+	}
+
+	if (ImGui::CollapsingHeader("Thread Sweep", ImGuiTreeNodeFlags_DefaultOpen))
+	{
+		for (const ThreadSweepResult& result : threadSweepResults_)
+		{
+			ImGui::Text("Barrage %2u threads %-10s %8.3f ms %s",
+				result.threadCount, kModeNames[result.broadphaseMode], result.milliseconds, result.matchesBruteForce ? "OK" : "MISMATCH");
+		}
+	}
+
+	if (ImGui::CollapsingHeader("Bullet Jobs", ImGuiTreeNodeFlags_DefaultOpen))
+	{
+		ImGui::Text("Workers : %u", JobSystem::GetInstance()->GetWorkerCount());
+		for (const JobResult& result : jobResults_)
+			ImGui::Text("%6u bullets std::thread %8.3f ms JobSystem %8.3f ms", result.bulletCount, result.threadMilliseconds, result.jobMilliseconds);
+	}
+
+	if (ImGui::CollapsingHeader("Enemy Bullets", ImGuiTreeNodeFlags_DefaultOpen))
+	{
+		ImGui::Text("Hit rate of bullets whose path crosses the player (ns per bullet-frame)");
+		for (const ProjectileResult& result : projectileResults_)
+		{
+			ImGui::Text("dt %.4f discrete %5.1f%% %5.1f ns  x%u %5.1f%% %5.1f ns  sweep %5.1f%% %5.1f ns %s",
+				result.dt, result.discreteHitRate * 100.0f, result.discreteNs, result.subStepCount, result.subStepHitRate * 100.0f, result.subStepNs,
+				result.sweepHitRate * 100.0f, result.sweepNs, result.matchesPath ? "OK" : "MISMATCH");
+		}
+	}
+
+	if (ImGui::CollapsingHeader("Containers", ImGuiTreeNodeFlags_DefaultOpen))
+	{
+		for (const ContainerResult& result : containerResults_)
+		{
+			ImGui::Text("%6u colliders std::vector %8.3f ms SlotMap %8.3f ms %s",
+				result.elementCount, result.pointerMilliseconds, result.slotMapMilliseconds, result.matches ? "OK" : "MISMATCH");
+		}
+	}
+}
@@ -0,0 +1,164 @@
+#pragma once
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+
+/// -------------------------------------------------------------
+///	　　衝突判定のベンチマークと乱数による性質・一致テスト
+/// -------------------------------------------------------------
+class CollisionBenchmark
+{
+public: /// ---------- 構造体 ---------- ///
+
+	// 形状の組ごとの計測結果
+	struct PairResult
+	{
+		const char* name = "";
+		float nsPerTest = 0.0f; // 1回あたりの時間
+		uint32_t hitCount = 0;  // 当たった数（最適化で計算が消えていないかの目安）
+	};
+
+	// 性質テストの結果
+	struct PropertyResult
+	{
+		const char* name = "";
+		uint32_t caseCount = 0;
+		uint32_t failureCount = 0;
+	};
+
+	// ワールド全体のシナリオの結果
+	struct SceneResult
+	{
+		const char* name = "";         // "Mixed"（ゲームと同じ比率）/ "Barrage"（敵1000体 × 弾20000本）
+		uint32_t colliderCount = 0;
+		int32_t broadphaseMode = 0;    // CollisionManager::BroadphaseMode
+		float milliseconds = 0.0f;     // 1フレームあたり
+		uint32_t candidatePairs = 0;   // 1フレームあたり
+		uint32_t hitPairs = 0;         // 1フレームあたり
+		float pairsPerSecond = 0.0f;   // 候補の組を1秒あたり何組判定できるか
+		bool matchesBruteForce = true; // 応答処理に届いた組が総当たりと同じか（VerifyBroadphase の組の突き合わせも含む）
+	};
+
+	// スレッド数を変えた弾幕のシナリオの結果（1フレームあたり）
+	struct ThreadSweepResult
+	{
+		uint32_t threadCount = 0;      // 呼び出しスレッドを含む
+		int32_t broadphaseMode = 0;    // CollisionManager::BroadphaseMode
+		float milliseconds = 0.0f;
+		bool matchesBruteForce = true; // 応答処理に届いた組が総当たり（既定のワーカー数）と同じか
+	};
+
+	// 弾の並列更新の結果（1フレームあたり）
+	struct JobResult
+	{
+		uint32_t bulletCount = 0;
+		float threadMilliseconds = 0.0f; // 毎フレーム std::thread を作って join する（以前の Weapon::Update）
+		float jobMilliseconds = 0.0f;    // 常駐ワーカーに ParallelFor で流す
+	};
+
+	// 敵弾（EnemyBullet）とプレイヤーの当たり方を dt ごとに比べた結果
+	struct ProjectileResult
+	{
+		float dt = 0.0f;
+		uint32_t subStepCount = 0;    // 離散判定の分割数（1回の移動が的の半径以下になる数）
+		float discreteHitRate = 0.0f; // フレーム末の位置だけで判定（以前の EnemyBullet）。経路が的を通る弾のうち当たった割合
+		float subStepHitRate = 0.0f;  // フレームを subStepCount 回に分けて判定
+		float sweepHitRate = 0.0f;    // SweepSphere（今の EnemyBullet）
+		float discreteNs = 0.0f;      // 弾1発・1フレームあたり
+		float subStepNs = 0.0f;
+		float sweepNs = 0.0f;
+		bool matchesPath = true;      // どの方式も経路と的の最短距離（double）にない当たりを出さず、SweepSphere は取りこぼさないか
+	};
+
+	// コライダーの入れ物の結果（1フレームあたり、削除・追加・古い参照の確認・全走査）
+	struct ContainerResult
+	{
+		uint32_t elementCount = 0;
+		float pointerMilliseconds = 0.0f; // std::vector<Collider*>（以前の CollisionManager）
+		float slotMapMilliseconds = 0.0f; // SlotMap<Collider*>
+		bool matches = true;              // 最後に残った要素が同じか
+	};
+
+public: /// ---------- メンバ関数 ---------- ///
+
+	// すべて実行（数百ミリ秒〜数秒かかるので、ボタンを押したときだけ呼ぶ）
+	void Run();
+
+	// ImGui描画処理（呼び出し側のウィンドウ内に描く）
+	void DrawImGui() const;
+
+public: /// ---------- ゲッター ---------- ///
+
+	const std::vector<PairResult>& GetPairResults() const { return pairResults_; }
+	const std::vector<PropertyResult>& GetPropertyResults() const { return propertyResults_; }
+	const std::vector<SceneResult>& GetSceneResults() const { return sceneResults_; }
+	const std::vector<ThreadSweepResult>& GetThreadSweepResults() const { return threadSweepResults_; }
+	const std::vector<JobResult>& GetJobResults() const { return jobResults_; }
+	const std::vector<ProjectileResult>& GetProjectileResults() const { return projectileResults_; }
+	const std::vector<ContainerResult>& GetContainerResults() const { return containerResults_; }
+
+	// 性質テストの失敗数の合計
+	uint32_t GetTotalFailureCount() const;
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	// 形状の組ごとの ns/回
+	void RunPairBenchmarks();
+
+	// 型の組から判定関数を引いて呼ぶまでの1組あたり（以前の std::map + std::function と今のテーブル）
+	void RunDispatchBenchmarks();
+
+	// 性質・一致テスト
+	void RunPropertyTests();
+
+	// ワールド全体（コライダー数を変えたもの・弾幕のピークを各ブロードフェーズで。弾幕はスレッド数も変える）
+	void RunSceneBenchmarks();
+
+	// 弾の更新（Bullet::Simulate と同じ計算）を std::thread と JobSystem で並べる
+	void RunJobBenchmarks();
+
+	// 敵弾の当たりをフレーム末の離散判定・分割した離散判定・SweepSphere で dt ごとに比べる
+	void RunProjectileBenchmarks();
+
+	// コライダーの入れ物を std::vector のポインタと SlotMap で比べる
+	void RunContainerBenchmarks();
+
+	// 結果をログに出す
+	void LogResults() const;
+
+	// 組ごとに同じ乱数列の形状で count 回判定して計測
+	template <typename MakeA, typename MakeB, typename Test>
+	void MeasurePair(const char* name, MakeA&& makeA, MakeB&& makeB, Test&& test);
+
+	// 1件ごとに (左辺, 右辺) を返す関数で性質を調べる
+	// exact でなければ、大きさを少し変えると結果が変わる境界付近の件は失敗に数えない
+	template <typename Case>
+	void CheckProperty(const char* name, bool exact, Case&& testCase, uint32_t caseCount = kPropertyCaseCount);
+
+private: /// ---------- 定数 ---------- ///
+
+	static constexpr uint32_t kPairSampleCount = 4096;  // 組ごとの形状の数
+	static constexpr uint32_t kPairRepeatCount = 64;    // 計測の繰り返し回数
+	static constexpr uint32_t kPropertyCaseCount = 20000; // 性質ごとの件数
+	static constexpr uint32_t kReferenceCaseCount = 200000; // 以前の実装と比べる件数
+	static constexpr uint32_t kSceneFrameCount = 4;     // シナリオごとのフレーム数
+	static constexpr float kBoundaryTolerance = 1.0e-3f; // 境界付近とみなす大きさの変化率
+	static constexpr uint32_t kJobFrameCount = 32;      // 弾の更新の計測フレーム数
+	static constexpr uint32_t kSweepThreadCounts[] = { 4, 8, 16 }; // 弾幕のシナリオを測るスレッド数
+	static constexpr uint32_t kContainerFrameCount = 16; // 入れ物の計測フレーム数
+	static constexpr uint32_t kProjectileCount = 20000;  // dt ごとに撃つ敵弾の数
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	std::vector<PairResult> pairResults_;
+	std::vector<PropertyResult> propertyResults_;
+	std::vector<SceneResult> sceneResults_;
+	std::vector<ThreadSweepResult> threadSweepResults_;
+	std::vector<JobResult> jobResults_;
+	std::vector<ProjectileResult> projectileResults_;
+	std::vector<ContainerResult> containerResults_;
+	float totalMilliseconds_ = 0.0f;
+	bool hasRun_ = false;
+};
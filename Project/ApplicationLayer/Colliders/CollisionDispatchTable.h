@@ -0,0 +1,272 @@
+#pragma once
+#include <array>
+#include <bit>
+#include <cstdint>
+
+#include "CollisionTypeIdDef.h"
+#include "CollisionUtility.h"
+#include "ShapeProxyBuffer.h"
+
+
+/// -------------------------------------------------------------
+///		衝突判定のディスパッチテーブル（コンパイル時に構築）
+/// -------------------------------------------------------------
+namespace CollisionDispatch
+{
+	/// ---------- 定数・型 ---------- ///
+
+	// コライダーの最大タイプ数
+	inline constexpr uint32_t kMaxTypes = ShapeProxyBuffer::kMaxTypes;
+
+	// 判定関数（形状プロキシのスロット同士。関数ポインタなのでテーブル引きの後は直接呼び出し）
+	using Func = bool(*)(const ShapeProxyBuffer&, uint32_t, uint32_t);
+
+	// 1対多の判定関数（slotA と slotsB[0..count) を調べ、当たったものをビットで返す。count ≦ kShapeBatchWidth）
+	using BatchFunc = uint32_t(*)(const ShapeProxyBuffer&, uint32_t, const uint32_t*, uint32_t);
+
+	// テーブルの要素（未登録は nullptr）
+	struct Entry
+	{
+		Func test = nullptr;
+		BatchFunc batch = nullptr;
+		bool isForward = false; // 登録した向き（一括判定が速い向き）なら true
+	};
+
+	// [typeA][typeB] → 判定関数
+	using Table = std::array<std::array<Entry, kMaxTypes>, kMaxTypes>;
+
+
+	/// ---------- 形状の取り出し方 ---------- ///
+
+	struct SphereShape { static const Sphere& Get(const ShapeProxyBuffer& s, uint32_t slot) { return s.GetSphere(slot); } };
+	struct CapsuleShape { static const Capsule& Get(const ShapeProxyBuffer& s, uint32_t slot) { return s.GetCapsule(slot); } };
+	struct SegmentShape { static const Segment& Get(const ShapeProxyBuffer& s, uint32_t slot) { return s.GetSegment(slot); } };
+	struct OBBShape { static OBB Get(const ShapeProxyBuffer& s, uint32_t slot) { return s.GetOBB(slot); } };
+
+	// カプセルを設定していればカプセル、なければOBB（実行時に HasCapsule で分岐）
+	struct CapsuleOrOBBShape {};
+
+
+	/// ---------- 形状の組ごとの判定 ---------- ///
+
+	template <class ShapeA, class ShapeB>
+	struct ShapeTest
+	{
+		static bool Test(const ShapeProxyBuffer& s, uint32_t a, uint32_t b)
+		{
+			return CollisionUtility::IsCollision(ShapeA::Get(s, a), ShapeB::Get(s, b));
+		}
+	};
+
+	template <class ShapeB>
+	struct ShapeTest<CapsuleOrOBBShape, ShapeB>
+	{
+		static bool Test(const ShapeProxyBuffer& s, uint32_t a, uint32_t b)
+		{
+			if (s.HasCapsule(a)) return ShapeTest<CapsuleShape, ShapeB>::Test(s, a, b);
+			return ShapeTest<OBBShape, ShapeB>::Test(s, a, b);
+		}
+	};
+
+	template <class ShapeA>
+	struct ShapeTest<ShapeA, CapsuleOrOBBShape>
+	{
+		static bool Test(const ShapeProxyBuffer& s, uint32_t a, uint32_t b)
+		{
+			if (s.HasCapsule(b)) return ShapeTest<ShapeA, CapsuleShape>::Test(s, a, b);
+			return ShapeTest<ShapeA, OBBShape>::Test(s, a, b);
+		}
+	};
+
+
+	/// ---------- 複合コライダーの子カプセル（外形に当たった組だけ調べる） ---------- ///
+
+	template <class ShapeOther>
+	struct ChildTest
+	{
+		// compound の子カプセルのどれかが other の形状に当たるか
+		static bool Test(const ShapeProxyBuffer& s, uint32_t compound, uint32_t other)
+		{
+			const auto& shape = ShapeOther::Get(s, other);
+			for (const Capsule& child : s.GetChildCapsules(compound))
+			{
+				if (CollisionUtility::IsCollision(child, shape)) return true;
+			}
+			return false;
+		}
+	};
+
+	template <>
+	struct ChildTest<CapsuleOrOBBShape>
+	{
+		static bool Test(const ShapeProxyBuffer& s, uint32_t compound, uint32_t other)
+		{
+			if (s.HasCapsule(other)) return ChildTest<CapsuleShape>::Test(s, compound, other);
+			return ChildTest<OBBShape>::Test(s, compound, other);
+		}
+	};
+
+	// 外形どうしが当たった組を子カプセルで確かめる（どちらも子を持たなければそのまま通す）
+	template <class ShapeA, class ShapeB>
+	inline bool RefineChildren(const ShapeProxyBuffer& s, uint32_t a, uint32_t b)
+	{
+		if (s.HasChildren(a) && !ChildTest<ShapeB>::Test(s, a, b)) return false;
+		if (s.HasChildren(b) && !ChildTest<ShapeA>::Test(s, b, a)) return false;
+		return true;
+	}
+
+
+	/// ---------- 1対多の一括判定（既定は1組ずつの判定を並べる） ---------- ///
+
+	template <class ShapeA, class ShapeB>
+	struct ShapeBatchTest
+	{
+		static uint32_t Test(const ShapeProxyBuffer& s, uint32_t a, const uint32_t* b, uint32_t count)
+		{
+			uint32_t mask = 0;
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				if (ShapeTest<ShapeA, ShapeB>::Test(s, a, b[i])) mask |= 1u << i;
+			}
+			return mask;
+		}
+	};
+
+	// 線分とカプセルはSIMDカーネルで一括判定
+	template <>
+	struct ShapeBatchTest<SegmentShape, CapsuleShape>
+	{
+		static uint32_t Test(const ShapeProxyBuffer& s, uint32_t a, const uint32_t* b, uint32_t count)
+		{
+			CapsuleBatch batch;
+			s.GatherCapsules(b, count, batch);
+			return CollisionUtility::IsCollisionBatch(s.GetSegment(a), batch, count);
+		}
+	};
+
+	// 線分とOBBはSIMDカーネルで一括判定
+	template <>
+	struct ShapeBatchTest<SegmentShape, OBBShape>
+	{
+		static uint32_t Test(const ShapeProxyBuffer& s, uint32_t a, const uint32_t* b, uint32_t count)
+		{
+			OBBBatch batch;
+			s.GatherOBBs(b, count, batch);
+			return CollisionUtility::IsCollisionBatch(s.GetSegment(a), batch, count);
+		}
+	};
+
+	// カプセルかOBBかで振り分けてそれぞれ一括判定し、元の並びのビットに戻す
+	template <>
+	struct ShapeBatchTest<SegmentShape, CapsuleOrOBBShape>
+	{
+		static uint32_t Test(const ShapeProxyBuffer& s, uint32_t a, const uint32_t* b, uint32_t count)
+		{
+			uint32_t capsuleSlots[kShapeBatchWidth], obbSlots[kShapeBatchWidth];
+			uint32_t capsuleLanes[kShapeBatchWidth], obbLanes[kShapeBatchWidth];
+			uint32_t capsuleCount = 0, obbCount = 0;
+
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				if (s.HasCapsule(b[i])) { capsuleSlots[capsuleCount] = b[i]; capsuleLanes[capsuleCount++] = i; }
+				else { obbSlots[obbCount] = b[i]; obbLanes[obbCount++] = i; }
+			}
+
+			uint32_t mask = 0;
+			if (capsuleCount > 0)
+			{
+				const uint32_t hits = ShapeBatchTest<SegmentShape, CapsuleShape>::Test(s, a, capsuleSlots, capsuleCount);
+				for (uint32_t k = 0; k < capsuleCount; ++k) if (hits & (1u << k)) mask |= 1u << capsuleLanes[k];
+			}
+			if (obbCount > 0)
+			{
+				const uint32_t hits = ShapeBatchTest<SegmentShape, OBBShape>::Test(s, a, obbSlots, obbCount);
+				for (uint32_t k = 0; k < obbCount; ++k) if (hits & (1u << k)) mask |= 1u << obbLanes[k];
+			}
+			return mask;
+		}
+	};
+
+
+	/// ---------- 型の組と形状の組の対応 ---------- ///
+
+	template <CollisionTypeIdDef TypeA, CollisionTypeIdDef TypeB, class ShapeA, class ShapeB>
+	struct Rule
+	{
+		static constexpr uint32_t kTypeA = static_cast<uint32_t>(TypeA);
+		static constexpr uint32_t kTypeB = static_cast<uint32_t>(TypeB);
+		static_assert(kTypeA < kMaxTypes && kTypeB < kMaxTypes, "CollisionTypeIdDef がテーブルの範囲外です");
+
+		// 登録した向き（外形で当たったものだけ子カプセルで確かめる）
+		static bool Forward(const ShapeProxyBuffer& s, uint32_t a, uint32_t b)
+		{
+			return ShapeTest<ShapeA, ShapeB>::Test(s, a, b) && RefineChildren<ShapeA, ShapeB>(s, a, b);
+		}
+
+		// 逆向き（引数を入れ替えて同じ判定を使う）
+		static bool Reverse(const ShapeProxyBuffer& s, uint32_t a, uint32_t b) { return Forward(s, b, a); }
+
+		// 1対多（登録した向きは一括判定、逆向きは1組ずつ）
+		static uint32_t ForwardBatch(const ShapeProxyBuffer& s, uint32_t a, const uint32_t* b, uint32_t count)
+		{
+			uint32_t mask = ShapeBatchTest<ShapeA, ShapeB>::Test(s, a, b, count);
+
+			// 外れはここまでの1回で終わる（複合コライダーとの当たりだけ子を調べる）
+			for (uint32_t bits = mask; bits != 0; bits &= bits - 1)
+			{
+				const uint32_t lane = static_cast<uint32_t>(std::countr_zero(bits));
+				if (!RefineChildren<ShapeA, ShapeB>(s, a, b[lane])) mask &= ~(1u << lane);
+			}
+			return mask;
+		}
+		static uint32_t ReverseBatch(const ShapeProxyBuffer& s, uint32_t a, const uint32_t* b, uint32_t count)
+		{
+			uint32_t mask = 0;
+			for (uint32_t i = 0; i < count; ++i) if (Reverse(s, a, b[i])) mask |= 1u << i;
+			return mask;
+		}
+	};
+
+	// 規則からテーブルを作る（逆向きを先に書くので同じ型同士でも Forward が残る）
+	template <class... Rules>
+	constexpr Table BuildTable()
+	{
+		Table table{};
+		((table[Rules::kTypeB][Rules::kTypeA] = { &Rules::Reverse, &Rules::ReverseBatch, false },
+			table[Rules::kTypeA][Rules::kTypeB] = { &Rules::Forward, &Rules::ForwardBatch, true }), ...);
+		return table;
+	}
+
+
+	/// ---------- 登録（片方向だけ書けば逆向きは自動で入る。判定するかどうかは CollisionLayerMatrix で決める） ---------- ///
+
+	inline constexpr Table kTable = BuildTable<
+		// プレイヤーとボス
+		Rule<CollisionTypeIdDef::kBoss, CollisionTypeIdDef::kPlayer, CapsuleShape, SphereShape>,
+		// プレイヤーと敵
+		Rule<CollisionTypeIdDef::kEnemy, CollisionTypeIdDef::kPlayer, CapsuleShape, SphereShape>,
+		// プレイヤーの弾丸と敵
+		Rule<CollisionTypeIdDef::kBullet, CollisionTypeIdDef::kEnemy, SegmentShape, CapsuleOrOBBShape>,
+		// ボスとプレイヤーの弾丸
+		Rule<CollisionTypeIdDef::kBoss, CollisionTypeIdDef::kBullet, CapsuleOrOBBShape, SegmentShape>,
+		// プレイヤーとボスの弾丸
+		Rule<CollisionTypeIdDef::kPlayer, CollisionTypeIdDef::kBossBullet, CapsuleShape, SegmentShape>,
+		// プレイヤーとアイテム
+		Rule<CollisionTypeIdDef::kPlayer, CollisionTypeIdDef::kItem, OBBShape, OBBShape>
+	>();
+
+
+	// 型の組から判定関数を引く（範囲外・未登録は nullptr）
+	inline Func Find(uint32_t typeA, uint32_t typeB)
+	{
+		if (typeA >= kMaxTypes || typeB >= kMaxTypes) return nullptr;
+		return kTable[typeA][typeB].test;
+	}
+
+	// 型の組から1対多の判定関数を引く（範囲外・未登録は nullptr）
+	inline BatchFunc FindBatch(uint32_t typeA, uint32_t typeB)
+	{
+		if (typeA >= kMaxTypes || typeB >= kMaxTypes) return nullptr;
+		return kTable[typeA][typeB].batch;
+	}
+}
@@ -0,0 +1,133 @@
+#include "CollisionLayerMatrix.h"
+
+namespace
+{
+	// CollisionTypeIdDef の並びと同じ（設定ファイルのキーにもなる）
+	constexpr const char* kLayerNames[] =
+	{
+		"Default", "Player", "Weapon", "Enemy", "Bullet", "EnemyBullet", "Item", "Dummy", "Boss", "BossBullet",
+	};
+	static_assert(std::size(kLayerNames) == CollisionLayerMatrix::kNamedLayerCount, "kLayerNames を CollisionTypeIdDef に合わせてください");
+}
+
+
+/// -------------------------------------------------------------
+///				　		コンストラクタ
+/// -------------------------------------------------------------
+CollisionLayerMatrix::CollisionLayerMatrix()
+{
+	ResetToDefault();
+}
+
+
+/// -------------------------------------------------------------
+///				　		既定値に戻す
+/// -------------------------------------------------------------
+void CollisionLayerMatrix::ResetToDefault()
+{
+	// ディスパッチテーブルに判定関数がある組だけを許可する（組の一覧が二重にならないように）
+	for (uint32_t a = 0; a < kMaxLayers; ++a)
+	{
+		masks_[a] = 0;
+		for (uint32_t b = 0; b < kMaxLayers; ++b)
+		{
+			if (CollisionDispatch::kTable[a][b].test) masks_[a] |= 1u << b;
+		}
+	}
+
+	Rebuild();
+}
+
+
+/// -------------------------------------------------------------
+///				　		組の許可を切り替える
+/// -------------------------------------------------------------
+void CollisionLayerMatrix::SetCollision(uint32_t layerA, uint32_t layerB, bool isEnabled)
+{
+	if (layerA >= kMaxLayers || layerB >= kMaxLayers) return;
+
+	if (isEnabled)
+	{
+		masks_[layerA] |= 1u << layerB;
+		masks_[layerB] |= 1u << layerA;
+	}
+	else
+	{
+		masks_[layerA] &= ~(1u << layerB);
+		masks_[layerB] &= ~(1u << layerA);
+	}
+
+	Rebuild();
+}
+
+
+/// -------------------------------------------------------------
+///				　		行をまとめて設定
+/// -------------------------------------------------------------
+void CollisionLayerMatrix::SetMasks(const std::array<uint32_t, kMaxLayers>& masks)
+{
+	// 先に対称にそろえてから比べる（片方の行だけ違う設定でも毎フレーム作り直さないように）
+	std::array<uint32_t, kMaxLayers> normalized = masks;
+	Symmetrize(normalized);
+
+	// 毎フレーム設定ファイルから読み直すので、同じなら何もしない
+	if (normalized == masks_) return;
+
+	masks_ = normalized;
+	Rebuild();
+}
+
+
+/// -------------------------------------------------------------
+///				　			レイヤー名
+/// -------------------------------------------------------------
+const char* CollisionLayerMatrix::GetLayerName(uint32_t layer)
+{
+	return layer < kNamedLayerCount ? kLayerNames[layer] : nullptr;
+}
+
+
+/// -------------------------------------------------------------
+///				　		マスクを対称にそろえる
+/// -------------------------------------------------------------
+void CollisionLayerMatrix::Symmetrize(std::array<uint32_t, kMaxLayers>& masks)
+{
+	// 両方の行で許可されている組だけを残す（どちらの行で外しても無効にできるように）
+	for (uint32_t a = 0; a < kMaxLayers; ++a)
+	{
+		for (uint32_t b = a + 1; b < kMaxLayers; ++b)
+		{
+			if ((masks[a] >> b & 1u) & (masks[b] >> a & 1u)) continue;
+
+			masks[a] &= ~(1u << b);
+			masks[b] &= ~(1u << a);
+		}
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　	対称にそろえて判定の向きを作り直す
+/// -------------------------------------------------------------
+void CollisionLayerMatrix::Rebuild()
+{
+	Symmetrize(masks_);
+
+	// 各組をどちらの行で調べるかをここで決めておく（判定中はマスクのANDだけで絞り込める）
+	checkMasks_.fill(0);
+	for (uint32_t a = 0; a < kMaxLayers; ++a)
+	{
+		for (uint32_t b = a; b < kMaxLayers; ++b)
+		{
+			if (!(masks_[a] & (1u << b))) continue;
+
+			// 判定関数のない組は許可されていても調べない
+			const CollisionDispatch::Entry& entry = CollisionDispatch::kTable[a][b];
+			if (!entry.test) continue;
+
+			// 登録した向きの行に入れる（線分側から一括判定できる）
+			if (entry.isForward) checkMasks_[a] |= 1u << b;
+			else checkMasks_[b] |= 1u << a;
+		}
+	}
+}
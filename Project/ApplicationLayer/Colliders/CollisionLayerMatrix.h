@@ -0,0 +1,64 @@
+#pragma once
+#include <array>
+#include <cstdint>
+
+#include "CollisionTypeIdDef.h"
+#include "CollisionDispatchTable.h"
+
+
+/// -------------------------------------------------------------
+///		型IDごとの衝突マトリクス（32x32ビット。行が型ID、ビットが相手の型ID）
+/// -------------------------------------------------------------
+class CollisionLayerMatrix
+{
+public: /// ---------- 定数 ---------- ///
+
+	// レイヤーの最大数（型IDの最大数と同じ）
+	static constexpr uint32_t kMaxLayers = CollisionDispatch::kMaxTypes;
+
+	// 名前の付いたレイヤー数（CollisionTypeIdDef の最後 + 1。設定ファイルと ImGui はこの範囲だけ扱う）
+	static constexpr uint32_t kNamedLayerCount = static_cast<uint32_t>(CollisionTypeIdDef::kBossBullet) + 1;
+
+public: /// ---------- メンバ関数 ---------- ///
+
+	// コンストラクタ（判定関数が登録された組だけを許可した既定値）
+	CollisionLayerMatrix();
+
+	// 判定関数が登録された組だけを許可した状態に戻す
+	void ResetToDefault();
+
+	// 組の許可を切り替える（対称に設定する）
+	void SetCollision(uint32_t layerA, uint32_t layerB, bool isEnabled);
+	void SetCollision(CollisionTypeIdDef layerA, CollisionTypeIdDef layerB, bool isEnabled) { SetCollision(static_cast<uint32_t>(layerA), static_cast<uint32_t>(layerB), isEnabled); }
+
+	// 行をまとめて設定（両方の行で許可されている組だけ許可。そろえた結果が変わったときだけ判定の向きを作り直す）
+	void SetMasks(const std::array<uint32_t, kMaxLayers>& masks);
+
+	// 2つの型が衝突するか
+	bool CanCollide(uint32_t layerA, uint32_t layerB) const { return layerA < kMaxLayers && layerB < kMaxLayers && (masks_[layerA] & (1u << layerB)); }
+
+	// レイヤー名（名前のないレイヤーは nullptr）
+	static const char* GetLayerName(uint32_t layer);
+
+public: /// ---------- ゲッター ---------- ///
+
+	// 衝突する相手の型のマスク（対称）
+	uint32_t GetMask(uint32_t layer) const { return masks_[layer]; }
+	const std::array<uint32_t, kMaxLayers>& GetMasks() const { return masks_; }
+
+	// 判定する向きだけに絞ったマスク（各組はどちらか一方の行にだけ入る。判定関数のない組は入らない）
+	uint32_t GetCheckMask(uint32_t layer) const { return checkMasks_[layer]; }
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	// 対称にそろえて判定の向きを作り直す
+	void Rebuild();
+
+	// 片方の行でしか許可されていない組を両方の行から外す
+	static void Symmetrize(std::array<uint32_t, kMaxLayers>& masks);
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	std::array<uint32_t, kMaxLayers> masks_{};
+	std::array<uint32_t, kMaxLayers> checkMasks_{};
+};
@@ -1,35 +1,24 @@
+#define NOMINMAX
 #include "CollisionManager.h"
-#include "ParameterManager.h"
 #include "Collider.h"
+#include "JobSystem.h"
 #include <CollisionUtility.h>
 #include <CollisionTypeIdDef.h>
 
-
-/// -------------------------------------------------------------
-///				　			　初期化処理
-///	-------------------------------------------------------------
-void CollisionManager::Initialize()
-{
-	isCollider_ = true;
-	ParameterManager::GetInstance()->CreateGroup("Collider");
-	ParameterManager::GetInstance()->AddItem("Collider", "isCollider", isCollider_);
-
-	RegisterCollisionFuncsions();
-}
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <iterator>
+#include <random>
 
 
 /// -------------------------------------------------------------
-///				　			　更新処理
+///				　			デストラクタ
 /// -------------------------------------------------------------
-void CollisionManager::Update()
+CollisionManager::~CollisionManager()
 {
-	isCollider_ = ParameterManager::GetInstance()->GetValue<bool>("Collider", "isCollider");
-
-	// 非表示なら抜ける
-	if (!isCollider_) return;
-
-	// 更新処理
-	for (Collider* collider : all_) collider->Update();
+	// 後から破棄されるコライダーが消えたマネージャーを触らないようにする
+	Reset();
 }
 
 
@@ -42,8 +31,8 @@ void CollisionManager::Draw()
 	if (!isCollider_) return;
 
 	// 描画処理
-	for (Collider* collider : all_)
-		if (isCollider_) collider->Draw();
+	for (Collider* collider : colliders_)
+		if (collider) collider->Draw();
 }
 
 
@@ -52,8 +41,24 @@ void CollisionManager::Draw()
 /// -------------------------------------------------------------
 void CollisionManager::Reset()
 {
-	all_.clear();
-	for (auto& v : buckets_) v.clear(); // ★ 追加：型ごとのバケットも空にする
+	// 登録情報を切り離す
+	for (Collider* collider : colliders_)
+	{
+		if (!collider) continue;
+		collider->collisionManager_ = nullptr;
+		collider->collisionHandle_ = {};
+		collider->isShapeDirty_ = false;
+	}
+
+	colliders_.Clear();
+	pendingRemovals_.clear();
+	dirtyHandles_.clear();
+	shapes_.Clear();
+
+	tree_.Clear();
+	slotProxyIds_.clear();
+	proxyCenters_.clear();
+	proxySlots_.clear();
 }
 
 
@@ -62,154 +67,756 @@ void CollisionManager::Reset()
 /// -------------------------------------------------------------
 void CollisionManager::CheckAllCollisions()
 {
-	using CId = uint32_t;
-	const CId kPlayer = static_cast<CId>(CollisionTypeIdDef::kPlayer);
-	const CId kEnemy = static_cast<CId>(CollisionTypeIdDef::kEnemy);
-	const CId kBoss = static_cast<CId>(CollisionTypeIdDef::kBoss);
-	const CId kBullet = static_cast<CId>(CollisionTypeIdDef::kBullet);
-	const CId kBossBullet = static_cast<CId>(CollisionTypeIdDef::kBossBullet);
-	const CId kItem = static_cast<CId>(CollisionTypeIdDef::kItem);
-
-	auto pairLoop = [&](CId aId, CId bId) {
-		auto& A = buckets_[aId];
-		auto& B = buckets_[bId];
-		if (A.empty() || B.empty()) return;
-		for (Collider* a : A) for (Collider* b : B) {
-			CheckCollisionPair(a, b);
-		}
-		};
+	using Clock = std::chrono::steady_clock;
+	auto startTime = Clock::now();
+
+	// 登録解除されたスロットを詰め、動いたものだけ形状を読み直す（以降の判定はこのバッファだけを読む）
+	ApplyRemovals();
+	ApplyDirty();
+
+	// 方式の切り替えとグリッドの構築
+	UpdateBroadphase();
 
-	// ★ 片方向だけにする（OnCollisionはCheckCollisionPair内で両者に通知済み）
-	pairLoop(kBoss, kPlayer);
-	pairLoop(kEnemy, kPlayer);
-	pairLoop(kBullet, kEnemy);
-	pairLoop(kBoss, kBullet);
-	pairLoop(kPlayer, kBossBullet);
-	pairLoop(kPlayer, kItem);
+	// 応答処理で状態が変わる前に総当たりと突き合わせる（計測からは除く）
+	if (isVerifyBroadphase_)
+	{
+		const auto verifyStart = Clock::now();
+		VerifyBroadphase();
+		startTime += Clock::now() - verifyStart;
+	}
+
+	// 判定はワーカーで並列に行い、応答処理はメインスレッドでまとめて呼ぶ
+	CollectContacts();
+	DispatchContacts();
+
+	checkMilliseconds_ = std::chrono::duration<float, std::milli>(Clock::now() - startTime).count();
+
+	// レイのベンチマーク（判定の計測には含めない）
+	if (isRaycastBenchmark_) RunRaycastBenchmark();
 }
 
+
+
+/// -------------------------------------------------------------
+///				　			コライダーの登録
+/// -------------------------------------------------------------
 void CollisionManager::AddCollider(Collider* other)
 {
-	all_.push_back(other);
-	const uint32_t id = other->GetTypeID();
-	if (id < kMaxTypes) buckets_[id].push_back(other);
+	if (!other || other->collisionManager_ == this) return;
+
+	// 別のマネージャーに登録されていたら移す
+	if (other->collisionManager_) other->collisionManager_->RemoveCollider(other);
+
+	// スロットマップの詰めた位置と形状プロキシのスロットは常に同じ並び
+	other->collisionHandle_ = colliders_.Insert(other);
+	shapes_.AddSlot(*other);
+	slotProxyIds_.push_back(DynamicAABBTree::kNullNode);
+	proxyCenters_.push_back({});
+
+	other->collisionManager_ = this;
+
+	// 形状は次の判定で読み込む
+	MarkDirty(other);
 }
 
+
+/// -------------------------------------------------------------
+///				　		コライダーの登録解除
+/// -------------------------------------------------------------
 void CollisionManager::RemoveCollider(Collider* other)
 {
-	// all から削除
-	all_.erase(std::remove(all_.begin(), all_.end(), other), all_.end());
+	if (!other || other->collisionManager_ != this) return;
+
+	// 応答処理の途中でも呼ばれるので、ここではスロットを空けるだけにして並びは変えない
+	const SlotHandle handle = other->collisionHandle_;
+	const uint32_t slot = colliders_.IndexOf(handle);
+	colliders_[slot] = nullptr;
+	shapes_.DisableSlot(slot);
+	pendingRemovals_.push_back(handle);
+
+	other->collisionManager_ = nullptr;
+	other->collisionHandle_ = {};
+	other->isShapeDirty_ = false;
+}
+
+
+/// -------------------------------------------------------------
+///				　	ハンドルからコライダーを取得
+/// -------------------------------------------------------------
+Collider* CollisionManager::GetCollider(SlotHandle handle) const
+{
+	// 古いハンドルと削除待ちはどちらも nullptr になる
+	Collider* const* collider = colliders_.Get(handle);
+	return collider ? *collider : nullptr;
+}
+
+
+/// -------------------------------------------------------------
+///				　		形状の更新を受け取る
+/// -------------------------------------------------------------
+void CollisionManager::MarkDirty(Collider* collider)
+{
+	collider->isShapeDirty_ = true;
+	dirtyHandles_.push_back(collider->collisionHandle_);
+}
+
+
+/// -------------------------------------------------------------
+///				　	削除待ちのスロットを詰める
+/// -------------------------------------------------------------
+void CollisionManager::ApplyRemovals()
+{
+	if (pendingRemovals_.empty()) return;
+
+	// ハンドルは入れ替えで変わらないので、その時点の位置を引き直しながら順に詰める
+	for (SlotHandle handle : pendingRemovals_)
+	{
+		const uint32_t slot = colliders_.IndexOf(handle);
+		const uint32_t last = colliders_.GetCount() - 1;
+
+		if (slotProxyIds_[slot] != DynamicAABBTree::kNullNode) tree_.DestroyProxy(slotProxyIds_[slot]);
+
+		// スロットマップと同じく末尾を空いた位置に移す
+		if (slot != last)
+		{
+			slotProxyIds_[slot] = slotProxyIds_[last];
+			proxyCenters_[slot] = proxyCenters_[last];
+			if (slotProxyIds_[slot] != DynamicAABBTree::kNullNode) proxySlots_[slotProxyIds_[slot]] = slot;
+		}
+
+		colliders_.Erase(handle);
+		slotProxyIds_.pop_back();
+		proxyCenters_.pop_back();
+		shapes_.RemoveSlot(slot);
+	}
+
+	pendingRemovals_.clear();
+}
+
+
+/// -------------------------------------------------------------
+///				　	形状が変わったスロットだけ読み直す
+/// -------------------------------------------------------------
+void CollisionManager::ApplyDirty()
+{
+	updatedSlotCount_ = 0;
 
-	// バケットから削除
-	const uint32_t id = other->GetTypeID();
-	if (id < kMaxTypes)
+	for (SlotHandle handle : dirtyHandles_)
 	{
-		auto& v = buckets_[id];
-		v.erase(std::remove(v.begin(), v.end(), other), v.end());
+		const uint32_t slot = colliders_.IndexOf(handle);
+		if (slot == SlotMap<Collider*>::kInvalidIndex) continue;
+
+		Collider* collider = colliders_[slot];
+		shapes_.UpdateSlot(slot, *collider);
+		if (broadphaseMode_ == BroadphaseMode::kTree && builtBroadphaseMode_ == BroadphaseMode::kTree) UpdateTreeProxy(slot);
+
+		collider->isShapeDirty_ = false;
+		++updatedSlotCount_;
+	}
+
+	dirtyHandles_.clear();
+}
+
+
+/// -------------------------------------------------------------
+///				　	ツリーのプロキシを作成・移動
+/// -------------------------------------------------------------
+void CollisionManager::UpdateTreeProxy(uint32_t slot)
+{
+	const AABB& bounds = shapes_.GetBounds(slot);
+	const Vector3 center = (bounds.min + bounds.max) * 0.5f;
+
+	int32_t& proxyId = slotProxyIds_[slot];
+	if (proxyId == DynamicAABBTree::kNullNode)
+	{
+		proxyId = tree_.CreateProxy(bounds, nullptr);
+		if (proxySlots_.size() <= static_cast<size_t>(proxyId)) proxySlots_.resize(proxyId + 1);
+	}
+	else
+	{
+		// 太いAABBからはみ出したときだけ再挿入される
+		tree_.MoveProxy(proxyId, bounds, center - proxyCenters_[slot]);
+	}
+
+	proxySlots_[proxyId] = slot;
+	proxyCenters_[slot] = center;
+}
+
+
+/// -------------------------------------------------------------
+///				　	当たった組を並列に集める
+/// -------------------------------------------------------------
+void CollisionManager::CollectContacts()
+{
+	// 登録されている型のマスク
+	uint32_t presentTypes = 0;
+	for (uint32_t type = 0; type < kMaxTypes; ++type)
+	{
+		if (!shapes_.GetSlotsOfType(type).empty()) presentTypes |= 1u << type;
+	}
+
+	// ★ 各組は衝突マトリクスで決めた片方の行からだけ調べる（OnCollisionはDispatchContactsで両者に通知する）
+	workItems_.clear();
+	for (uint32_t typeA = 0; typeA < kMaxTypes; ++typeA)
+	{
+		const uint32_t typeMask = layerMatrix_.GetCheckMask(typeA) & presentTypes;
+		if (typeMask == 0) continue;
+
+		for (uint32_t a : shapes_.GetSlotsOfType(typeA)) workItems_.push_back({ a, typeMask });
+	}
+
+	// 並列にしないときは全体を1チャンクにする（同じ経路で比較できるように）
+	const size_t grain = isParallelNarrowphase_ ? kNarrowphaseGrain : std::max<size_t>(workItems_.size(), 1);
+	const size_t chunkCount = (workItems_.size() + grain - 1) / grain;
+	if (contactBuffers_.size() < chunkCount) contactBuffers_.resize(chunkCount);
+	for (size_t c = 0; c < chunkCount; ++c)
+	{
+		contactBuffers_[c].contacts.clear();
+		contactBuffers_[c].candidateCount = 0;
+	}
+
+	// チャンク番号 = begin / grain なので書き込み先が重ならない
+	JobSystem::GetInstance()->ParallelFor(workItems_.size(), grain, [this, grain](size_t begin, size_t end) {
+		ContactBuffer& buffer = contactBuffers_[begin / grain];
+
+		for (size_t i = begin; i < end; ++i)
+		{
+			const uint32_t a = workItems_[i].slotA;
+			const uint32_t typeA = shapes_.GetTypeID(a);
+			const uint32_t typeMask = workItems_[i].typeMask;
+
+			// 候補を相手の型ごとに kShapeBatchWidth 個ずつまとめて判定する
+			uint32_t pending[kMaxTypes][kShapeBatchWidth];
+			uint32_t pendingCounts[kMaxTypes];
+			for (uint32_t mask = typeMask; mask != 0; mask &= mask - 1) pendingCounts[std::countr_zero(mask)] = 0;
+
+			auto flush = [&](uint32_t typeB) {
+				// マスクを通った組には必ず判定関数がある
+				const CollisionDispatch::BatchFunc batch = CollisionDispatch::kTable[typeA][typeB].batch;
+				const uint32_t hits = batch(shapes_, a, pending[typeB], pendingCounts[typeB]);
+				for (uint32_t n = 0; n < pendingCounts[typeB]; ++n)
+				{
+					if (!(hits & (1u << n))) continue;
+					const uint32_t b = pending[typeB][n];
+					buffer.contacts.push_back({ shapes_.GetUniqueID(a), shapes_.GetUniqueID(b), a, b });
+				}
+				pendingCounts[typeB] = 0;
+				};
+
+			// ブロードフェーズで重なっていて、マスクを通ったものだけを判定する
+			ForEachCandidate(a, typeMask, [&](uint32_t b) {
+				const uint32_t typeB = shapes_.GetTypeID(b);
+
+				// 同じ型同士は番号の小さい方からだけ調べる
+				if (typeB == typeA && b <= a) return;
+				++buffer.candidateCount;
+
+				pending[typeB][pendingCounts[typeB]++] = b;
+				if (pendingCounts[typeB] == kShapeBatchWidth) flush(typeB);
+				});
+
+			for (uint32_t mask = typeMask; mask != 0; mask &= mask - 1)
+			{
+				const uint32_t typeB = std::countr_zero(mask);
+				if (pendingCounts[typeB] > 0) flush(typeB);
+			}
+		}
+		});
+
+	// マージ
+	contacts_.clear();
+	candidatePairCount_ = 0;
+	for (size_t c = 0; c < chunkCount; ++c)
+	{
+		contacts_.insert(contacts_.end(), contactBuffers_[c].contacts.begin(), contactBuffers_[c].contacts.end());
+		candidatePairCount_ += contactBuffers_[c].candidateCount;
 	}
+	hitPairCount_ = static_cast<uint32_t>(contacts_.size());
 }
 
 
 /// -------------------------------------------------------------
-///				コライダー２つの衝突判定と応答処理
+///				　	応答処理を決定的な順序で呼ぶ
 /// -------------------------------------------------------------
-void CollisionManager::CheckCollisionPair(Collider* colliderA, Collider* colliderB)
+void CollisionManager::DispatchContacts()
+{
+	// スレッド数やチャンク分割に関係なく (uniqueIdA, uniqueIdB) の順にする
+	std::sort(contacts_.begin(), contacts_.end(), [](const Contact& lhs, const Contact& rhs) {
+		if (lhs.uniqueIdA != rhs.uniqueIdA) return lhs.uniqueIdA < rhs.uniqueIdA;
+		if (lhs.uniqueIdB != rhs.uniqueIdB) return lhs.uniqueIdB < rhs.uniqueIdB;
+		if (lhs.slotA != rhs.slotA) return lhs.slotA < rhs.slotA;
+		return lhs.slotB < rhs.slotB;
+		});
+
+	for (const Contact& contact : contacts_)
+	{
+		// 先の応答処理で登録が解除されたものには通知しない
+		Collider* colliderA = colliders_[contact.slotA];
+		Collider* colliderB = colliders_[contact.slotB];
+		if (!colliderA || !colliderB) continue;
+
+		colliderA->OnCollision(colliderB);
+		colliderB->OnCollision(colliderA);
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				登録された判定関数だけを実行
+/// -------------------------------------------------------------
+bool CollisionManager::TestCollisionPair(uint32_t slotA, uint32_t slotB) const
 {
 	// 自分同士は無視
-	if (colliderA == colliderB) return;
+	if (slotA == slotB) return false;
+
+	// 登録されていない型は無視
+	const CollisionFunc func = CollisionDispatch::Find(shapes_.GetTypeID(slotA), shapes_.GetTypeID(slotB));
+	if (!func) return false;
+
+	return func(shapes_, slotA, slotB);
+}
 
-	auto key = std::make_pair(colliderA->GetTypeID(), colliderB->GetTypeID());
-	auto it = collisionTable_.find(key);
 
-	if (it != collisionTable_.end())
+/// -------------------------------------------------------------
+///				　		ブロードフェーズの更新
+/// -------------------------------------------------------------
+void CollisionManager::UpdateBroadphase()
+{
+	// 方式が切り替わったらツリーを作り直す（動いたものは ApplyDirty で更新済み）
+	if (broadphaseMode_ != builtBroadphaseMode_)
 	{
-		if (!it->second(colliderA, colliderB))
+		tree_.Clear();
+		std::fill(slotProxyIds_.begin(), slotProxyIds_.end(), DynamicAABBTree::kNullNode);
+
+		if (broadphaseMode_ == BroadphaseMode::kTree)
 		{
-			return; // 衝突していない
+			for (uint32_t slot = 0; slot < shapes_.GetCount(); ++slot) UpdateTreeProxy(slot);
 		}
 	}
-	else
+
+	// クエリはこのとき構築した方式を使う（次の判定までに方式が切り替わっても古い構造は読まない）
+	builtBroadphaseMode_ = broadphaseMode_;
+
+	// グリッドはセルサイズを大きさの中央値に合わせるので毎回構築し直す（配列を1回なめるだけ）
+	if (broadphaseMode_ == BroadphaseMode::kGrid) grid_.Build(shapes_.GetBoundsArray());
+}
+
+
+/// -------------------------------------------------------------
+///				ブロードフェーズから判定候補を列挙
+/// -------------------------------------------------------------
+template<typename Func>
+void CollisionManager::ForEachCandidate(uint32_t slotA, uint32_t typeMask, Func&& func) const
+{
+	switch (broadphaseMode_)
+	{
+	case BroadphaseMode::kTree:
 	{
-		return; // 登録されていない型は無視
+		const int32_t selfProxy = slotProxyIds_[slotA];
+		tree_.Query(tree_.GetFatAABB(selfProxy), [&](int32_t proxyId) {
+			if (proxyId == selfProxy) return true;
+
+			// 衝突しない型はマスクのANDだけで落とす
+			const uint32_t slotB = proxySlots_[proxyId];
+			if (!(typeMask & (1u << shapes_.GetTypeID(slotB)))) return true;
+
+			func(slotB);
+			return true;
+			});
+		break;
 	}
 
-	colliderA->OnCollision(colliderB);
-	colliderB->OnCollision(colliderA);
+	case BroadphaseMode::kGrid:
+	{
+		grid_.Query(shapes_.GetBounds(slotA), [&](uint32_t slotB) {
+			if (slotB == slotA || !(typeMask & (1u << shapes_.GetTypeID(slotB)))) return true;
+
+			func(slotB);
+			return true;
+			});
+		break;
+	}
+
+	default:
+	{
+		// 総当たり（マスクに入っている型の一覧だけをなめる）
+		for (uint32_t mask = typeMask; mask != 0; mask &= mask - 1)
+		{
+			for (uint32_t slotB : shapes_.GetSlotsOfType(std::countr_zero(mask)))
+			{
+				if (slotB != slotA) func(slotB);
+			}
+		}
+		break;
+	}
+	}
 }
 
 
 /// -------------------------------------------------------------
-///				コライダーの衝突判定関数の登録
+///			総当たりとブロードフェーズの結果が一致するかを確認
 /// -------------------------------------------------------------
-void CollisionManager::RegisterCollisionFuncsions()
+void CollisionManager::VerifyBroadphase()
 {
-	using CollisionType = uint32_t;
-	constexpr CollisionType kPlayer = static_cast<CollisionType>(CollisionTypeIdDef::kPlayer);
-	constexpr CollisionType kEnemy = static_cast<CollisionType>(CollisionTypeIdDef::kEnemy);
-	constexpr CollisionType kBullet = static_cast<CollisionType>(CollisionTypeIdDef::kBullet);
-	constexpr CollisionType kEnemyBullet = static_cast<CollisionType>(CollisionTypeIdDef::kEnemyBullet);
-	constexpr CollisionType kItem = static_cast<CollisionType>(CollisionTypeIdDef::kItem);
-	constexpr CollisionType kBoss = static_cast<CollisionType>(CollisionTypeIdDef::kBoss);
-	constexpr CollisionType kBossBullet = static_cast<CollisionType>(CollisionTypeIdDef::kBossBullet);
+	// 当たった組を (uniqueIdA, uniqueIdB) で集めて並べ、数ではなく組そのものを突き合わせる
+	std::vector<uint64_t> bruteForcePairs;
+	std::vector<uint64_t> broadphasePairs;
+	auto pairKey = [this](uint32_t a, uint32_t b) { return (static_cast<uint64_t>(shapes_.GetUniqueID(a)) << 32) | shapes_.GetUniqueID(b); };
 
-	/// ---------- プレイヤーとボスの衝突判定 ---------- ///
-	collisionTable_[{kBoss, kPlayer}] =
-		[](Collider* a, Collider* b) {
-		return CollisionUtility::IsCollision(a->GetCapsule(), b->GetSphere());
-		};
+	for (uint32_t typeA = 0; typeA < kMaxTypes; ++typeA)
+	{
+		const uint32_t typeMask = layerMatrix_.GetCheckMask(typeA);
+		if (typeMask == 0) continue;
 
-	collisionTable_[{kPlayer, kBoss}] =
-		[](Collider* a, Collider* b) {
-		return CollisionUtility::IsCollision(b->GetCapsule(), a->GetSphere());
-		};
+		// 同じ型同士は番号の小さい方からだけ数える（CollectContacts と同じ）
+		auto test = [&](uint32_t a, uint32_t b) {
+			if (shapes_.GetTypeID(b) == typeA && b <= a) return false;
+			return TestCollisionPair(a, b);
+			};
 
-	/// ---------- プレイヤーと敵の衝突判定 ---------- ///
-	collisionTable_[{kEnemy, kPlayer}] =
-		[](Collider* a, Collider* b) {
-		return CollisionUtility::IsCollision(a->GetCapsule(), b->GetSphere());
-		};
+		for (uint32_t a : shapes_.GetSlotsOfType(typeA))
+		{
+			for (uint32_t mask = typeMask; mask != 0; mask &= mask - 1)
+			{
+				for (uint32_t b : shapes_.GetSlotsOfType(std::countr_zero(mask))) if (test(a, b)) bruteForcePairs.push_back(pairKey(a, b));
+			}
+			ForEachCandidate(a, typeMask, [&](uint32_t b) { if (test(a, b)) broadphasePairs.push_back(pairKey(a, b)); });
+		}
+	}
 
-	collisionTable_[{kBullet, kEnemy}] =
-		[](Collider* a, Collider* b) {
-		if (b->HasCapsule())       return CollisionUtility::IsCollision(a->GetSegment(), b->GetCapsule());
-		else                       return CollisionUtility::IsCollision(a->GetSegment(), b->GetOBB());
-		};
+	// 片方にしかない組（取りこぼし・重複・余計な組）を数える
+	std::sort(bruteForcePairs.begin(), bruteForcePairs.end());
+	std::sort(broadphasePairs.begin(), broadphasePairs.end());
+	std::vector<uint64_t> difference;
+	std::set_symmetric_difference(bruteForcePairs.begin(), bruteForcePairs.end(), broadphasePairs.begin(), broadphasePairs.end(), std::back_inserter(difference));
 
+	verifyMismatchCount_ = static_cast<uint32_t>(difference.size());
+}
 
-	/// ---------- ボスとプレイヤーの弾丸の衝突判定 ---------- ///
-	collisionTable_[{kBoss, kBullet}] =
-		[](Collider* a, Collider* b) {
-		if (a->HasCapsule())       return CollisionUtility::IsCollision(a->GetCapsule(), b->GetSegment());
-		else                       return CollisionUtility::IsCollision(a->GetOBB(), b->GetSegment());
-		};
 
-	collisionTable_[{kBullet, kBoss}] =
-		[](Collider* a, Collider* b) {
-		if (b->HasCapsule())       return CollisionUtility::IsCollision(a->GetSegment(), b->GetCapsule());
-		else                       return CollisionUtility::IsCollision(a->GetSegment(), b->GetOBB());
-		};
+/// -------------------------------------------------------------
+///				　	レイに最初に当たるコライダー
+/// -------------------------------------------------------------
+bool CollisionManager::RaycastClosest(const Vector3& origin, const Vector3& direction, float maxDistance, uint32_t typeMask, RaycastHit& outHit, const Collider* ignore) const
+{
+	const float length = Vector3::Length(direction);
+	if (length < 1e-6f || maxDistance <= 0.0f) return false;
 
-	/// ---------- プレイヤーとボスの弾丸の衝突判定 ---------- ///
+	// 長さ maxDistance の線分にして t ∈ [0,1] で扱う
+	const Segment segment{ origin, direction * (maxDistance / length) };
 
-	collisionTable_[{kPlayer, kBossBullet}] =
-		[](Collider* a, Collider* b) {
-		return CollisionUtility::IsCollision(a->GetCapsule(), b->GetSegment());
-		};
+	bool found = false;
+	uint32_t bestSlot = 0;
+	float bestT = 1.0f;
+
+	ForEachRayCandidate(segment, typeMask, [&](uint32_t slot, float maxT) {
+		if (colliders_[slot] == ignore) return maxT;
+
+		float t = 0.0f;
+		if (!RaycastSlot(slot, segment, maxT, t)) return maxT;
+
+		// 同じ距離ならIDの小さい方（ブロードフェーズの方式によらず同じ結果にする）
+		if (!found || t < bestT || (t == bestT && shapes_.GetUniqueID(slot) < shapes_.GetUniqueID(bestSlot)))
+		{
+			found = true;
+			bestT = t;
+			bestSlot = slot;
+		}
+
+		// これより遠いものは調べなくてよい
+		return bestT;
+		});
+
+	if (!found) return false;
+
+	outHit.collider = colliders_[bestSlot];
+	outHit.handle = colliders_.GetHandle(bestSlot);
+	outHit.uniqueId = shapes_.GetUniqueID(bestSlot);
+	outHit.typeId = shapes_.GetTypeID(bestSlot);
+	outHit.distance = bestT * maxDistance;
+	outHit.point = segment.origin + segment.diff * bestT;
+	return true;
+}
+
+
+/// -------------------------------------------------------------
+///				　	レイに当たるコライダーを近い順に
+/// -------------------------------------------------------------
+uint32_t CollisionManager::RaycastAll(const Vector3& origin, const Vector3& direction, float maxDistance, uint32_t typeMask, RaycastHit* outHits, uint32_t maxHits, const Collider* ignore) const
+{
+	const float length = Vector3::Length(direction);
+	if (length < 1e-6f || maxDistance <= 0.0f || maxHits == 0) return 0;
+
+	const Segment segment{ origin, direction * (maxDistance / length) };
+	uint32_t count = 0;
+
+	ForEachRayCandidate(segment, typeMask, [&](uint32_t slot, float maxT) {
+		Collider* collider = colliders_[slot];
+		if (collider == ignore) return maxT;
+
+		// グリッドでは同じ要素が重複して報告されるので書き込み済みなら飛ばす
+		for (uint32_t i = 0; i < count; ++i) if (outHits[i].collider == collider) return maxT;
+
+		float t = 0.0f;
+		if (!RaycastSlot(slot, segment, maxT, t)) return maxT;
+
+		// 距離順（同じ距離ならID順）に挿入位置を探す
+		const float distance = t * maxDistance;
+		const uint32_t uniqueId = shapes_.GetUniqueID(slot);
+		uint32_t pos = count;
+		while (pos > 0 && (outHits[pos - 1].distance > distance || (outHits[pos - 1].distance == distance && outHits[pos - 1].uniqueId > uniqueId))) --pos;
+		if (pos >= maxHits) return maxT;
+
+		// 満杯なら一番遠いものを押し出す
+		const uint32_t last = std::min(count, maxHits - 1);
+		for (uint32_t i = last; i > pos; --i) outHits[i] = outHits[i - 1];
+		outHits[pos] = { collider, colliders_.GetHandle(slot), uniqueId, shapes_.GetTypeID(slot), distance, segment.origin + segment.diff * t };
+		if (count < maxHits) ++count;
+
+		// 満杯になったら一番遠い当たりより先は調べなくてよい
+		return (count == maxHits) ? outHits[count - 1].distance / maxDistance : maxT;
+		});
+
+	return count;
+}
+
+
+/// -------------------------------------------------------------
+///				　		球と重なるコライダー
+/// -------------------------------------------------------------
+uint32_t CollisionManager::OverlapSphere(const Sphere& sphere, uint32_t typeMask, Collider** outColliders, uint32_t maxCount) const
+{
+	if (maxCount == 0) return 0;
 
-	collisionTable_[{kBossBullet, kPlayer}] =
-		[](Collider* a, Collider* b) {
-		return CollisionUtility::IsCollision(b->GetCapsule(), a->GetSegment());
+	const Vector3 r = { sphere.radius, sphere.radius, sphere.radius };
+	const AABB aabb = { sphere.center - r, sphere.center + r };
+
+	// OBBとは長さ0のカプセルとして調べる（size を半サイズとして扱う判定に揃える）
+	const Capsule point = { { sphere.center, sphere.center }, sphere.radius };
+
+	uint32_t count = 0;
+	ForEachOverlapCandidate(aabb, typeMask, [&](uint32_t slot) {
+		bool hit = false;
+		if (shapes_.HasOBB(slot)) hit = CollisionUtility::IsCollision(point, shapes_.GetOBB(slot));
+		if (!hit && shapes_.HasSphere(slot)) hit = CollisionUtility::IsCollision(sphere, shapes_.GetSphere(slot));
+		if (!hit && shapes_.HasCapsule(slot) && CollisionUtility::IsCollision(shapes_.GetCapsule(slot), sphere))
+		{
+			// 複合コライダーは外形に入ったときだけ子カプセルを調べる
+			hit = !shapes_.HasChildren(slot);
+			for (const Capsule& child : shapes_.GetChildCapsules(slot)) if (!hit) hit = CollisionUtility::IsCollision(child, sphere);
+		}
+		if (!hit && shapes_.HasSegment(slot))
+		{
+			// 線分を球の半径のカプセルにして中心点と調べる
+			const Segment& segment = shapes_.GetSegment(slot);
+			hit = CollisionUtility::IsCollision(Capsule{ { segment.origin, segment.origin + segment.diff }, sphere.radius }, Sphere{ sphere.center, 0.0f });
+		}
+
+		if (hit) outColliders[count++] = colliders_[slot];
+		return count < maxCount;
+		});
+
+	return count;
+}
+
+
+/// -------------------------------------------------------------
+///				　	カプセルと重なるコライダー
+/// -------------------------------------------------------------
+uint32_t CollisionManager::OverlapCapsule(const Capsule& capsule, uint32_t typeMask, Collider** outColliders, uint32_t maxCount) const
+{
+	if (maxCount == 0) return 0;
+
+	// segment.diff は終点として扱う
+	const Vector3& p0 = capsule.segment.origin;
+	const Vector3& p1 = capsule.segment.diff;
+	const Vector3 r = { capsule.radius, capsule.radius, capsule.radius };
+	const AABB aabb = {
+		Vector3{ std::min(p0.x, p1.x), std::min(p0.y, p1.y), std::min(p0.z, p1.z) } - r,
+		Vector3{ std::max(p0.x, p1.x), std::max(p0.y, p1.y), std::max(p0.z, p1.z) } + r };
+
+	uint32_t count = 0;
+	ForEachOverlapCandidate(aabb, typeMask, [&](uint32_t slot) {
+		bool hit = false;
+		if (shapes_.HasOBB(slot)) hit = CollisionUtility::IsCollision(capsule, shapes_.GetOBB(slot));
+		if (!hit && shapes_.HasSphere(slot)) hit = CollisionUtility::IsCollision(capsule, shapes_.GetSphere(slot));
+		if (!hit && shapes_.HasCapsule(slot) && CollisionUtility::IsCollision(capsule, shapes_.GetCapsule(slot)))
+		{
+			hit = !shapes_.HasChildren(slot);
+			for (const Capsule& child : shapes_.GetChildCapsules(slot)) if (!hit) hit = CollisionUtility::IsCollision(capsule, child);
+		}
+		if (!hit && shapes_.HasSegment(slot)) hit = CollisionUtility::IsCollision(capsule, shapes_.GetSegment(slot));
+
+		if (hit) outColliders[count++] = colliders_[slot];
+		return count < maxCount;
+		});
+
+	return count;
+}
+
+
+/// -------------------------------------------------------------
+///			ブロードフェーズから線分と交わりそうなスロットを列挙
+/// -------------------------------------------------------------
+template<typename Func>
+void CollisionManager::ForEachRayCandidate(const Segment& segment, uint32_t typeMask, Func&& func) const
+{
+	auto accept = [&](uint32_t slot) {
+		const uint32_t type = shapes_.GetTypeID(slot);
+		return type < kMaxTypes && (typeMask & (1u << type)) != 0;
 		};
 
-	/// ---------- プレイヤーとアイテムの衝突判定 ---------- ///
+	switch (builtBroadphaseMode_)
+	{
+	case BroadphaseMode::kTree:
+	{
+		tree_.RayCast(segment.origin, segment.diff, 1.0f, [&](int32_t proxyId, float maxT) {
+			const uint32_t slot = proxySlots_[proxyId];
+			return accept(slot) ? func(slot, maxT) : maxT;
+			});
+		break;
+	}
+
+	case BroadphaseMode::kGrid:
+	{
+		grid_.RayCast(segment.origin, segment.diff, 1.0f, [&](uint32_t slot, float maxT) {
+			return accept(slot) ? func(slot, maxT) : maxT;
+			});
+		break;
+	}
 
-	collisionTable_[{kPlayer, kItem}] =
-		[](Collider* a, Collider* b) {
-		return CollisionUtility::IsCollision(a->GetOBB(), b->GetOBB());
+	default:
+	{
+		// 総当たり（マスクに含まれる型だけを回る）
+		float maxT = 1.0f;
+		for (uint32_t type = 0; type < kMaxTypes; ++type)
+		{
+			if (!(typeMask & (1u << type))) continue;
+			for (uint32_t slot : shapes_.GetSlotsOfType(type))
+			{
+				maxT = func(slot, maxT);
+				if (maxT < 0.0f) return;
+			}
+		}
+		break;
+	}
+	}
+}
+
+
+/// -------------------------------------------------------------
+///			ブロードフェーズからAABBと重なるスロットを列挙
+/// -------------------------------------------------------------
+template<typename Func>
+void CollisionManager::ForEachOverlapCandidate(const AABB& aabb, uint32_t typeMask, Func&& func) const
+{
+	// 型と形状全体のAABBで絞ってから渡す（func が false で打ち切り）
+	auto visit = [&](uint32_t slot) {
+		const uint32_t type = shapes_.GetTypeID(slot);
+		if (type >= kMaxTypes || !(typeMask & (1u << type))) return true;
+		if (!DynamicAABBTree::Overlaps(shapes_.GetBounds(slot), aabb)) return true;
+		return func(slot);
 		};
 
-	collisionTable_[{kItem, kPlayer}] =
-		[](Collider* a, Collider* b) {
-		return CollisionUtility::IsCollision(a->GetOBB(), b->GetOBB());
+	switch (builtBroadphaseMode_)
+	{
+	case BroadphaseMode::kTree:
+	{
+		tree_.Query(aabb, [&](int32_t proxyId) {
+			return visit(proxySlots_[proxyId]);
+			});
+		break;
+	}
+
+	case BroadphaseMode::kGrid:
+	{
+		grid_.Query(aabb, visit);
+		break;
+	}
+
+	default:
+	{
+		for (uint32_t type = 0; type < kMaxTypes; ++type)
+		{
+			if (!(typeMask & (1u << type))) continue;
+			for (uint32_t slot : shapes_.GetSlotsOfType(type)) if (!visit(slot)) return;
+		}
+		break;
+	}
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　	スロットの形状に線分が入る t
+/// -------------------------------------------------------------
+bool CollisionManager::RaycastSlot(uint32_t slot, const Segment& segment, float maxT, float& t) const
+{
+	// 線分しか持たないもの（弾）はレイの対象にしない
+	if (!shapes_.HasOBB(slot) && !shapes_.HasSphere(slot) && !shapes_.HasCapsule(slot)) return false;
+
+	// 形状全体のAABBで先に弾く
+	float tBounds = 0.0f;
+	if (!CollisionUtility::IntersectSegmentAABB(segment, shapes_.GetBounds(slot), tBounds) || tBounds > maxT) return false;
+
+	float best = 2.0f;
+	float ts = 0.0f;
+	if (shapes_.HasOBB(slot) && CollisionUtility::IntersectSegmentOBB(segment, shapes_.GetOBB(slot), ts) && ts < best) best = ts;
+	if (shapes_.HasSphere(slot) && CollisionUtility::IntersectSegmentSphere(segment, shapes_.GetSphere(slot), ts) && ts < best) best = ts;
+	if (shapes_.HasCapsule(slot) && CollisionUtility::IntersectSegmentCapsule(segment, shapes_.GetCapsule(slot), ts) && ts < best)
+	{
+		// 複合コライダーは外形に入ったときだけ子カプセルで入る位置を求める
+		if (!shapes_.HasChildren(slot)) best = ts;
+		for (const Capsule& child : shapes_.GetChildCapsules(slot))
+		{
+			if (CollisionUtility::IntersectSegmentCapsule(segment, child, ts) && ts < best) best = ts;
+		}
+	}
+
+	if (best > maxT) return false;
+
+	t = best;
+	return true;
+}
+
+
+/// -------------------------------------------------------------
+///				　		レイのベンチマーク
+/// -------------------------------------------------------------
+void CollisionManager::RunRaycastBenchmark()
+{
+	raycastHitCount_ = 0;
+	raycastMilliseconds_ = 0.0f;
+	if (shapes_.GetCount() == 0) return;
+
+	// ワールド全体の範囲（毎フレーム同じ乱数列で撃つ）
+	AABB world = shapes_.GetBounds(0);
+	for (const AABB& bounds : shapes_.GetBoundsArray())
+	{
+		world.min = { std::min(world.min.x, bounds.min.x), std::min(world.min.y, bounds.min.y), std::min(world.min.z, bounds.min.z) };
+		world.max = { std::max(world.max.x, bounds.max.x), std::max(world.max.y, bounds.max.y), std::max(world.max.z, bounds.max.z) };
+	}
+
+	std::mt19937 random(12345u);
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+	auto randomPoint = [&]() {
+		return Vector3{
+			world.min.x + (world.max.x - world.min.x) * unit(random),
+			world.min.y + (world.max.y - world.min.y) * unit(random),
+			world.min.z + (world.max.z - world.min.z) * unit(random) };
 		};
+
+	const auto startTime = std::chrono::steady_clock::now();
+
+	for (uint32_t i = 0; i < kRaycastBenchmarkCount; ++i)
+	{
+		const Vector3 from = randomPoint();
+		const Vector3 to = randomPoint();
+		const Vector3 dir = to - from;
+
+		RaycastHit hit;
+		if (RaycastClosest(from, dir, Vector3::Length(dir), kAllTypes, hit)) ++raycastHitCount_;
+	}
+
+	raycastMilliseconds_ = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
 }
@@ -2,12 +2,24 @@
 #include <list>
 #include <vector>
 #include <array>
-#include <functional>
-#include <map>
 #include <memory>
 
 #include "Vector3.h"
 #include "OBB.h"
+#include "AABB.h"
+#include "Sphere.h"
+#include "Capsule.h"
+#include "Segment.h"
+#include "CollisionTypeIdDef.h"
+#include "DynamicAABBTree.h"
+#include "SpatialHashGrid.h"
+#include "CollisionDispatchTable.h"
+#include "CollisionLayerMatrix.h"
+#include "ShapeProxyBuffer.h"
+#include "SlotMap.h"
+#include "CollisionBenchmark.h"
+#include "StaticMeshBVH.h"
+#include "StaticCollisionWorld.h"
 
 
 /// ---------- 前方宣言 ---------- ///
@@ -19,8 +31,21 @@ class Collider;
 /// -------------------------------------------------------------
 class CollisionManager
 {
+public: /// ---------- 列挙型 ---------- ///
+
+	// ブロードフェーズの方式（ParameterManager の "Collider" グループで切り替え）
+	enum class BroadphaseMode : int32_t
+	{
+		kBruteForce, // 型ごとの総当たり
+		kTree,		 // 動的AABBツリー
+		kGrid,		 // 一様空間ハッシュグリッド
+	};
+
 public: /// ---------- メンバ関数 ---------- ///
 
+	// デストラクタ（登録中のコライダーを切り離す）
+	~CollisionManager();
+
 	// 初期化処理
 	void Initialize();
 
@@ -30,39 +55,228 @@ public: /// ---------- メンバ関数 ---------- ///
 	// 描画処理
 	void Draw();
 
-	// リセット処理
+	// ImGui描画処理（ブロードフェーズの統計）
+	void DrawImGui();
+
+	// リセット処理（登録をすべて解除）
 	void Reset();
 
 	// すべての当たり判定を確認する処理
 	void CheckAllCollisions();
 
-	// コライダーを追加
+	// コライダーを登録（一度だけ。登録済みなら何もしない）
 	void AddCollider(Collider* other);
 
-	// コライダーを削除
+	// コライダーの登録を解除（O(1)。スロットは次の判定の先頭で詰める）
 	void RemoveCollider(Collider* other);
 
-	// 衝突判定
-	using CollisionFunc = std::function<bool(Collider*, Collider*)>;
+	// ハンドルからコライダーを取得（登録が解除されていれば nullptr）
+	Collider* GetCollider(SlotHandle handle) const;
+
+	// 登録数
+	uint32_t GetColliderCount() const { return colliders_.GetCount(); }
+
+	// ブロードフェーズの方式を直接指定（ParameterManager を使わないマネージャー用。Update を呼ぶと上書きされる）
+	void SetBroadphaseMode(BroadphaseMode mode) { broadphaseMode_ = mode; }
+
+	// 直前の判定の統計
+	uint32_t GetCandidatePairCount() const { return candidatePairCount_; }
+	uint32_t GetHitPairCount() const { return hitPairCount_; }
+	float GetCheckMilliseconds() const { return checkMilliseconds_; }
+
+	// 総当たりとの突き合わせ（有効なら判定のたびに、片方にしかない組の数を記録する）
+	void SetVerifyBroadphase(bool isEnabled) { isVerifyBroadphase_ = isEnabled; }
+	uint32_t GetVerifyMismatchCount() const { return verifyMismatchCount_; }
+
+	// 衝突判定（型の組ごとの関数ポインタ）
+	using CollisionFunc = CollisionDispatch::Func;
+
+	// 型同士の衝突マトリクス（ParameterManager の "CollisionMatrix" グループから読み直すので、直接変えるのはそれを使わないマネージャー用）
+	CollisionLayerMatrix& GetLayerMatrix() { return layerMatrix_; }
+	const CollisionLayerMatrix& GetLayerMatrix() const { return layerMatrix_; }
+
+public: /// ---------- 空間クエリ ---------- ///
+
+	// レイの当たり情報（collider はこのフレームだけ使う。次のフレーム以降は handle から GetCollider で引き直す）
+	struct RaycastHit
+	{
+		Collider* collider = nullptr;
+		SlotHandle handle{}; // 次のフレーム以降も参照するときはこちらを持つ
+		uint32_t uniqueId = 0;
+		uint32_t typeId = 0;
+		float distance = 0.0f;
+		Vector3 point{};
+	};
+
+	// 型IDのビットマスク（1u << 型ID）
+	static constexpr uint32_t kAllTypes = ~0u;
+	static constexpr uint32_t ToTypeMask(CollisionTypeIdDef id) { return 1u << static_cast<uint32_t>(id); }
+
+	// 以下のクエリは直前の CheckAllCollisions で作った形状とブロードフェーズを読む（読み取りのみ）
+	// レイ（origin から direction 方向に maxDistance まで）に最初に当たるコライダー
+	bool RaycastClosest(const Vector3& origin, const Vector3& direction, float maxDistance, uint32_t typeMask, RaycastHit& outHit, const Collider* ignore = nullptr) const;
+
+	// レイに当たるコライダーを近い順に最大 maxHits 個書き込み、書き込んだ数を返す
+	uint32_t RaycastAll(const Vector3& origin, const Vector3& direction, float maxDistance, uint32_t typeMask, RaycastHit* outHits, uint32_t maxHits, const Collider* ignore = nullptr) const;
+
+	// 球・カプセルと重なるコライダーを最大 maxCount 個書き込み、書き込んだ数を返す
+	uint32_t OverlapSphere(const Sphere& sphere, uint32_t typeMask, Collider** outColliders, uint32_t maxCount) const;
+	uint32_t OverlapCapsule(const Capsule& capsule, uint32_t typeMask, Collider** outColliders, uint32_t maxCount) const;
+
+public: /// ---------- 静的メッシュ ---------- ///
+
+	// 地形などの動かないメッシュをワールド行列で変換してBVHを構築（読み込み時に一度だけ）
+	void BuildStaticMesh(const ModelData& modelData, const Matrix4x4& worldMatrix)
+	{
+		staticMesh_.Build(modelData, worldMatrix);
+		staticWorld_.SetStaticMesh(&staticMesh_);
+	}
+
+	// 静的メッシュ（クエリは読み取りのみなのでワーカーから呼んでもよい）
+	const StaticMeshBVH& GetStaticMesh() const { return staticMesh_; }
+
+	// キャラクター移動用の静的な形状（静的メッシュに床や箱を足して使う）
+	StaticCollisionWorld& GetStaticWorld() { return staticWorld_; }
 
 private: /// ---------- メンバ関数 ---------- ///
 
-	// コライダー2つの衝突判定と応答処理
-	void CheckCollisionPair(Collider* colliderA, Collider* colliderB);
+	// Collider から形状の更新を受け取る
+	friend class Collider;
+	void MarkDirty(Collider* collider);
+
+	// 削除待ちのスロットを末尾との入れ替えで詰める
+	void ApplyRemovals();
+
+	// 形状が変わったスロットだけ読み直し、ツリーのプロキシを動かす
+	void ApplyDirty();
+
+	// ツリーのプロキシを作成・移動
+	void UpdateTreeProxy(uint32_t slot);
+
+	// 判定する組をワーカーで並列に調べ、当たった組をチャンクごとのバッファに書く
+	void CollectContacts();
+
+	// 当たった組を決定的な順序に並べてメインスレッドで応答処理を呼ぶ
+	void DispatchContacts();
 
-	// 初期化関数
-	void RegisterCollisionFuncsions();
+	// 登録された判定関数だけを実行（応答処理は呼ばない）
+	bool TestCollisionPair(uint32_t slotA, uint32_t slotB) const;
+
+	// ブロードフェーズの更新（方式の切り替え・グリッド構築）
+	void UpdateBroadphase();
+
+	// ブロードフェーズから判定候補を列挙し、型が typeMask に入るものだけを処理（func(slotB)。読み取りのみでスレッド安全）
+	template <typename Func>
+	void ForEachCandidate(uint32_t slotA, uint32_t typeMask, Func&& func) const;
+
+	// 衝突マトリクスを ParameterManager から読み直す・書き戻す
+	void LoadLayerMatrix();
+	void SaveLayerMatrix(uint32_t layer);
+
+	// 衝突マトリクスの編集（ImGui）
+	void DrawLayerMatrixImGui();
+
+	// 総当たりとブロードフェーズの結果が一致するかを確認（デバッグ用）
+	void VerifyBroadphase();
+
+	// ブロードフェーズから線分と交わりそうなスロットを近そうな順に列挙（func(slot, maxT) は新しい maxT を返す）
+	template <typename Func>
+	void ForEachRayCandidate(const Segment& segment, uint32_t typeMask, Func&& func) const;
+
+	// ブロードフェーズからAABBと重なるスロットを列挙（func(slot)）
+	template <typename Func>
+	void ForEachOverlapCandidate(const AABB& aabb, uint32_t typeMask, Func&& func) const;
+
+	// スロットの形状に線分が最初に入る t（OBB・球・カプセルのうち最も早いもの。maxT より先と線分の形状は対象外）
+	bool RaycastSlot(uint32_t slot, const Segment& segment, float maxT, float& t) const;
+
+	// レイのベンチマーク（ワールド内のランダムなレイを kRaycastBenchmarkCount 本撃つ）
+	void RunRaycastBenchmark();
+
+private: /// ---------- 構造体 ---------- ///
+
+	// 当たった組（ID順に並べて応答処理の順序を固定する）
+	struct Contact
+	{
+		uint32_t uniqueIdA;
+		uint32_t uniqueIdB;
+		uint32_t slotA;
+		uint32_t slotB;
+	};
+
+	// チャンクごとの書き込み先（ワーカー同士で共有しない）
+	struct ContactBuffer
+	{
+		std::vector<Contact> contacts;
+		uint32_t candidateCount = 0;
+	};
+
+	// 判定の作業単位（slotA と、型が typeMask に入る全候補）
+	struct WorkItem
+	{
+		uint32_t slotA;
+		uint32_t typeMask;
+	};
 
 private: /// ---------- メンバ変数 ---------- ///
 
-	static const uint32_t kMaxTypes = 32; // コライダーの最大タイプ数
-	std::array<std::vector<Collider*>, kMaxTypes> buckets_; // 型ごとのバケット
-	std::vector<Collider*> all_; // デバッグ用
-	// 衝突判定関数の登録
-	std::map<std::pair<uint32_t, uint32_t>, CollisionFunc> collisionTable_;
+	// 1チャンクあたりの作業数
+	static constexpr size_t kNarrowphaseGrain = 32;
+
+	// ベンチマークで1フレームに撃つレイの本数
+	static constexpr uint32_t kRaycastBenchmarkCount = 10000;
+
+	static const uint32_t kMaxTypes = CollisionDispatch::kMaxTypes; // コライダーの最大タイプ数
+
+	// 登録されたコライダー（詰めた位置がスロット。削除待ちは nullptr）
+	SlotMap<Collider*> colliders_;
+	std::vector<SlotHandle> pendingRemovals_; // 削除待ち
+	std::vector<SlotHandle> dirtyHandles_;    // 形状の更新待ち（途中で外れたものは古いハンドルになって読み飛ばされる）
+
+	// 形状プロキシ（colliders_ と同じ並び。型ごとのスロット一覧も持つ）
+	ShapeProxyBuffer shapes_;
+
+	// 型同士の衝突マトリクス
+	CollisionLayerMatrix layerMatrix_;
+
+	// ブロードフェーズの方式（クエリは最後に構築した方式を使う）
+	BroadphaseMode broadphaseMode_ = BroadphaseMode::kTree;
+	BroadphaseMode builtBroadphaseMode_ = BroadphaseMode::kBruteForce;
+
+	// 動的AABBツリー
+	DynamicAABBTree tree_;
+	std::vector<int32_t> slotProxyIds_;  // スロット → プロキシID
+	std::vector<Vector3> proxyCenters_;  // スロット → 前回の中心（移動量の先読み用）
+	std::vector<uint32_t> proxySlots_;   // プロキシID → スロット
+
+	// 空間ハッシュグリッド（要素番号がそのままスロット）
+	SpatialHashGrid grid_;
+
+	// ナローフェーズ（作業一覧・チャンクごとのバッファ・マージ後の接触）
+	std::vector<WorkItem> workItems_;
+	std::vector<ContactBuffer> contactBuffers_;
+	std::vector<Contact> contacts_;
+	bool isParallelNarrowphase_ = true;
+
+	// 統計
+	uint32_t candidatePairCount_ = 0;
+	uint32_t hitPairCount_ = 0;
+	uint32_t verifyMismatchCount_ = 0;
+	uint32_t updatedSlotCount_ = 0;
+	float checkMilliseconds_ = 0.0f;
+	bool isVerifyBroadphase_ = false;
+
+	// レイのベンチマーク
+	bool isRaycastBenchmark_ = false;
+	float raycastMilliseconds_ = 0.0f;
+	uint32_t raycastHitCount_ = 0;
+
+	// 地形などの静的メッシュ
+	StaticMeshBVH staticMesh_;
+	StaticCollisionWorld staticWorld_;
 
-	// コライダーリスト
-	//std::list<Collider*> colliders_;
+	// ベンチマークと性質テスト（ImGui のボタンで実行）
+	CollisionBenchmark benchmark_;
 
 	// コライダーの可視化フラグ
 	bool isCollider_ = true;
@@ -0,0 +1,169 @@
+#define NOMINMAX
+#include "CollisionManager.h"
+#include "ParameterManager.h"
+#include "Collider.h"
+#include "JobSystem.h"
+#include <CollisionUtility.h>
+
+#include <algorithm>
+#include <imgui.h>
+
+// ParameterManager と ImGui につながる部分（判定の本体は CollisionManager.cpp）
+
+
+/// -------------------------------------------------------------
+///				　			　初期化処理
+///	-------------------------------------------------------------
+void CollisionManager::Initialize()
+{
+	isCollider_ = true;
+	ParameterManager::GetInstance()->CreateGroup("Collider");
+	ParameterManager::GetInstance()->AddItem("Collider", "isCollider", isCollider_);
+	ParameterManager::GetInstance()->AddItem("Collider", "verifyBroadphase", isVerifyBroadphase_);
+	ParameterManager::GetInstance()->AddItem("Collider", "broadphase", static_cast<int32_t>(broadphaseMode_));
+	ParameterManager::GetInstance()->AddItem("Collider", "parallelNarrowphase", isParallelNarrowphase_);
+	ParameterManager::GetInstance()->AddItem("Collider", "raycastBenchmark", isRaycastBenchmark_);
+
+	// 衝突マトリクス（型ごとに相手の型のビットマスク。既定はディスパッチテーブルに判定関数がある組）
+	ParameterManager::GetInstance()->CreateGroup("CollisionMatrix");
+	for (uint32_t layer = 0; layer < CollisionLayerMatrix::kNamedLayerCount; ++layer)
+	{
+		ParameterManager::GetInstance()->AddItem("CollisionMatrix", CollisionLayerMatrix::GetLayerName(layer), static_cast<int32_t>(layerMatrix_.GetMask(layer)));
+	}
+
+	Reset();
+}
+
+
+/// -------------------------------------------------------------
+///				　			　更新処理
+/// -------------------------------------------------------------
+void CollisionManager::Update()
+{
+	isCollider_ = ParameterManager::GetInstance()->GetValue<bool>("Collider", "isCollider");
+	isVerifyBroadphase_ = ParameterManager::GetInstance()->GetValue<bool>("Collider", "verifyBroadphase");
+	isParallelNarrowphase_ = ParameterManager::GetInstance()->GetValue<bool>("Collider", "parallelNarrowphase");
+	isRaycastBenchmark_ = ParameterManager::GetInstance()->GetValue<bool>("Collider", "raycastBenchmark");
+
+	// 0:総当たり 1:ツリー 2:グリッド
+	const int32_t mode = ParameterManager::GetInstance()->GetValue<int32_t>("Collider", "broadphase");
+	broadphaseMode_ = static_cast<BroadphaseMode>(std::clamp(mode, 0, 2));
+
+	// 衝突マトリクス
+	LoadLayerMatrix();
+
+	// 非表示なら抜ける
+	if (!isCollider_) return;
+
+	// 更新処理
+	for (Collider* collider : colliders_) if (collider) collider->Update();
+}
+
+
+/// -------------------------------------------------------------
+///				　			ImGui描画処理
+/// -------------------------------------------------------------
+void CollisionManager::DrawImGui()
+{
+	static const char* kModeNames[] = { "BruteForce", "Tree", "Grid" };
+
+	ImGui::Begin("Collision");
+	ImGui::Text("Broadphase : %s", kModeNames[static_cast<int32_t>(broadphaseMode_)]);
+	ImGui::Text("Colliders : %u (updated %u)", colliders_.GetCount(), updatedSlotCount_);
+	if (broadphaseMode_ == BroadphaseMode::kTree) ImGui::Text("Tree Proxies : %u (height %d)", tree_.GetProxyCount(), tree_.GetHeight());
+	if (broadphaseMode_ == BroadphaseMode::kGrid) ImGui::Text("Grid Cells : %u (size %.2f, oversized %u)", grid_.GetOccupiedCellCount(), grid_.GetCellSize(), grid_.GetOversizedCount());
+	ImGui::Text("Narrowphase : %s (%u workers, %s)", isParallelNarrowphase_ ? "Parallel" : "Serial", JobSystem::GetInstance()->GetWorkerCount(), CollisionUtility::GetBatchBackendName());
+	ImGui::Text("Pairs Tested : %u", candidatePairCount_);
+	ImGui::Text("Hit Pairs : %u", hitPairCount_);
+	ImGui::Text("Time : %.3f ms", checkMilliseconds_);
+	if (candidatePairCount_ > 0) ImGui::Text("Cost / Pair : %.1f ns", checkMilliseconds_ * 1.0e6f / static_cast<float>(candidatePairCount_));
+	if (isVerifyBroadphase_) ImGui::Text("Verify Mismatch : %u", verifyMismatchCount_);
+	if (!staticMesh_.IsEmpty()) ImGui::Text("Static Mesh : %u triangles (%u nodes, depth %u)", staticMesh_.GetTriangleCount(), staticMesh_.GetNodeCount(), staticMesh_.GetDepth());
+	if (isRaycastBenchmark_) ImGui::Text("Raycast x%u : %.3f ms (%u hits, %.1f ns / ray)", kRaycastBenchmarkCount, raycastMilliseconds_, raycastHitCount_, raycastMilliseconds_ * 1.0e6f / static_cast<float>(kRaycastBenchmarkCount));
+
+	// 衝突マトリクス
+	DrawLayerMatrixImGui();
+
+	// 形状の組ごとの計測・性質テスト・規模を変えたワールド全体の計測（結果はログにも出る）
+	ImGui::Separator();
+	if (ImGui::Button("Run Benchmark")) benchmark_.Run();
+	benchmark_.DrawImGui();
+	ImGui::End();
+}
+
+
+/// -------------------------------------------------------------
+///				　	衝突マトリクスの読み込み
+/// -------------------------------------------------------------
+void CollisionManager::LoadLayerMatrix()
+{
+	// JSON には int32_t で入っているので、ビット列としてそのまま戻す（名前のないレイヤーは今の値のまま）
+	std::array<uint32_t, CollisionLayerMatrix::kMaxLayers> masks = layerMatrix_.GetMasks();
+	for (uint32_t layer = 0; layer < CollisionLayerMatrix::kNamedLayerCount; ++layer)
+	{
+		masks[layer] = static_cast<uint32_t>(ParameterManager::GetInstance()->GetValue<int32_t>("CollisionMatrix", CollisionLayerMatrix::GetLayerName(layer)));
+	}
+
+	// 変わったときだけ判定の向きを作り直す
+	layerMatrix_.SetMasks(masks);
+
+	// 対称にそろえて値が変わった行は書き戻す（設定ファイルと実際の判定を一致させる）
+	for (uint32_t layer = 0; layer < CollisionLayerMatrix::kNamedLayerCount; ++layer)
+	{
+		if (masks[layer] != layerMatrix_.GetMask(layer)) SaveLayerMatrix(layer);
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　	衝突マトリクスの書き戻し
+/// -------------------------------------------------------------
+void CollisionManager::SaveLayerMatrix(uint32_t layer)
+{
+	const char* name = CollisionLayerMatrix::GetLayerName(layer);
+	if (!name) return;
+
+	ParameterManager::GetInstance()->SetValue("CollisionMatrix", name, static_cast<int32_t>(layerMatrix_.GetMask(layer)));
+}
+
+
+/// -------------------------------------------------------------
+///				　	衝突マトリクスの編集
+/// -------------------------------------------------------------
+void CollisionManager::DrawLayerMatrixImGui()
+{
+	if (!ImGui::CollapsingHeader("Layer Matrix")) return;
+
+	// 対称なので下三角だけ並べる（保存は Global Variables の CollisionMatrix から）
+	for (uint32_t a = 0; a < CollisionLayerMatrix::kNamedLayerCount; ++a)
+	{
+		for (uint32_t b = 0; b <= a; ++b)
+		{
+			bool isEnabled = layerMatrix_.CanCollide(a, b);
+
+			// 判定関数のない組は許可しても判定されない
+			const bool hasRule = CollisionDispatch::Find(a, b) != nullptr;
+			if (!hasRule) ImGui::PushStyleVar(ImGuiStyleVar_Alpha, 0.4f);
+
+			ImGui::PushID(static_cast<int>(a * CollisionLayerMatrix::kMaxLayers + b));
+			if (ImGui::Checkbox("##pair", &isEnabled))
+			{
+				layerMatrix_.SetCollision(a, b, isEnabled);
+				SaveLayerMatrix(a);
+				SaveLayerMatrix(b);
+			}
+			if (ImGui::IsItemHovered()) ImGui::SetTooltip("%s - %s%s", CollisionLayerMatrix::GetLayerName(a), CollisionLayerMatrix::GetLayerName(b), hasRule ? "" : " (no rule)");
+			ImGui::PopID();
+
+			if (!hasRule) ImGui::PopStyleVar();
+			ImGui::SameLine();
+		}
+		ImGui::Text("%s", CollisionLayerMatrix::GetLayerName(a));
+	}
+
+	if (ImGui::Button("Reset Layer Matrix"))
+	{
+		layerMatrix_.ResetToDefault();
+		for (uint32_t layer = 0; layer < CollisionLayerMatrix::kNamedLayerCount; ++layer) SaveLayerMatrix(layer);
+	}
+}
@@ -1,6 +1,8 @@
 #include "CollisionUtility.h"
 
 #include <algorithm>
+#include <cfloat>
+#include <cmath>
 
 bool CollisionUtility::IsCollision(const Sphere& s1, const Sphere& s2)
 {
@@ -169,63 +171,31 @@ bool CollisionUtility::IsCollision(const AABB& aabb, const Segment& segment)
 
 bool CollisionUtility::IsCollision(const OBB& obb, const Sphere& sphere)
 {
-	// Step 1: Transform the sphere's center into the OBB's local space
-	Matrix4x4 obbWorldMatrix = Matrix4x4::MakeAffineMatrix({ 1.0f, 1.0f, 1.0f }, { 0.0f, 0.0f, 0.0f }, obb.center);
-	Matrix4x4 obbRotationMatrix = Matrix4x4::MakeAffineMatrix({ 1.0f, 1.0f, 1.0f }, {}, Vector3());
-	obbRotationMatrix.m[0][0] = obb.orientations[0].x;
-	obbRotationMatrix.m[0][1] = obb.orientations[0].y;
-	obbRotationMatrix.m[0][2] = obb.orientations[0].z;
-
-	obbRotationMatrix.m[1][0] = obb.orientations[1].x;
-	obbRotationMatrix.m[1][1] = obb.orientations[1].y;
-	obbRotationMatrix.m[1][2] = obb.orientations[1].z;
-
-	obbRotationMatrix.m[2][0] = obb.orientations[2].x;
-	obbRotationMatrix.m[2][1] = obb.orientations[2].y;
-	obbRotationMatrix.m[2][2] = obb.orientations[2].z;
-
-	obbWorldMatrix = Matrix4x4::Multiply(obbWorldMatrix, obbRotationMatrix);
-	Matrix4x4 obbWorldMatrixInverse = Matrix4x4::Inverse(obbWorldMatrix);
-	Vector3 centerInOBBLocalSpace = Vector3::Transform(sphere.center, obbWorldMatrixInverse);
-
-	// Step 2: Find the closest point on the OBB to the sphere center in local space
-	Vector3 closestPoint = centerInOBBLocalSpace;
-	closestPoint.x = std::max(-obb.size.x * 0.5f, std::min(closestPoint.x, obb.size.x * 0.5f));
-	closestPoint.y = std::max(-obb.size.y * 0.5f, std::min(closestPoint.y, obb.size.y * 0.5f));
-	closestPoint.z = std::max(-obb.size.z * 0.5f, std::min(closestPoint.z, obb.size.z * 0.5f));
-
-	// Step 3: Calculate the distance between the sphere center and this closest point
-	Vector3 difference = centerInOBBLocalSpace - closestPoint;
-	float distanceSquared = Vector3::Dot(difference, difference);
+	// 球の中心をOBBの各軸に射影してローカル座標にする（軸は正規直交なので行列は作らない）
+	const Vector3 d = sphere.center - obb.center;
+	const Vector3 local = { Vector3::Dot(d, obb.orientations[0]), Vector3::Dot(d, obb.orientations[1]), Vector3::Dot(d, obb.orientations[2]) };
+
+	// 最近接点（この判定だけは size を全体の大きさとして半分にする）
+	const Vector3 half = obb.size * 0.5f;
+	const Vector3 closestPoint = {
+		std::max(-half.x, std::min(local.x, half.x)),
+		std::max(-half.y, std::min(local.y, half.y)),
+		std::max(-half.z, std::min(local.z, half.z)),
+	};
 
-	// Step 4: Check if the distance is less than or equal to the sphere's radius squared
-	return distanceSquared <= sphere.radius * sphere.radius;
+	// 最近接点との距離が半径以下なら衝突
+	const Vector3 difference = local - closestPoint;
+	return Vector3::Dot(difference, difference) <= sphere.radius * sphere.radius;
 }
 
 bool CollisionUtility::IsCollision(const OBB& obb, const Segment& segment)
 {
-	// OBBの回転行列を作成
-	Matrix4x4 rotationMatrix = {
-		obb.orientations[0].x, obb.orientations[0].y, obb.orientations[0].z, 0.0f,
-		obb.orientations[1].x, obb.orientations[1].y, obb.orientations[1].z, 0.0f,
-		obb.orientations[2].x, obb.orientations[2].y, obb.orientations[2].z, 0.0f,
-		0.0f, 0.0f, 0.0f, 1.0f
-	};
-
-	// OBBの逆変換行列（回転の転置行列と平行移動の逆変換）を作成
-	Matrix4x4 obbWorldMatrixInverse = Matrix4x4::Inverse(rotationMatrix);
-	obbWorldMatrixInverse.m[3][0] = -(obb.center.x * obbWorldMatrixInverse.m[0][0] + obb.center.y * obbWorldMatrixInverse.m[1][0] + obb.center.z * obbWorldMatrixInverse.m[2][0]);
-	obbWorldMatrixInverse.m[3][1] = -(obb.center.x * obbWorldMatrixInverse.m[0][1] + obb.center.y * obbWorldMatrixInverse.m[1][1] + obb.center.z * obbWorldMatrixInverse.m[2][1]);
-	obbWorldMatrixInverse.m[3][2] = -(obb.center.x * obbWorldMatrixInverse.m[0][2] + obb.center.y * obbWorldMatrixInverse.m[1][2] + obb.center.z * obbWorldMatrixInverse.m[2][2]);
+	// 線分をOBBの各軸に射影してローカル空間に移す（始点は中心からの差、向きはそのまま射影）
+	const Vector3 r = segment.origin - obb.center;
 
-	// セグメントの始点と終点をOBBのローカル空間に変換
-	Vector3 localOrigin = Vector3::Transform(segment.origin, obbWorldMatrixInverse);
-	Vector3 localEnd = Vector3::Transform(segment.origin + segment.diff, obbWorldMatrixInverse);
-
-	// 変換後のセグメント
 	Segment localSegment;
-	localSegment.origin = localOrigin;
-	localSegment.diff = localEnd - localOrigin;
+	localSegment.origin = { Vector3::Dot(r, obb.orientations[0]), Vector3::Dot(r, obb.orientations[1]), Vector3::Dot(r, obb.orientations[2]) };
+	localSegment.diff = { Vector3::Dot(segment.diff, obb.orientations[0]), Vector3::Dot(segment.diff, obb.orientations[1]), Vector3::Dot(segment.diff, obb.orientations[2]) };
 
 	// OBBのローカル空間でAABBとの衝突判定を行う
 	AABB aabbOBBLocal{ -obb.size, obb.size };
@@ -239,59 +209,53 @@ bool CollisionUtility::IsCollision(const Segment& segment, const OBB& obb)
 
 bool CollisionUtility::IsCollision(const OBB& obb1, const OBB& obb2)
 {
+	// 平行な辺の外積がほぼ0になっても誤って分離と判定しないための余裕
 	const float epsilon = 1e-5f;
 
-	// OBBの軸
-	Vector3 axes[15] = {
-		obb1.orientations[0],
-		obb1.orientations[1],
-		obb1.orientations[2],
-		obb2.orientations[0],
-		obb2.orientations[1],
-		obb2.orientations[2],
-		Vector3::Cross(obb1.orientations[0], obb2.orientations[0]),
-		Vector3::Cross(obb1.orientations[0], obb2.orientations[1]),
-		Vector3::Cross(obb1.orientations[0], obb2.orientations[2]),
-		Vector3::Cross(obb1.orientations[1], obb2.orientations[0]),
-		Vector3::Cross(obb1.orientations[1], obb2.orientations[1]),
-		Vector3::Cross(obb1.orientations[1], obb2.orientations[2]),
-		Vector3::Cross(obb1.orientations[2], obb2.orientations[0]),
-		Vector3::Cross(obb1.orientations[2], obb2.orientations[1]),
-		Vector3::Cross(obb1.orientations[2], obb2.orientations[2]),
-	};
+	const Vector3* a = obb1.orientations;
+	const Vector3* b = obb2.orientations;
+	const float ea[3] = { obb1.size.x, obb1.size.y, obb1.size.z };
+	const float eb[3] = { obb2.size.x, obb2.size.y, obb2.size.z };
 
-	// 各軸に対して分離が存在するかをチェック
-	for (int i = 0; i < 15; ++i) {
-		if (Vector3::Length(axes[i]) < epsilon) {
-			continue; // 無視できる軸
+	// obb2 の軸を obb1 の軸で表した回転（15軸すべてでこの9要素を使い回す）
+	float R[3][3], absR[3][3];
+	for (int i = 0; i < 3; ++i)
+	{
+		for (int j = 0; j < 3; ++j)
+		{
+			R[i][j] = Vector3::Dot(a[i], b[j]);
+			absR[i][j] = std::abs(R[i][j]) + epsilon;
 		}
+	}
 
-		// 軸を正規化
-		Vector3 axis = Vector3::Normalize(axes[i]);
-
-		// OBB1の投影範囲
-		float center1 = Vector3::Dot(obb1.center, axis);
-		float extent1 =
-			std::abs(Vector3::Dot(obb1.orientations[0] * obb1.size.x, axis)) +
-			std::abs(Vector3::Dot(obb1.orientations[1] * obb1.size.y, axis)) +
-			std::abs(Vector3::Dot(obb1.orientations[2] * obb1.size.z, axis));
-
-		float min1 = center1 - extent1;
-		float max1 = center1 + extent1;
+	// 中心間のベクトルを obb1 の軸で表す
+	const Vector3 d = obb2.center - obb1.center;
+	const float t[3] = { Vector3::Dot(d, a[0]), Vector3::Dot(d, a[1]), Vector3::Dot(d, a[2]) };
 
-		// OBB2の投影範囲
-		float center2 = Vector3::Dot(obb2.center, axis);
-		float extent2 =
-			std::abs(Vector3::Dot(obb2.orientations[0] * obb2.size.x, axis)) +
-			std::abs(Vector3::Dot(obb2.orientations[1] * obb2.size.y, axis)) +
-			std::abs(Vector3::Dot(obb2.orientations[2] * obb2.size.z, axis));
+	// obb1 の面の法線（3軸）
+	for (int i = 0; i < 3; ++i)
+	{
+		const float rb = eb[0] * absR[i][0] + eb[1] * absR[i][1] + eb[2] * absR[i][2];
+		if (std::abs(t[i]) > ea[i] + rb) return false;
+	}
 
-		float min2 = center2 - extent2;
-		float max2 = center2 + extent2;
+	// obb2 の面の法線（3軸）
+	for (int j = 0; j < 3; ++j)
+	{
+		const float ra = ea[0] * absR[0][j] + ea[1] * absR[1][j] + ea[2] * absR[2][j];
+		if (std::abs(t[0] * R[0][j] + t[1] * R[1][j] + t[2] * R[2][j]) > ra + eb[j]) return false;
+	}
 
-		// 投影範囲が重ならなければ分離している
-		if (max1 < min2 || max2 < min1) {
-			return false; // 分離軸が存在する
+	// 辺同士の外積（9軸）。軸 a[i] × b[j] への射影は R の要素の組み合わせで求まる
+	for (int i = 0; i < 3; ++i)
+	{
+		const int i1 = (i + 1) % 3, i2 = (i + 2) % 3;
+		for (int j = 0; j < 3; ++j)
+		{
+			const int j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+			const float ra = ea[i1] * absR[i2][j] + ea[i2] * absR[i1][j];
+			const float rb = eb[j1] * absR[i][j2] + eb[j2] * absR[i][j1];
+			if (std::abs(t[i2] * R[i1][j] - t[i1] * R[i2][j]) > ra + rb) return false;
 		}
 	}
 
@@ -299,6 +263,7 @@ bool CollisionUtility::IsCollision(const OBB& obb1, const OBB& obb2)
 	return true;
 }
 
+
 /// 線分 PQ, RS 間の最近接距離²
 static float SegmentSegmentDist2(const Vector3& P0, const Vector3& P1,
 	const Vector3& Q0, const Vector3& Q1)
@@ -372,35 +337,17 @@ bool CollisionUtility::IsCollision(const Capsule& cap1, const Capsule& cap2)
 
 bool CollisionUtility::IsCollision(const AABB& aabb, const Capsule& capsule)
 {
-	const Vector3& p0 = capsule.segment.origin;
-	const Vector3  p1 = capsule.segment.origin + capsule.segment.diff;
-
-	// 線分とAABBの最近接点を求める（AABB内にクランプ）
-	Vector3 segDir = p1 - p0;
-	float segLenSq = Vector3::Dot(segDir, segDir);
-	float t = 0.0f;
-	if (segLenSq > 1e-6f) {
-		// AABBに最も近い位置にtをクランプ
-		Vector3 boxCenter = (aabb.min + aabb.max) * 0.5f;
-		t = Vector3::Dot(boxCenter - p0, segDir) / segLenSq;
-		t = std::clamp(t, 0.0f, 1.0f);
-	}
+	// この組だけ segment.diff は始点からの差分（PhysicalScene・Wireframe::DrawCapsule と同じ）
+	const Vector3 center = (aabb.min + aabb.max) * 0.5f;
+	const Vector3 halfSize = (aabb.max - aabb.min) * 0.5f;
 
-	Vector3 closestOnSegment = p0 + segDir * t;
-
-	// AABB内の最近接点を求める
-	Vector3 closestInAABB = {
-		std::clamp(closestOnSegment.x, aabb.min.x, aabb.max.x),
-		std::clamp(closestOnSegment.y, aabb.min.y, aabb.max.y),
-		std::clamp(closestOnSegment.z, aabb.min.z, aabb.max.z),
-	};
-
-	// 2点間の距離の2乗
-	Vector3 diff = closestOnSegment - closestInAABB;
-	float distSq = Vector3::Dot(diff, diff);
+	// 箱の中心を原点にして、線分と箱の最短距離²を厳密に求める
+	float s = 0.0f;
+	Vector3 boxPoint{};
+	const float dist2 = ClosestPointSegmentBox(capsule.segment.origin - center, capsule.segment.diff, halfSize, s, boxPoint);
 
 	// 半径を考慮して判定
-	return distSq <= (capsule.radius * capsule.radius) + 1e-6f;
+	return dist2 <= (capsule.radius * capsule.radius) + 1e-6f;
 }
 
 bool CollisionUtility::IsCollision(const Capsule& capsule, const AABB& aabb)
@@ -418,8 +365,8 @@ bool CollisionUtility::IsCollision(const Capsule& capsule, const Sphere& sphere)
 	// A-B 上に C に最も近い点 P を求める（線分と点の最近接点）
 	Vector3 AB = B - A;
 	Vector3 AC = C - A;
-	float t = Vector3::Dot(AC, AB) / Vector3::Dot(AB, AB);
-	t = std::clamp(t, 0.0f, 1.0f);
+	float lenSq = Vector3::Dot(AB, AB);
+	float t = lenSq > 1e-6f ? std::clamp(Vector3::Dot(AC, AB) / lenSq, 0.0f, 1.0f) : 0.0f; // 長さ0なら端点
 	Vector3 P = A + AB * t;
 
 	// P-C 間の距離²
@@ -485,3 +432,291 @@ bool CollisionUtility::IsCollision(const Plane& plane, const Capsule& capsule)
 {
 	return IsCollision(capsule, plane);
 }
+
+// ============================================================================
+//  Capsule–OBB
+// ============================================================================
+
+/// 点 p + d * s（s ∈ [0,1]）と箱 [-h, h] の最短距離²（区分的に2次で凸なので区間ごとに極小を調べる）
+float CollisionUtility::ClosestPointSegmentBox(const Vector3& p, const Vector3& d, const Vector3& h, float& outS, Vector3& outBoxPoint)
+{
+	// 各軸が箱の面をまたぐ s を区切りにする
+	float breaks[8] = { 0.0f, 1.0f };
+	int breakCount = 2;
+	for (int i = 0; i < 3; ++i)
+	{
+		if (std::abs(d[i]) < 1e-12f) continue;
+		const float s0 = (-h[i] - p[i]) / d[i];
+		const float s1 = (h[i] - p[i]) / d[i];
+		if (s0 > 0.0f && s0 < 1.0f) breaks[breakCount++] = s0;
+		if (s1 > 0.0f && s1 < 1.0f) breaks[breakCount++] = s1;
+	}
+	std::sort(breaks, breaks + breakCount);
+
+	auto dist2 = [&](float s) {
+		float sum = 0.0f;
+		for (int i = 0; i < 3; ++i)
+		{
+			const float v = p[i] + d[i] * s;
+			const float excess = (v < -h[i]) ? v + h[i] : (v > h[i]) ? v - h[i] : 0.0f;
+			sum += excess * excess;
+		}
+		return sum;
+		};
+
+	float bestS = 0.0f;
+	float best = dist2(0.0f);
+	auto consider = [&](float s) {
+		const float value = dist2(s);
+		if (value < best) { best = value; bestS = s; }
+		};
+	consider(1.0f);
+
+	for (int k = 0; k + 1 < breakCount; ++k)
+	{
+		const float a = breaks[k];
+		const float b = breaks[k + 1];
+		if (b - a <= 0.0f) continue;
+
+		// 区間の中ではみ出している軸だけで2次式の極小を求める
+		const float mid = (a + b) * 0.5f;
+		float num = 0.0f;
+		float den = 0.0f;
+		for (int i = 0; i < 3; ++i)
+		{
+			const float v = p[i] + d[i] * mid;
+			if (v < -h[i]) { num += d[i] * (p[i] + h[i]); den += d[i] * d[i]; }
+			else if (v > h[i]) { num += d[i] * (p[i] - h[i]); den += d[i] * d[i]; }
+		}
+		consider((den > 1e-12f) ? std::clamp(-num / den, a, b) : mid);
+	}
+
+	// 箱の上の最近接点は線分上の点を箱に押し込んだ位置
+	outS = bestS;
+	for (int i = 0; i < 3; ++i) outBoxPoint[i] = std::clamp(p[i] + d[i] * bestS, -h[i], h[i]);
+	return best;
+}
+
+bool CollisionUtility::IsCollision(const Capsule& capsule, const OBB& obb)
+{
+	// カプセルの軸（segment.diff は終点）を OBB のローカル空間へ（回転は転置で戻す）
+	auto toLocal = [&](const Vector3& v) {
+		const Vector3 r = v - obb.center;
+		return Vector3{ Vector3::Dot(r, obb.orientations[0]), Vector3::Dot(r, obb.orientations[1]), Vector3::Dot(r, obb.orientations[2]) };
+		};
+	const Vector3 p0 = toLocal(capsule.segment.origin);
+	const Vector3 p1 = toLocal(capsule.segment.diff);
+
+	// size は線分との判定と同じく半サイズとして扱う
+	float s = 0.0f;
+	Vector3 boxPoint{};
+	const float dist2 = ClosestPointSegmentBox(p0, p1 - p0, obb.size, s, boxPoint);
+	return dist2 <= capsule.radius * capsule.radius + 1e-6f;
+}
+
+bool CollisionUtility::IsCollision(const OBB& obb, const Capsule& capsule)
+{
+	return IsCollision(capsule, obb);
+}
+
+
+// ============================================================================
+//  連続判定（最初に触れる時刻）
+// ============================================================================
+
+/// 点 origin + dir * t が球に入る最初の t（t ≦ 1 のみ。開始時点で内側なら 0）
+static bool RaySphereTimeOfImpact(const Vector3& origin, const Vector3& dir,
+	const Vector3& center, float radius, float& t)
+{
+	const Vector3 m = origin - center;
+	const float c = Vector3::Dot(m, m) - radius * radius;
+
+	// 開始時点で重なっている
+	if (c <= 0.0f) { t = 0.0f; return true; }
+
+	const float a = Vector3::Dot(dir, dir);
+	const float b = Vector3::Dot(m, dir);
+
+	// 動いていない、または遠ざかっている
+	if (a < 1e-12f || b > 0.0f) return false;
+
+	const float disc = b * b - a * c;
+	if (disc < 0.0f) return false;
+
+	t = (-b - std::sqrt(disc)) / a;
+	return t <= 1.0f;
+}
+
+bool CollisionUtility::SweepSphere(const Sphere& sphere, const Vector3& displacement, const Sphere& target, float& t)
+{
+	// 相手の半径を足して点の移動として扱う
+	return RaySphereTimeOfImpact(sphere.center, displacement, target.center, sphere.radius + target.radius, t);
+}
+
+bool CollisionUtility::SweepSphere(const Sphere& sphere, const Vector3& displacement, const Capsule& capsule, float& t)
+{
+	// カプセルを球の半径だけ太らせて中心の線分で調べる
+	Capsule inflated = capsule;
+	inflated.radius += sphere.radius;
+	return IntersectSegmentCapsule({ sphere.center, displacement }, inflated, t);
+}
+
+bool CollisionUtility::IntersectSegmentCapsule(const Segment& segment, const Capsule& capsule, float& t)
+{
+	// カプセルの軸（segment.diff は終点として扱われている）
+	const Vector3& pa = capsule.segment.origin;
+	const Vector3& pb = capsule.segment.diff;
+	const float r = capsule.radius;
+
+	const Vector3 ba = pb - pa;
+	const Vector3 oa = segment.origin - pa;
+	const Vector3& rd = segment.diff;
+
+	const float baba = Vector3::Dot(ba, ba);
+	const float baoa = Vector3::Dot(ba, oa);
+
+	// 開始時点で重なっているなら 0
+	{
+		const float s = (baba > 1e-12f) ? std::clamp(baoa / baba, 0.0f, 1.0f) : 0.0f;
+		const Vector3 d = oa - ba * s;
+		if (Vector3::Dot(d, d) <= r * r) { t = 0.0f; return true; }
+	}
+
+	float best = 2.0f;
+
+	// 円柱の側面（軸方向に平行な移動では側面には当たらない）
+	if (baba > 1e-12f)
+	{
+		const float bard = Vector3::Dot(ba, rd);
+		const float rdrd = Vector3::Dot(rd, rd);
+		const float rdoa = Vector3::Dot(rd, oa);
+		const float oaoa = Vector3::Dot(oa, oa);
+
+		const float a = baba * rdrd - bard * bard;
+		const float b = baba * rdoa - baoa * bard;
+		const float c = baba * oaoa - baoa * baoa - r * r * baba;
+
+		if (a > 1e-12f)
+		{
+			const float h = b * b - a * c;
+			if (h >= 0.0f)
+			{
+				const float tc = (-b - std::sqrt(h)) / a;
+				const float y = baoa + tc * bard;
+				if (tc >= 0.0f && tc <= 1.0f && y >= 0.0f && y <= baba) best = tc;
+			}
+		}
+	}
+
+	// 両端の半球
+	float ts = 0.0f;
+	if (RaySphereTimeOfImpact(segment.origin, rd, pa, r, ts) && ts < best) best = ts;
+	if (RaySphereTimeOfImpact(segment.origin, rd, pb, r, ts) && ts < best) best = ts;
+
+	if (best > 1.0f) return false;
+
+	t = best;
+	return true;
+}
+
+/// 点 origin + diff * t が箱 [min, max] に入る最初の t（スラブ法。開始時点で内側なら 0）
+static bool SegmentSlabTimeOfImpact(const Vector3& origin, const Vector3& diff, const Vector3& min, const Vector3& max, float& t)
+{
+	float tEnter = 0.0f;
+	float tExit = 1.0f;
+	for (int i = 0; i < 3; ++i)
+	{
+		// 軸に平行なら範囲内にいるかだけを見る
+		if (std::abs(diff[i]) < 1e-12f)
+		{
+			if (origin[i] < min[i] || origin[i] > max[i]) return false;
+			continue;
+		}
+
+		const float inv = 1.0f / diff[i];
+		float t0 = (min[i] - origin[i]) * inv;
+		float t1 = (max[i] - origin[i]) * inv;
+		if (t0 > t1) std::swap(t0, t1);
+
+		tEnter = std::max(tEnter, t0);
+		tExit = std::min(tExit, t1);
+		if (tEnter > tExit) return false;
+	}
+
+	t = tEnter;
+	return true;
+}
+
+bool CollisionUtility::IntersectSegmentSphere(const Segment& segment, const Sphere& sphere, float& t)
+{
+	return RaySphereTimeOfImpact(segment.origin, segment.diff, sphere.center, sphere.radius, t);
+}
+
+bool CollisionUtility::IntersectSegmentAABB(const Segment& segment, const AABB& aabb, float& t)
+{
+	return SegmentSlabTimeOfImpact(segment.origin, segment.diff, aabb.min, aabb.max, t);
+}
+
+bool CollisionUtility::IntersectSegmentOBB(const Segment& segment, const OBB& obb, float& t)
+{
+	// OBB のローカル空間（回転は転置で戻す）で半サイズの箱と調べる
+	const Vector3 r = segment.origin - obb.center;
+	const Vector3 localOrigin = { Vector3::Dot(r, obb.orientations[0]), Vector3::Dot(r, obb.orientations[1]), Vector3::Dot(r, obb.orientations[2]) };
+	const Vector3 localDiff = { Vector3::Dot(segment.diff, obb.orientations[0]), Vector3::Dot(segment.diff, obb.orientations[1]), Vector3::Dot(segment.diff, obb.orientations[2]) };
+	return SegmentSlabTimeOfImpact(localOrigin, localDiff, -obb.size, obb.size, t);
+}
+
+
+/// -------------------------------------------------------------
+///				　		子をすべて囲むカプセル
+/// -------------------------------------------------------------
+Capsule CollisionUtility::ComputeBoundingCapsule(std::span<const Capsule> children)
+{
+	if (children.empty()) return {};
+
+	// 子の端点と半径のワールドAABB
+	Vector3 min = { FLT_MAX, FLT_MAX, FLT_MAX };
+	Vector3 max = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+	for (const Capsule& child : children)
+	{
+		for (const Vector3& p : { child.segment.origin, child.segment.diff })
+		{
+			for (int k = 0; k < 3; ++k)
+			{
+				min[k] = std::min(min[k], p[k] - child.radius);
+				max[k] = std::max(max[k], p[k] + child.radius);
+			}
+		}
+	}
+
+	// 一番長い軸に沿って、残りの2軸の広がりの分だけ両端を縮めた線分を芯にする
+	const Vector3 center = (min + max) * 0.5f;
+	const Vector3 half = (max - min) * 0.5f;
+	int axis = 0;
+	if (half[1] > half[axis]) axis = 1;
+	if (half[2] > half[axis]) axis = 2;
+	const float inset = std::max(half[(axis + 1) % 3], half[(axis + 2) % 3]);
+	const float lo = center[axis] - (half[axis] - inset);
+	const float hi = center[axis] + (half[axis] - inset);
+
+	// 半径は子の端点から芯までの距離 + 子の半径の最大（点と線分の距離は凸なので端点だけ見れば子全体を囲める）
+	float radius = 0.0f;
+	for (const Capsule& child : children)
+	{
+		for (const Vector3& p : { child.segment.origin, child.segment.diff })
+		{
+			const float along = std::max({ 0.0f, lo - p[axis], p[axis] - hi });
+			const float u = p[(axis + 1) % 3] - center[(axis + 1) % 3];
+			const float v = p[(axis + 2) % 3] - center[(axis + 2) % 3];
+			radius = std::max(radius, std::sqrt(along * along + u * u + v * v) + child.radius);
+		}
+	}
+
+	Capsule bound{};
+	bound.segment.origin = center;
+	bound.segment.diff = center;
+	bound.segment.origin[axis] = lo;
+	bound.segment.diff[axis] = hi;
+	bound.radius = radius;
+	return bound;
+}
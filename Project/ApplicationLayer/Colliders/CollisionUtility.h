@@ -7,6 +7,9 @@
 #include "AABB.h"
 #include "OBB.h"
 #include "Capsule.h"
+#include "ShapeBatch.h"
+
+#include <span>
 
 
 //// -------------------------------------------------------------
@@ -58,10 +61,11 @@ public: /// ---------- メンバ関数 ---------- ///
 	// CapsuleとCapsuleの衝突判定
 	static bool IsCollision(const Capsule& capsule1, const Capsule& capsule2);
 
-	// CapsuleとOBBの衝突判定
-	//static bool IsCollision(const Capsule& capsule, const OBB& obb);
+	// CapsuleとOBBの衝突判定（OBBの size は半サイズ）
+	static bool IsCollision(const Capsule& capsule, const OBB& obb);
+	static bool IsCollision(const OBB& obb, const Capsule& capsule);
 
-	// CapsuleとAABBの衝突判定
+	// CapsuleとAABBの衝突判定（この組だけ segment.diff は始点からの差分）
 	static bool IsCollision(const AABB& aabb, const Capsule& capsule);
 	static bool IsCollision(const Capsule& capsule, const AABB& aabb);
 
@@ -76,4 +80,40 @@ public: /// ---------- メンバ関数 ---------- ///
 	// CapsuleとPlaneの衝突判定
 	static bool IsCollision(const Capsule& capsule, const Plane& plane);
 	static bool IsCollision(const Plane& plane, const Capsule& capsule);
+
+public: /// ---------- 最近接点 ---------- ///
+
+	// 線分 p + d * s（s ∈ [0,1]）と原点中心・半サイズ h の箱の最短距離²（最近接点の s と箱の上の点も返す）
+	static float ClosestPointSegmentBox(const Vector3& p, const Vector3& d, const Vector3& h, float& outS, Vector3& outBoxPoint);
+
+public: /// ---------- 外接形状 ---------- ///
+
+	// カプセルをすべて囲むカプセル（ワールドAABBの一番長い軸に沿わせる）
+	static Capsule ComputeBoundingCapsule(std::span<const Capsule> children);
+
+public: /// ---------- 連続判定（最初に触れる時刻） ---------- ///
+
+	// 球を displacement だけ動かしたとき target に最初に触れる時刻 t ∈ [0,1]（開始時点で重なっていれば 0）
+	static bool SweepSphere(const Sphere& sphere, const Vector3& displacement, const Sphere& target, float& t);
+
+	// 球を displacement だけ動かしたときカプセルに最初に触れる時刻 t ∈ [0,1]
+	static bool SweepSphere(const Sphere& sphere, const Vector3& displacement, const Capsule& capsule, float& t);
+
+	// 線分（origin + diff * t）がカプセルに最初に入る時刻 t ∈ [0,1]
+	static bool IntersectSegmentCapsule(const Segment& segment, const Capsule& capsule, float& t);
+
+	// 線分（origin + diff * t）が球 / AABB / OBB（size は半サイズ）に最初に入る時刻 t ∈ [0,1]
+	static bool IntersectSegmentSphere(const Segment& segment, const Sphere& sphere, float& t);
+	static bool IntersectSegmentAABB(const Segment& segment, const AABB& aabb, float& t);
+	static bool IntersectSegmentOBB(const Segment& segment, const OBB& obb, float& t);
+
+public: /// ---------- 一括判定 ---------- ///
+
+	// 線分1本と count 個（≦ kShapeBatchWidth）のカプセル/OBBを一度に判定し、当たったレーンのビットを返す
+	// スカラー版の IsCollision(Segment, Capsule / OBB) と同じ演算順序（OBBは各軸への射影でローカル空間に移す）
+	static uint32_t IsCollisionBatch(const Segment& segment, const CapsuleBatch& capsules, uint32_t count);
+	static uint32_t IsCollisionBatch(const Segment& segment, const OBBBatch& obbs, uint32_t count);
+
+	// 一括判定で使われている命令セット（"AVX2" / "SSE2" / "Scalar"）
+	static const char* GetBatchBackendName();
 };
@@ -0,0 +1,289 @@
+#include "CollisionUtility.h"
+
+#include <cmath>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define COLLISION_BATCH_AVX2
+#elif defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#include <emmintrin.h>
+#define COLLISION_BATCH_SSE2
+#endif
+
+
+namespace
+{
+	/// -------------------------------------------------------------
+	///			レーン演算（スカラー / SSE2 / AVX2 で同じカーネルを使う）
+	/// -------------------------------------------------------------
+
+	// Min / Max は std::min / std::max と同じ引数順・NaN の扱いにそろえる
+	struct ScalarLane
+	{
+		static constexpr uint32_t kWidth = 1;
+		using F = float;
+		using M = bool;
+
+		static F Load(const float* p) { return *p; }
+		static F Set(float v) { return v; }
+		static F Add(F a, F b) { return a + b; }
+		static F Sub(F a, F b) { return a - b; }
+		static F Mul(F a, F b) { return a * b; }
+		static F Div(F a, F b) { return a / b; }
+		static F Neg(F a) { return -a; }
+		static F Abs(F a) { return std::fabs(a); }
+		static F Min(F a, F b) { return (b < a) ? b : a; }
+		static F Max(F a, F b) { return (a < b) ? b : a; }
+		static M Lt(F a, F b) { return a < b; }
+		static M Le(F a, F b) { return a <= b; }
+		static M Gt(F a, F b) { return a > b; }
+		static M Ge(F a, F b) { return a >= b; }
+		static M And(M a, M b) { return a && b; }
+		static M Or(M a, M b) { return a || b; }
+		static M AndNot(M a, M b) { return !a && b; }
+		static F Select(M m, F a, F b) { return m ? a : b; }
+		static uint32_t MoveMask(M m) { return m ? 1u : 0u; }
+	};
+
+#if defined(COLLISION_BATCH_AVX2)
+	struct Avx2Lane
+	{
+		static constexpr uint32_t kWidth = 8;
+		using F = __m256;
+		using M = __m256;
+
+		static F Load(const float* p) { return _mm256_loadu_ps(p); }
+		static F Set(float v) { return _mm256_set1_ps(v); }
+		static F Add(F a, F b) { return _mm256_add_ps(a, b); }
+		static F Sub(F a, F b) { return _mm256_sub_ps(a, b); }
+		static F Mul(F a, F b) { return _mm256_mul_ps(a, b); }
+		static F Div(F a, F b) { return _mm256_div_ps(a, b); }
+		static F Neg(F a) { return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f)); }
+		static F Abs(F a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+		static F Min(F a, F b) { return _mm256_min_ps(b, a); }
+		static F Max(F a, F b) { return _mm256_max_ps(b, a); }
+		static M Lt(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+		static M Le(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+		static M Gt(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+		static M Ge(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+		static M And(M a, M b) { return _mm256_and_ps(a, b); }
+		static M Or(M a, M b) { return _mm256_or_ps(a, b); }
+		static M AndNot(M a, M b) { return _mm256_andnot_ps(a, b); }
+		static F Select(M m, F a, F b) { return _mm256_blendv_ps(b, a, m); }
+		static uint32_t MoveMask(M m) { return static_cast<uint32_t>(_mm256_movemask_ps(m)); }
+	};
+	using Lane = Avx2Lane;
+#elif defined(COLLISION_BATCH_SSE2)
+	struct SseLane
+	{
+		static constexpr uint32_t kWidth = 4;
+		using F = __m128;
+		using M = __m128;
+
+		static F Load(const float* p) { return _mm_loadu_ps(p); }
+		static F Set(float v) { return _mm_set1_ps(v); }
+		static F Add(F a, F b) { return _mm_add_ps(a, b); }
+		static F Sub(F a, F b) { return _mm_sub_ps(a, b); }
+		static F Mul(F a, F b) { return _mm_mul_ps(a, b); }
+		static F Div(F a, F b) { return _mm_div_ps(a, b); }
+		static F Neg(F a) { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+		static F Abs(F a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+		static F Min(F a, F b) { return _mm_min_ps(b, a); }
+		static F Max(F a, F b) { return _mm_max_ps(b, a); }
+		static M Lt(F a, F b) { return _mm_cmplt_ps(a, b); }
+		static M Le(F a, F b) { return _mm_cmple_ps(a, b); }
+		static M Gt(F a, F b) { return _mm_cmpgt_ps(a, b); }
+		static M Ge(F a, F b) { return _mm_cmpge_ps(a, b); }
+		static M And(M a, M b) { return _mm_and_ps(a, b); }
+		static M Or(M a, M b) { return _mm_or_ps(a, b); }
+		static M AndNot(M a, M b) { return _mm_andnot_ps(a, b); }
+		static F Select(M m, F a, F b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+		static uint32_t MoveMask(M m) { return static_cast<uint32_t>(_mm_movemask_ps(m)); }
+	};
+	using Lane = SseLane;
+#else
+	using Lane = ScalarLane;
+#endif
+
+
+	/// -------------------------------------------------------------
+	///				線分と複数カプセル（offset から Width 個）
+	/// -------------------------------------------------------------
+	template <class L>
+	uint32_t SegmentCapsuleLanes(const Segment& segment, const CapsuleBatch& capsules, uint32_t offset)
+	{
+		using F = typename L::F;
+		using M = typename L::M;
+
+		auto dot = [](F ax, F ay, F az, F bx, F by, F bz) {
+			return L::Add(L::Add(L::Mul(ax, bx), L::Mul(ay, by)), L::Mul(az, bz));
+			};
+
+		// スカラー版の SegmentSegmentDist2(capsule.origin, capsule.diff, p0, p1) と同じ手順
+		const Vector3 p1 = segment.origin + segment.diff;
+		const F q0x = L::Set(segment.origin.x), q0y = L::Set(segment.origin.y), q0z = L::Set(segment.origin.z);
+		const F q1x = L::Set(p1.x), q1y = L::Set(p1.y), q1z = L::Set(p1.z);
+
+		const F P0x = L::Load(capsules.ax + offset), P0y = L::Load(capsules.ay + offset), P0z = L::Load(capsules.az + offset);
+		const F P1x = L::Load(capsules.bx + offset), P1y = L::Load(capsules.by + offset), P1z = L::Load(capsules.bz + offset);
+
+		const F ux = L::Sub(P1x, P0x), uy = L::Sub(P1y, P0y), uz = L::Sub(P1z, P0z);
+		const F vx = L::Sub(q1x, q0x), vy = L::Sub(q1y, q0y), vz = L::Sub(q1z, q0z);
+		const F wx = L::Sub(P0x, q0x), wy = L::Sub(P0y, q0y), wz = L::Sub(P0z, q0z);
+
+		const F a = dot(ux, uy, uz, ux, uy, uz);
+		const F b = dot(ux, uy, uz, vx, vy, vz);
+		const F c = dot(vx, vy, vz, vx, vy, vz);
+		const F d = dot(ux, uy, uz, wx, wy, wz);
+		const F e = dot(vx, vy, vz, wx, wy, wz);
+		const F D = L::Sub(L::Mul(a, c), L::Mul(b, b));
+
+		const F zero = L::Set(0.0f);
+		const F one = L::Set(1.0f);
+		const F eps = L::Set(1e-6f);
+
+		// 線分がほぼ平行
+		const M parallel = L::Lt(D, eps);
+		F sN = L::Select(parallel, zero, L::Sub(L::Mul(b, e), L::Mul(c, d)));
+		F sD = L::Select(parallel, one, D);
+		F tN = L::Select(parallel, e, L::Sub(L::Mul(a, e), L::Mul(b, d)));
+		F tD = L::Select(parallel, c, D);
+
+		// s を [0,1] にクランプ（平行でないときだけ）
+		const M sLow = L::AndNot(parallel, L::Lt(sN, zero));
+		const M sHigh = L::AndNot(parallel, L::AndNot(L::Lt(sN, zero), L::Gt(sN, sD)));
+		sN = L::Select(sLow, zero, L::Select(sHigh, sD, sN));
+		tN = L::Select(sLow, e, L::Select(sHigh, L::Add(e, b), tN));
+		tD = L::Select(L::Or(sLow, sHigh), c, tD);
+
+		// t を [0,1] にクランプ
+		const M tLow = L::Lt(tN, zero);
+		const M tHigh = L::AndNot(tLow, L::Gt(tN, tD));
+
+		const F negD = L::Neg(d);
+		const F negDB = L::Add(negD, b);
+
+		const F sNLow = L::Select(L::Lt(negD, zero), zero, L::Select(L::Gt(negD, a), sD, negD));
+		const F sDLow = L::Select(L::Or(L::Lt(negD, zero), L::Gt(negD, a)), sD, a);
+		const F sNHigh = L::Select(L::Lt(negDB, zero), zero, L::Select(L::Gt(negDB, a), sD, negDB));
+		const F sDHigh = L::Select(L::Or(L::Lt(negDB, zero), L::Gt(negDB, a)), sD, a);
+
+		tN = L::Select(tLow, zero, L::Select(tHigh, tD, tN));
+		sN = L::Select(tLow, sNLow, L::Select(tHigh, sNHigh, sN));
+		sD = L::Select(tLow, sDLow, L::Select(tHigh, sDHigh, sD));
+
+		const F sc = L::Select(L::Lt(L::Abs(sN), eps), zero, L::Div(sN, sD));
+		const F tc = L::Select(L::Lt(L::Abs(tN), eps), zero, L::Div(tN, tD));
+
+		const F dx = L::Sub(L::Add(wx, L::Mul(ux, sc)), L::Mul(vx, tc));
+		const F dy = L::Sub(L::Add(wy, L::Mul(uy, sc)), L::Mul(vy, tc));
+		const F dz = L::Sub(L::Add(wz, L::Mul(uz, sc)), L::Mul(vz, tc));
+		const F dist2 = dot(dx, dy, dz, dx, dy, dz);
+
+		// 半径² と比較
+		const F r = L::Load(capsules.radius + offset);
+		return L::MoveMask(L::Le(dist2, L::Add(L::Mul(r, r), eps)));
+	}
+
+
+	/// -------------------------------------------------------------
+	///				線分と複数OBB（offset から Width 個）
+	/// -------------------------------------------------------------
+	template <class L>
+	uint32_t SegmentOBBLanes(const Segment& segment, const OBBBatch& obbs, uint32_t offset)
+	{
+		using F = typename L::F;
+		using M = typename L::M;
+
+		// OBBの各軸に射影してローカル空間へ（スカラー版と同じく、始点は中心からの差、向きはそのまま射影）
+		const F o0x = L::Load(obbs.axis[0][0] + offset), o0y = L::Load(obbs.axis[0][1] + offset), o0z = L::Load(obbs.axis[0][2] + offset);
+		const F o1x = L::Load(obbs.axis[1][0] + offset), o1y = L::Load(obbs.axis[1][1] + offset), o1z = L::Load(obbs.axis[1][2] + offset);
+		const F o2x = L::Load(obbs.axis[2][0] + offset), o2y = L::Load(obbs.axis[2][1] + offset), o2z = L::Load(obbs.axis[2][2] + offset);
+
+		auto dot = [](F ax, F ay, F az, F bx, F by, F bz) {
+			return L::Add(L::Add(L::Mul(ax, bx), L::Mul(ay, by)), L::Mul(az, bz));
+			};
+
+		const F rx = L::Sub(L::Set(segment.origin.x), L::Load(obbs.cx + offset));
+		const F ry = L::Sub(L::Set(segment.origin.y), L::Load(obbs.cy + offset));
+		const F rz = L::Sub(L::Set(segment.origin.z), L::Load(obbs.cz + offset));
+		const F ox = dot(rx, ry, rz, o0x, o0y, o0z);
+		const F oy = dot(rx, ry, rz, o1x, o1y, o1z);
+		const F oz = dot(rx, ry, rz, o2x, o2y, o2z);
+
+		const F sdx = L::Set(segment.diff.x), sdy = L::Set(segment.diff.y), sdz = L::Set(segment.diff.z);
+		const F dx = dot(sdx, sdy, sdz, o0x, o0y, o0z);
+		const F dy = dot(sdx, sdy, sdz, o1x, o1y, o1z);
+		const F dz = dot(sdx, sdy, sdz, o2x, o2y, o2z);
+
+		// AABB{ -size, size } とのスラブ判定
+		const F sx = L::Load(obbs.sx + offset), sy = L::Load(obbs.sy + offset), sz = L::Load(obbs.sz + offset);
+
+		auto slab = [&](F size, F origin, F diff, F& tNear, F& tFar) {
+			const F n = L::Div(L::Sub(L::Neg(size), origin), diff);
+			const F f = L::Div(L::Sub(size, origin), diff);
+
+			// n > f なら入れ替え（NaN のときは入れ替えないのもスカラー版と同じ）
+			const M swap = L::Gt(n, f);
+			tNear = L::Select(swap, f, n);
+			tFar = L::Select(swap, n, f);
+			};
+
+		F nX, fX, nY, fY, nZ, fZ;
+		slab(sx, ox, dx, nX, fX);
+		slab(sy, oy, dy, nY, fY);
+		slab(sz, oz, dz, nZ, fZ);
+
+		const F tmin = L::Max(L::Max(nX, nY), nZ);
+		const F tmax = L::Min(L::Min(fX, fY), fZ);
+
+		const M hit = L::And(L::And(L::Le(tmin, tmax), L::Ge(tmax, L::Set(0.0f))), L::Le(tmin, L::Set(1.0f)));
+		return L::MoveMask(hit);
+	}
+
+
+	// レーン幅ごとに回して count 個分のビットにまとめる
+	template <class L, class Batch, class Kernel>
+	uint32_t RunBatch(const Segment& segment, const Batch& batch, uint32_t count, Kernel kernel)
+	{
+		if (count == 0) return 0;
+		if (count > kShapeBatchWidth) count = kShapeBatchWidth;
+
+		uint32_t mask = 0;
+		for (uint32_t i = 0; i < count; i += L::kWidth) mask |= kernel(segment, batch, i) << i;
+		return mask & ((1u << count) - 1u);
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　線分と複数カプセルの一括判定
+/// -------------------------------------------------------------
+uint32_t CollisionUtility::IsCollisionBatch(const Segment& segment, const CapsuleBatch& capsules, uint32_t count)
+{
+	return RunBatch<Lane>(segment, capsules, count, &SegmentCapsuleLanes<Lane>);
+}
+
+
+/// -------------------------------------------------------------
+///				　線分と複数OBBの一括判定
+/// -------------------------------------------------------------
+uint32_t CollisionUtility::IsCollisionBatch(const Segment& segment, const OBBBatch& obbs, uint32_t count)
+{
+	return RunBatch<Lane>(segment, obbs, count, &SegmentOBBLanes<Lane>);
+}
+
+
+/// -------------------------------------------------------------
+///				　一括判定で使われている命令セット
+/// -------------------------------------------------------------
+const char* CollisionUtility::GetBatchBackendName()
+{
+#if defined(COLLISION_BATCH_AVX2)
+	return "AVX2";
+#elif defined(COLLISION_BATCH_SSE2)
+	return "SSE2";
+#else
+	return "Scalar";
+#endif
+}
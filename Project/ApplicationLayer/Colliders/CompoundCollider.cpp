@@ -0,0 +1,124 @@
+#define NOMINMAX
+#include "CompoundCollider.h"
+#include "CollisionUtility.h"
+#include "AnimationModel.h"
+#include "Wireframe.h"
+
+#include <algorithm>
+#include <imgui.h>
+
+
+/// -------------------------------------------------------------
+///				　	モデルのボディパーツから作る
+/// -------------------------------------------------------------
+void CompoundCollider::Bind(const AnimationModel& model)
+{
+	ClearChildren();
+	for (const auto& part : model.GetBodyParts())
+	{
+		AddChild({ part.name, part.startJointIndex, part.endJointIndex, part.offset, part.radius });
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　			子の追加・削除
+/// -------------------------------------------------------------
+void CompoundCollider::AddChild(const Child& child)
+{
+	children_.push_back(child);
+	childCapsules_.push_back({ {}, child.radius });
+	MarkShapeDirty();
+}
+
+void CompoundCollider::ClearChildren()
+{
+	children_.clear();
+	childCapsules_.clear();
+	MarkShapeDirty();
+}
+
+
+/// -------------------------------------------------------------
+///				　		骨の姿勢から更新
+/// -------------------------------------------------------------
+void CompoundCollider::UpdateFromJoints(const std::vector<Joint>& joints, const Matrix4x4& worldMatrix)
+{
+	const int32_t jointCount = static_cast<int32_t>(joints.size());
+
+	// 骨の位置をまとめてワールドへ
+	jointPositions_.resize(joints.size());
+	for (size_t i = 0; i < joints.size(); ++i) jointPositions_[i] = joints[i].skeletonSpaceMatrix.GetTranslation();
+	Vector3::TransformPoints(jointPositions_, worldMatrix, jointPositions_);
+
+	for (size_t i = 0; i < children_.size(); ++i)
+	{
+		const Child& child = children_[i];
+		Capsule& capsule = childCapsules_[i];
+		capsule.radius = child.radius;
+
+		// 骨が足りないモデルでは動かさない
+		if (child.startJoint < 0 || child.startJoint >= jointCount || child.endJoint >= jointCount) continue;
+
+		if (child.endJoint < 0)
+		{
+			// 球（長さ0のカプセル）
+			const Vector3 local = joints[child.startJoint].skeletonSpaceMatrix.GetTranslation() + child.offset;
+			capsule.segment.origin = capsule.segment.diff = Vector3::Transform(local, worldMatrix);
+		}
+		else
+		{
+			capsule.segment.origin = jointPositions_[child.startJoint];
+			capsule.segment.diff = jointPositions_[child.endJoint];
+		}
+	}
+
+	// 外形を囲み直す（SetCapsule で形状の更新が登録先に伝わる）
+	if (!childCapsules_.empty()) SetCapsule(CollisionUtility::ComputeBoundingCapsule(childCapsules_));
+}
+
+void CompoundCollider::UpdateFromModel(const AnimationModel& model)
+{
+	if (children_.size() != model.GetBodyParts().size()) Bind(model);
+	UpdateFromJoints(model.GetJoints(), model.GetWorldMatrix());
+}
+
+
+/// -------------------------------------------------------------
+///				　			　描画処理
+/// -------------------------------------------------------------
+void CompoundCollider::Draw()
+{
+	Collider::Draw();
+	if (!IsCapsuleVisible()) return;
+
+	const Vector4 color = { 0.0f, 1.0f, 0.0f, 1.0f };
+	for (const Capsule& capsule : childCapsules_)
+	{
+		const Vector3 axis = capsule.GetAxis();
+		if (Vector3::Length(axis) < 1e-6f)
+			Wireframe::GetInstance()->DrawSphere(capsule.segment.origin, capsule.radius, color);
+		else
+			Wireframe::GetInstance()->DrawCapsule(capsule.GetCenter(), capsule.radius, capsule.GetHeight(), axis, 8, color);
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　			子の ImGui
+/// -------------------------------------------------------------
+void CompoundCollider::DrawChildrenImGui()
+{
+	const Capsule bound = GetCapsule();
+	ImGui::Text("Parts : %u (bound radius %.2f)", GetChildCount(), bound.radius);
+
+	for (size_t i = 0; i < children_.size(); ++i)
+	{
+		if (ImGui::TreeNode(children_[i].name.c_str()))
+		{
+			ImGui::Text("Joint : %d -> %d", children_[i].startJoint, children_[i].endJoint);
+			ImGui::DragFloat("Radius", &children_[i].radius, 0.01f, 0.0f, 2.0f);
+			ImGui::TreePop();
+		}
+	}
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "Collider.h"
+#include "Matrix4x4.h"
+
+/// ---------- 前方宣言 ---------- ///
+class AnimationModel;
+struct Joint;
+
+
+/// -------------------------------------------------------------
+///		複合コライダー（外形のカプセル1つ＋ジョイントに付いた子カプセル）
+/// -------------------------------------------------------------
+class CompoundCollider : public Collider
+{
+public: /// ---------- 構造体 ---------- ///
+
+	// 子の定義（endJoint が負なら startJoint の位置 + offset を中心にした球）
+	struct Child
+	{
+		std::string name;
+		int32_t startJoint = -1;
+		int32_t endJoint = -1;
+		Vector3 offset{};
+		float radius = 0.0f;
+	};
+
+public: /// ---------- メンバ関数 ---------- ///
+
+	// モデルのボディパーツから子を作り直す（名前を読むのはここだけ）
+	void Bind(const AnimationModel& model);
+
+	// 子を追加・全削除（Bind を使わずに組み立てるとき）
+	void AddChild(const Child& child);
+	void ClearChildren();
+
+	// 骨の今の姿勢から子カプセルと外形をその場で書き換える（確保も名前の検索もしない）
+	void UpdateFromJoints(const std::vector<Joint>& joints, const Matrix4x4& worldMatrix);
+
+	// モデルから更新（ボディパーツの数が変わっていたら Bind し直す）
+	void UpdateFromModel(const AnimationModel& model);
+
+	// 描画処理（外形に加えて、SetCapsuleVisible で表示したときは子カプセルも）
+	void Draw() override;
+
+	// 子ごとの ImGui（呼び出し側のウィンドウ内に描く）
+	void DrawChildrenImGui();
+
+public: /// ---------- ゲッター ---------- ///
+
+	// 子カプセル（外形に当たったときだけ CollisionManager が調べる）
+	std::span<const Capsule> GetChildCapsules() const override { return childCapsules_; }
+
+	uint32_t GetChildCount() const { return static_cast<uint32_t>(children_.size()); }
+	const Child& GetChild(uint32_t index) const { return children_[index]; }
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	std::vector<Child> children_;
+	std::vector<Capsule> childCapsules_; // children_ と同じ並び（segment.diff は終点）
+	std::vector<Vector3> jointPositions_; // 骨のワールド座標（UpdateFromJoints の作業用）
+};
@@ -1,5 +1,6 @@
 #include "ContactRecord.h"
 #include <algorithm>
+#include <cassert>
 
 
 /// -------------------------------------------------------------
@@ -7,26 +8,135 @@
 /// -------------------------------------------------------------
 void ContactRecord::Add(uint32_t number)
 {
-	// 履歴に登録
-	record_.push_back(number);
+	// 履歴に登録（すでにあれば最後に接触したフレームだけ更新）
+	Touch(number);
 }
 
 
 /// -------------------------------------------------------------
 ///						履歴を確認する処理
 /// -------------------------------------------------------------
-bool ContactRecord::Check(uint32_t number)
+bool ContactRecord::Check(uint32_t number) const
 {
 	// 履歴があるか確認
-	return std::any_of(record_.begin(), record_.end(), [number](uint32_t log) { return log == number; });
+	return Find(number) != nullptr;
+}
+
+
+/// -------------------------------------------------------------
+///					このフレームの接触を記録する処理
+/// -------------------------------------------------------------
+ContactRecord::State ContactRecord::Touch(uint32_t number)
+{
+	bool inserted = false;
+	Entry& entry = FindOrInsert(number, inserted);
+
+	// 初めての接触か、1フレーム以上離れていたら接触し直し
+	if (inserted || entry.lastFrame + 1 < frame_)
+	{
+		entry.firstFrame = frame_;
+	}
+	entry.lastFrame = frame_;
+
+	return (entry.firstFrame == frame_) ? State::kEnter : State::kStay;
+}
+
+
+/// -------------------------------------------------------------
+///						接触の状態を取得する処理
+/// -------------------------------------------------------------
+ContactRecord::State ContactRecord::GetState(uint32_t number) const
+{
+	const Entry* entry = Find(number);
+	if (!entry) return State::kNone;
+
+	if (entry->lastFrame == frame_) return (entry->firstFrame == frame_) ? State::kEnter : State::kStay;
+	if (entry->lastFrame + 1 == frame_) return State::kExit;
+	return State::kNone;
 }
 
 
 /// -------------------------------------------------------------
 ///						履歴を削除する処理
 /// -------------------------------------------------------------
-void ContactRecord::Crear()
+void ContactRecord::Clear()
+{
+	// 確保済みの領域はそのまま使い回す
+	Entry* slots = Slots();
+	std::fill(slots, slots + capacity_, Entry{});
+	count_ = 0;
+}
+
+
+/// -------------------------------------------------------------
+///							検索処理
+/// -------------------------------------------------------------
+const ContactRecord::Entry* ContactRecord::Find(uint32_t number) const
 {
-	// 履歴を削除
-	record_.clear();
+	// 空きの印は登録されない
+	if (number == kEmpty) return nullptr;
+
+	// 使用率は半分以下なので必ず空きスロットで止まる
+	const Entry* slots = Slots();
+	const uint32_t mask = capacity_ - 1;
+	for (uint32_t i = Hash(number);; i = (i + 1) & mask)
+	{
+		if (slots[i].number == number) return &slots[i];
+		if (slots[i].number == kEmpty) return nullptr;
+	}
+}
+
+
+/// -------------------------------------------------------------
+///							挿入処理
+/// -------------------------------------------------------------
+ContactRecord::Entry& ContactRecord::FindOrInsert(uint32_t number, bool& inserted)
+{
+	inserted = false;
+
+	// 空きを示す値は登録できない（IDGenerator は発行しない）
+	assert(number != kEmpty);
+
+	// 使用率が半分を超えるなら広げておく
+	if ((count_ + 1) * 2 > capacity_) Grow();
+
+	Entry* slots = Slots();
+	const uint32_t mask = capacity_ - 1;
+	for (uint32_t i = Hash(number);; i = (i + 1) & mask)
+	{
+		if (slots[i].number == number) return slots[i];
+		if (slots[i].number == kEmpty)
+		{
+			slots[i].number = number;
+			++count_;
+			inserted = true;
+			return slots[i];
+		}
+	}
+}
+
+
+/// -------------------------------------------------------------
+///						容量を広げる処理
+/// -------------------------------------------------------------
+void ContactRecord::Grow()
+{
+	const Entry* oldSlots = Slots();
+	const uint32_t oldCapacity = capacity_;
+
+	// 新しい配列に入れ直す（削除はしないのでトゥームストーンは不要）
+	std::vector<Entry> newSlots(oldCapacity * 2);
+	capacity_ = oldCapacity * 2;
+	const uint32_t mask = capacity_ - 1;
+
+	for (uint32_t j = 0; j < oldCapacity; ++j)
+	{
+		if (oldSlots[j].number == kEmpty) continue;
+
+		uint32_t i = Hash(oldSlots[j].number);
+		while (newSlots[i].number != kEmpty) i = (i + 1) & mask;
+		newSlots[i] = oldSlots[j];
+	}
+
+	heap_ = std::move(newSlots);
 }
@@ -1,27 +1,114 @@
 #pragma once
+#include <array>
+#include <cstdint>
 #include <vector>
 
+#include "IDGenerator.h"
+
 
 /// -------------------------------------------------------------
 ///						　接触履歴クラス
 /// -------------------------------------------------------------
 class ContactRecord
 {
+public: /// ---------- 列挙型 ---------- ///
+
+	// フレームをまたいだ接触の状態
+	enum class State
+	{
+		kNone,  // 接触していない
+		kEnter, // このフレームで接触し始めた（初めて、または1フレーム以上離れてから）
+		kStay,  // 前フレームから接触し続けている
+		kExit,  // 前フレームまで接触していて、このフレームは離れている
+	};
+
 public: /// ---------- メンバ関数 ---------- ///
 
-	// 履歴を追加する関数
+	// 履歴を追加する関数（重複は追加しない）
 	void Add(uint32_t number);
 
 	// 履歴を確認する関数
-	bool Check(uint32_t number);
+	bool Check(uint32_t number) const;
+
+	// このフレームの接触を記録して状態を返す（kEnter / kStay）
+	State Touch(uint32_t number);
+
+	// 接触の状態を取得（このフレームの衝突判定のあとに呼ぶ）
+	State GetState(uint32_t number) const;
+
+	// このフレームで離れた相手を列挙（衝突判定のあと、次の NextFrame の前に呼ぶ）
+	template <typename Func>
+	void ForEachExit(Func&& func) const;
+
+	// フレームを進める（持ち主が衝突判定の前に毎フレーム1回呼ぶ）
+	void NextFrame() { ++frame_; }
 
 	// 履歴を削除する関数
-	void Crear();
+	void Clear();
+
+	// 旧名（互換用）
+	void Crear() { Clear(); }
+
+public: /// ---------- ゲッター ---------- ///
+
+	// 記録されている相手の数
+	uint32_t GetCount() const { return count_; }
+
+private: /// ---------- 構造体・定数 ---------- ///
+
+	// 1件分の履歴
+	struct Entry
+	{
+		uint32_t number = kEmpty;
+		uint32_t firstFrame = 0; // 接触し始めたフレーム
+		uint32_t lastFrame = 0;  // 最後に接触したフレーム
+	};
+
+	// 空きスロットの印（IDGenerator が発行しない値なので相手のIDと重ならない）
+	static constexpr uint32_t kEmpty = IDGenerator::kInvalidID;
+
+	// 内部に持つスロット数（8件まではヒープを使わない）
+	static constexpr uint32_t kInlineCapacity = 16;
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	// 現在のスロット配列
+	Entry* Slots() { return heap_.empty() ? inline_.data() : heap_.data(); }
+	const Entry* Slots() const { return heap_.empty() ? inline_.data() : heap_.data(); }
+
+	// 検索（なければ nullptr）と挿入
+	const Entry* Find(uint32_t number) const;
+	Entry& FindOrInsert(uint32_t number, bool& inserted);
+
+	// 容量を倍にして入れ直す
+	void Grow();
+
+	// ハッシュ（フィボナッチハッシュ）
+	uint32_t Hash(uint32_t number) const { return (number * 2654435769u) & (capacity_ - 1); }
 
 private: /// ---------- メンバ変数 ---------- ///
 
-	// 履歴を記録する変数
-	std::vector<uint32_t> record_;
+	// 履歴を記録する変数（オープンアドレス法。容量は2の累乗で使用率は半分まで）
+	std::array<Entry, kInlineCapacity> inline_{};
+	std::vector<Entry> heap_;
+	uint32_t capacity_ = kInlineCapacity;
+	uint32_t count_ = 0;
 
+	// 現在のフレーム
+	uint32_t frame_ = 1;
 };
 
+
+/// -------------------------------------------------------------
+///				　このフレームで離れた相手を列挙
+/// -------------------------------------------------------------
+template<typename Func>
+inline void ContactRecord::ForEachExit(Func&& func) const
+{
+	// 前のフレームまで触れていて、このフレームは Touch されなかった相手
+	const Entry* slots = Slots();
+	for (uint32_t i = 0; i < capacity_; ++i)
+	{
+		if (slots[i].number != kEmpty && slots[i].lastFrame + 1 == frame_) func(slots[i].number);
+	}
+}
@@ -0,0 +1,351 @@
+#define NOMINMAX
+#include "DynamicAABBTree.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+
+/// -------------------------------------------------------------
+///				　		プロキシの生成
+/// -------------------------------------------------------------
+int32_t DynamicAABBTree::CreateProxy(const AABB& aabb, void* userData)
+{
+	const int32_t proxyId = AllocateNode();
+
+	// マージン分だけ太らせて格納
+	const Vector3 margin = { kAABBMargin, kAABBMargin, kAABBMargin };
+	Node& node = nodes_[proxyId];
+	node.aabb.min = aabb.min - margin;
+	node.aabb.max = aabb.max + margin;
+	node.userData = userData;
+	node.height = 0;
+
+	InsertLeaf(proxyId);
+	++proxyCount_;
+
+	return proxyId;
+}
+
+
+/// -------------------------------------------------------------
+///				　		プロキシの破棄
+/// -------------------------------------------------------------
+void DynamicAABBTree::DestroyProxy(int32_t proxyId)
+{
+	assert(0 <= proxyId && proxyId < static_cast<int32_t>(nodes_.size()));
+	assert(nodes_[proxyId].IsLeaf());
+
+	RemoveLeaf(proxyId);
+	FreeNode(proxyId);
+	--proxyCount_;
+}
+
+
+/// -------------------------------------------------------------
+///				　		プロキシの移動
+/// -------------------------------------------------------------
+bool DynamicAABBTree::MoveProxy(int32_t proxyId, const AABB& aabb, const Vector3& displacement)
+{
+	assert(0 <= proxyId && proxyId < static_cast<int32_t>(nodes_.size()));
+	assert(nodes_[proxyId].IsLeaf());
+
+	// 太いAABBに収まっている間はツリーを触らない
+	if (Contains(nodes_[proxyId].aabb, aabb)) return false;
+
+	RemoveLeaf(proxyId);
+
+	// マージンと移動方向への先読みで太らせる
+	AABB fat = aabb;
+	const Vector3 margin = { kAABBMargin, kAABBMargin, kAABBMargin };
+	fat.min -= margin;
+	fat.max += margin;
+
+	const Vector3 d = displacement * kDisplacementMultiplier;
+	if (d.x < 0.0f) fat.min.x += d.x; else fat.max.x += d.x;
+	if (d.y < 0.0f) fat.min.y += d.y; else fat.max.y += d.y;
+	if (d.z < 0.0f) fat.min.z += d.z; else fat.max.z += d.z;
+
+	nodes_[proxyId].aabb = fat;
+
+	InsertLeaf(proxyId);
+	return true;
+}
+
+
+/// -------------------------------------------------------------
+///				　			全削除
+/// -------------------------------------------------------------
+void DynamicAABBTree::Clear()
+{
+	nodes_.clear();
+	root_ = kNullNode;
+	freeList_ = kNullNode;
+	proxyCount_ = 0;
+}
+
+
+/// -------------------------------------------------------------
+///				　		ノードの確保
+/// -------------------------------------------------------------
+int32_t DynamicAABBTree::AllocateNode()
+{
+	// 空きがなければ末尾に追加（vectorの伸長はまとめて起こる）
+	if (freeList_ == kNullNode)
+	{
+		nodes_.emplace_back();
+		return static_cast<int32_t>(nodes_.size() - 1);
+	}
+
+	const int32_t nodeId = freeList_;
+	Node& node = nodes_[nodeId];
+	freeList_ = node.parentOrNext;
+
+	node = Node{};
+	return nodeId;
+}
+
+
+/// -------------------------------------------------------------
+///				　		ノードの解放
+/// -------------------------------------------------------------
+void DynamicAABBTree::FreeNode(int32_t nodeId)
+{
+	Node& node = nodes_[nodeId];
+	node.parentOrNext = freeList_;
+	node.child1 = kNullNode;
+	node.child2 = kNullNode;
+	node.userData = nullptr;
+	node.height = -1;
+	freeList_ = nodeId;
+}
+
+
+/// -------------------------------------------------------------
+///				　			葉の挿入
+/// -------------------------------------------------------------
+void DynamicAABBTree::InsertLeaf(int32_t leaf)
+{
+	if (root_ == kNullNode)
+	{
+		root_ = leaf;
+		nodes_[root_].parentOrNext = kNullNode;
+		return;
+	}
+
+	// 表面積の増加が最小になる兄弟を探す
+	const AABB leafAABB = nodes_[leaf].aabb;
+	int32_t index = root_;
+	while (!nodes_[index].IsLeaf())
+	{
+		const Node& node = nodes_[index];
+		const int32_t child1 = node.child1;
+		const int32_t child2 = node.child2;
+
+		const float area = SurfaceArea(node.aabb);
+		const float combinedArea = SurfaceArea(Combine(node.aabb, leafAABB));
+
+		// ここに新しい親を作るコスト
+		const float cost = 2.0f * combinedArea;
+
+		// さらに下りる場合に祖先が払う増分
+		const float inheritanceCost = 2.0f * (combinedArea - area);
+
+		auto descendCost = [&](int32_t child) {
+			const AABB combined = Combine(leafAABB, nodes_[child].aabb);
+			if (nodes_[child].IsLeaf()) return SurfaceArea(combined) + inheritanceCost;
+			return SurfaceArea(combined) - SurfaceArea(nodes_[child].aabb) + inheritanceCost;
+			};
+
+		const float cost1 = descendCost(child1);
+		const float cost2 = descendCost(child2);
+
+		if (cost < cost1 && cost < cost2) break;
+
+		index = (cost1 < cost2) ? child1 : child2;
+	}
+
+	const int32_t sibling = index;
+
+	// 兄弟と葉をまとめる新しい親を作る
+	const int32_t oldParent = nodes_[sibling].parentOrNext;
+	const int32_t newParent = AllocateNode();
+	nodes_[newParent].parentOrNext = oldParent;
+	nodes_[newParent].aabb = Combine(leafAABB, nodes_[sibling].aabb);
+	nodes_[newParent].height = nodes_[sibling].height + 1;
+	nodes_[newParent].child1 = sibling;
+	nodes_[newParent].child2 = leaf;
+	nodes_[sibling].parentOrNext = newParent;
+	nodes_[leaf].parentOrNext = newParent;
+
+	if (oldParent != kNullNode)
+	{
+		if (nodes_[oldParent].child1 == sibling) nodes_[oldParent].child1 = newParent;
+		else nodes_[oldParent].child2 = newParent;
+	}
+	else
+	{
+		root_ = newParent;
+	}
+
+	// 祖先をたどって高さとAABBを更新しつつ平衡化
+	index = nodes_[leaf].parentOrNext;
+	while (index != kNullNode)
+	{
+		index = Balance(index);
+
+		const int32_t child1 = nodes_[index].child1;
+		const int32_t child2 = nodes_[index].child2;
+		nodes_[index].height = 1 + std::max(nodes_[child1].height, nodes_[child2].height);
+		nodes_[index].aabb = Combine(nodes_[child1].aabb, nodes_[child2].aabb);
+
+		index = nodes_[index].parentOrNext;
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　			葉の削除
+/// -------------------------------------------------------------
+void DynamicAABBTree::RemoveLeaf(int32_t leaf)
+{
+	if (leaf == root_)
+	{
+		root_ = kNullNode;
+		return;
+	}
+
+	const int32_t parent = nodes_[leaf].parentOrNext;
+	const int32_t grandParent = nodes_[parent].parentOrNext;
+	const int32_t sibling = (nodes_[parent].child1 == leaf) ? nodes_[parent].child2 : nodes_[parent].child1;
+
+	if (grandParent != kNullNode)
+	{
+		// 親を消して兄弟を祖父につなぎ直す
+		if (nodes_[grandParent].child1 == parent) nodes_[grandParent].child1 = sibling;
+		else nodes_[grandParent].child2 = sibling;
+		nodes_[sibling].parentOrNext = grandParent;
+		FreeNode(parent);
+
+		// 祖先を更新
+		int32_t index = grandParent;
+		while (index != kNullNode)
+		{
+			index = Balance(index);
+
+			const int32_t child1 = nodes_[index].child1;
+			const int32_t child2 = nodes_[index].child2;
+			nodes_[index].aabb = Combine(nodes_[child1].aabb, nodes_[child2].aabb);
+			nodes_[index].height = 1 + std::max(nodes_[child1].height, nodes_[child2].height);
+
+			index = nodes_[index].parentOrNext;
+		}
+	}
+	else
+	{
+		root_ = sibling;
+		nodes_[sibling].parentOrNext = kNullNode;
+		FreeNode(parent);
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　		回転による平衡化
+/// -------------------------------------------------------------
+int32_t DynamicAABBTree::Balance(int32_t iA)
+{
+	Node& A = nodes_[iA];
+	if (A.IsLeaf() || A.height < 2) return iA;
+
+	const int32_t iB = A.child1;
+	const int32_t iC = A.child2;
+	Node& B = nodes_[iB];
+	Node& C = nodes_[iC];
+
+	const int32_t balance = C.height - B.height;
+
+	// 重い側の子を持ち上げる（C と B は対称な処理）
+	auto rotate = [&](int32_t iHeavy, int32_t iLight, bool heavyIsChild2) {
+		Node& heavy = nodes_[iHeavy];
+		Node& light = nodes_[iLight];
+		const int32_t iF = heavy.child1;
+		const int32_t iG = heavy.child2;
+		Node& F = nodes_[iF];
+		Node& G = nodes_[iG];
+
+		// heavy を A の位置へ
+		heavy.child1 = iA;
+		heavy.parentOrNext = A.parentOrNext;
+		A.parentOrNext = iHeavy;
+
+		if (heavy.parentOrNext != kNullNode)
+		{
+			if (nodes_[heavy.parentOrNext].child1 == iA) nodes_[heavy.parentOrNext].child1 = iHeavy;
+			else nodes_[heavy.parentOrNext].child2 = iHeavy;
+		}
+		else
+		{
+			root_ = iHeavy;
+		}
+
+		// 高い方の孫を heavy に残し、低い方を A に渡す
+		const int32_t iKeep = (F.height > G.height) ? iF : iG;
+		const int32_t iGive = (F.height > G.height) ? iG : iF;
+		heavy.child2 = iKeep;
+		if (heavyIsChild2) A.child2 = iGive; else A.child1 = iGive;
+		nodes_[iGive].parentOrNext = iA;
+
+		A.aabb = Combine(light.aabb, nodes_[iGive].aabb);
+		heavy.aabb = Combine(A.aabb, nodes_[iKeep].aabb);
+
+		A.height = 1 + std::max(light.height, nodes_[iGive].height);
+		heavy.height = 1 + std::max(A.height, nodes_[iKeep].height);
+		};
+
+	if (balance > 1)
+	{
+		rotate(iC, iB, true);
+		return iC;
+	}
+
+	if (balance < -1)
+	{
+		rotate(iB, iC, false);
+		return iB;
+	}
+
+	return iA;
+}
+
+
+/// -------------------------------------------------------------
+///				　		AABBの和集合
+/// -------------------------------------------------------------
+AABB DynamicAABBTree::Combine(const AABB& a, const AABB& b)
+{
+	AABB out;
+	out.min = { std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y), std::min(a.min.z, b.min.z) };
+	out.max = { std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y), std::max(a.max.z, b.max.z) };
+	return out;
+}
+
+
+/// -------------------------------------------------------------
+///				　		AABBの表面積
+/// -------------------------------------------------------------
+float DynamicAABBTree::SurfaceArea(const AABB& aabb)
+{
+	const Vector3 d = aabb.max - aabb.min;
+	return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+}
+
+
+/// -------------------------------------------------------------
+///				　		AABBの包含判定
+/// -------------------------------------------------------------
+bool DynamicAABBTree::Contains(const AABB& outer, const AABB& inner)
+{
+	return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+		inner.max.x <= outer.max.x && inner.max.y <= outer.max.y && inner.max.z <= outer.max.z;
+}
@@ -0,0 +1,236 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "AABB.h"
+#include "Vector3.h"
+
+
+/// -------------------------------------------------------------
+///				動的AABBツリー（ブロードフェーズ用BVH）
+/// -------------------------------------------------------------
+class DynamicAABBTree
+{
+public: /// ---------- 定数 ---------- ///
+
+	// 無効なノード
+	static constexpr int32_t kNullNode = -1;
+
+	// 太らせるマージン（小さな移動では再挿入しない）
+	static constexpr float kAABBMargin = 0.1f;
+
+	// 移動量の先読み倍率
+	static constexpr float kDisplacementMultiplier = 2.0f;
+
+public: /// ---------- メンバ関数 ---------- ///
+
+	// プロキシの生成（太らせたAABBで挿入し、プロキシIDを返す）
+	int32_t CreateProxy(const AABB& aabb, void* userData);
+
+	// プロキシの破棄
+	void DestroyProxy(int32_t proxyId);
+
+	// プロキシの移動（太いAABBからはみ出したときだけ再挿入し、trueを返す）
+	bool MoveProxy(int32_t proxyId, const AABB& aabb, const Vector3& displacement);
+
+	// 全削除
+	void Clear();
+
+	// AABBと重なるプロキシを列挙（callback(proxyId) が false で打ち切り）
+	template <typename Callback>
+	void Query(const AABB& aabb, Callback&& callback) const;
+
+	// 線分（origin + diff * t, t ∈ [0, maxT]）と交わるプロキシを近そうな順に列挙
+	// callback(proxyId, maxT) は新しい maxT を返す（縮めると以降の探索が枝刈りされる。0未満で打ち切り）
+	template <typename Callback>
+	void RayCast(const Vector3& origin, const Vector3& diff, float maxT, Callback&& callback) const;
+
+public: /// ---------- ゲッター ---------- ///
+
+	// 太らせたAABB
+	const AABB& GetFatAABB(int32_t proxyId) const { return nodes_[proxyId].aabb; }
+
+	// ユーザーデータ
+	void* GetUserData(int32_t proxyId) const { return nodes_[proxyId].userData; }
+
+	// ツリーの高さ
+	int32_t GetHeight() const { return root_ == kNullNode ? 0 : nodes_[root_].height; }
+
+	// 登録されているプロキシ数
+	uint32_t GetProxyCount() const { return proxyCount_; }
+
+	// AABB同士の重なり
+	static bool Overlaps(const AABB& a, const AABB& b)
+	{
+		return a.min.x <= b.max.x && a.max.x >= b.min.x &&
+			a.min.y <= b.max.y && a.max.y >= b.min.y &&
+			a.min.z <= b.max.z && a.max.z >= b.min.z;
+	}
+
+private: /// ---------- 構造体 ---------- ///
+
+	// ノード（葉がプロキシ、内部ノードは子の和集合）
+	struct Node
+	{
+		AABB aabb{};
+		void* userData = nullptr;
+
+		// 使用中は親、空きリスト中は次の空きノード
+		int32_t parentOrNext = kNullNode;
+
+		int32_t child1 = kNullNode;
+		int32_t child2 = kNullNode;
+
+		// 葉 = 0, 空き = -1
+		int32_t height = -1;
+
+		bool IsLeaf() const { return child1 == kNullNode; }
+	};
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	// ノードの確保・解放
+	int32_t AllocateNode();
+	void FreeNode(int32_t nodeId);
+
+	// 葉の挿入・削除
+	void InsertLeaf(int32_t leaf);
+	void RemoveLeaf(int32_t leaf);
+
+	// 回転による平衡化（新しい部分木の根を返す）
+	int32_t Balance(int32_t iA);
+
+	// 和集合と表面積
+	static AABB Combine(const AABB& a, const AABB& b);
+	static float SurfaceArea(const AABB& aabb);
+	static bool Contains(const AABB& outer, const AABB& inner);
+
+	// 線分がAABBに入る t（範囲外なら false。invDiff は diff の逆数で、0成分は無限大）
+	static bool RayEnter(const AABB& aabb, const Vector3& origin, const Vector3& invDiff, float maxT, float& tEnter);
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	std::vector<Node> nodes_;
+	int32_t root_ = kNullNode;
+	int32_t freeList_ = kNullNode;
+	uint32_t proxyCount_ = 0;
+};
+
+
+/// -------------------------------------------------------------
+///				　AABBと重なるプロキシを列挙
+/// -------------------------------------------------------------
+template<typename Callback>
+inline void DynamicAABBTree::Query(const AABB& aabb, Callback&& callback) const
+{
+	if (root_ == kNullNode) return;
+
+	// 平衡化されているので深さは十分小さい（スタックは固定長で確保しない）
+	std::array<int32_t, 256> stack;
+	int32_t top = 0;
+	stack[top++] = root_;
+
+	while (top > 0)
+	{
+		const int32_t nodeId = stack[--top];
+		const Node& node = nodes_[nodeId];
+
+		if (!Overlaps(node.aabb, aabb)) continue;
+
+		if (node.IsLeaf())
+		{
+			if (!callback(nodeId)) return;
+		}
+		else
+		{
+			stack[top++] = node.child1;
+			stack[top++] = node.child2;
+		}
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　線分と交わるプロキシを列挙
+/// -------------------------------------------------------------
+template<typename Callback>
+inline void DynamicAABBTree::RayCast(const Vector3& origin, const Vector3& diff, float maxT, Callback&& callback) const
+{
+	if (root_ == kNullNode) return;
+
+	const Vector3 invDiff = {
+		diff.x != 0.0f ? 1.0f / diff.x : std::numeric_limits<float>::infinity(),
+		diff.y != 0.0f ? 1.0f / diff.y : std::numeric_limits<float>::infinity(),
+		diff.z != 0.0f ? 1.0f / diff.z : std::numeric_limits<float>::infinity(),
+	};
+
+	// 積むときに入る t も持っておき、取り出すときは縮んだ maxT と比べるだけにする
+	struct Entry { int32_t nodeId; float tEnter; };
+	std::array<Entry, 256> stack;
+	int32_t top = 0;
+
+	float tRoot = 0.0f;
+	if (!RayEnter(nodes_[root_].aabb, origin, invDiff, maxT, tRoot)) return;
+	stack[top++] = { root_, tRoot };
+
+	while (top > 0)
+	{
+		const Entry entry = stack[--top];
+
+		// 前の葉で maxT が縮んでいれば枝刈り
+		if (entry.tEnter > maxT) continue;
+
+		const Node& node = nodes_[entry.nodeId];
+		if (node.IsLeaf())
+		{
+			maxT = callback(entry.nodeId, maxT);
+			if (maxT < 0.0f) return;
+			continue;
+		}
+
+		// 入る t が遠い方を先に積んで、近い方から調べる
+		float t1 = 0.0f;
+		float t2 = 0.0f;
+		const bool hit1 = RayEnter(nodes_[node.child1].aabb, origin, invDiff, maxT, t1);
+		const bool hit2 = RayEnter(nodes_[node.child2].aabb, origin, invDiff, maxT, t2);
+
+		if (hit1 && hit2)
+		{
+			if (t1 <= t2) { stack[top++] = { node.child2, t2 }; stack[top++] = { node.child1, t1 }; }
+			else { stack[top++] = { node.child1, t1 }; stack[top++] = { node.child2, t2 }; }
+		}
+		else if (hit1) stack[top++] = { node.child1, t1 };
+		else if (hit2) stack[top++] = { node.child2, t2 };
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　線分がAABBに入る t
+/// -------------------------------------------------------------
+inline bool DynamicAABBTree::RayEnter(const AABB& aabb, const Vector3& origin, const Vector3& invDiff, float maxT, float& tEnter)
+{
+	float tMin = 0.0f;
+	float tMax = maxT;
+	for (int i = 0; i < 3; ++i)
+	{
+		// 0成分は無限大になるので、範囲外なら必ず空区間になる（0 * 無限大の NaN は比較で落ちる）
+		float t0 = (aabb.min[i] - origin[i]) * invDiff[i];
+		float t1 = (aabb.max[i] - origin[i]) * invDiff[i];
+		if (t0 > t1) { const float tmp = t0; t0 = t1; t1 = tmp; }
+
+		if (!(t0 <= tMax) || !(t1 >= tMin))
+		{
+			// 軸に平行で始点がちょうど面上にある場合（NaN）は範囲内なら通す
+			if (invDiff[i] == std::numeric_limits<float>::infinity() && origin[i] >= aabb.min[i] && origin[i] <= aabb.max[i]) continue;
+			return false;
+		}
+		if (t0 > tMin) tMin = t0;
+		if (t1 < tMax) tMax = t1;
+	}
+
+	tEnter = tMin;
+	return true;
+}
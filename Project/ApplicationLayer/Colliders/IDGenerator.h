@@ -1,4 +1,5 @@
 #pragma once
+#include <cassert>
 #include <cstdint>
 
 /// -------------------------------------------------------------
@@ -6,10 +7,15 @@
 /// -------------------------------------------------------------
 class IDGenerator
 {
+public: /// ---------- 定数 ---------- ///
+
+	// 無効なID（ContactRecord が空きスロットの印に使うので発行しない）
+	static constexpr uint32_t kInvalidID = ~0u;
+
 public: /// ---------- メンバ関数 ---------- ///
 
 	// IDを生成
-	static uint32_t Generate() { return nextID_++; }
+	static uint32_t Generate() { assert(nextID_ != kInvalidID); return nextID_++; }
 
 	// IDをリセット
 	static void Reset() { nextID_ = 0; }
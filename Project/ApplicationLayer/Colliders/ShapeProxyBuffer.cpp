@@ -0,0 +1,275 @@
+#define NOMINMAX
+#include "ShapeProxyBuffer.h"
+#include "Collider.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+/// -------------------------------------------------------------
+///				　			スロットの追加
+/// -------------------------------------------------------------
+uint32_t ShapeProxyBuffer::AddSlot(const Collider& collider)
+{
+	const uint32_t slot = GetCount();
+
+	// 型は UpdateSlot で読み込んだときに一覧へ入れる
+	typeIds_.push_back(kMaxTypes);
+	uniqueIds_.push_back(collider.GetUniqueID());
+	flags_.push_back(0);
+	obbCenters_.push_back({});
+	obbAxes_.push_back({});
+	obbHalfSizes_.push_back({});
+	capsules_.push_back({});
+	segments_.push_back({});
+	spheres_.push_back({});
+	children_.push_back({});
+	bounds_.push_back({});
+	typeIndices_.push_back(0);
+
+	return slot;
+}
+
+
+/// -------------------------------------------------------------
+///				　			スロットの削除
+/// -------------------------------------------------------------
+void ShapeProxyBuffer::RemoveSlot(uint32_t slot)
+{
+	const uint32_t last = GetCount() - 1;
+	RemoveFromTypeList(slot);
+
+	// 末尾を空いた位置に移して詰める
+	auto moveLast = [&](auto& values) {
+		if (slot != last) values[slot] = values[last];
+		values.pop_back();
+		};
+	moveLast(typeIds_);
+	moveLast(uniqueIds_);
+	moveLast(flags_);
+	moveLast(obbCenters_);
+	moveLast(obbAxes_);
+	moveLast(obbHalfSizes_);
+	moveLast(capsules_);
+	moveLast(segments_);
+	moveLast(spheres_);
+	moveLast(children_);
+	moveLast(bounds_);
+	moveLast(typeIndices_);
+
+	// 移したスロットの番号を型ごとの一覧でも書き換える
+	if (slot != last && typeIds_[slot] < kMaxTypes) slotsByType_[typeIds_[slot]][typeIndices_[slot]] = slot;
+}
+
+
+/// -------------------------------------------------------------
+///				　		スロットの形状の読み直し
+/// -------------------------------------------------------------
+void ShapeProxyBuffer::UpdateSlot(uint32_t slot, const Collider& collider)
+{
+	const OBB obb = collider.GetOBB();
+	obbCenters_[slot] = obb.center;
+	obbAxes_[slot] = { obb.orientations[0], obb.orientations[1], obb.orientations[2] };
+	obbHalfSizes_[slot] = obb.size;
+
+	capsules_[slot] = collider.GetCapsule();
+	segments_[slot] = collider.GetSegment();
+	spheres_[slot] = collider.GetSphere();
+	children_[slot] = collider.GetChildCapsules();
+
+	uint8_t flags = 0;
+	if (obb.size.x > 0.0f || obb.size.y > 0.0f || obb.size.z > 0.0f) flags |= kHasOBB;
+	if (Vector3::Dot(segments_[slot].diff, segments_[slot].diff) > 0.0f) flags |= kHasSegment;
+	if (collider.HasSphere()) flags |= kHasSphere;
+	if (collider.HasCapsule()) flags |= kHasCapsule;
+	if (collider.HasCapsule() && !children_[slot].empty()) flags |= kHasChildren;
+	flags_[slot] = flags;
+
+	// 型が変わったときだけ一覧を入れ替える
+	const uint32_t typeID = collider.GetTypeID();
+	if (typeIds_[slot] != typeID)
+	{
+		RemoveFromTypeList(slot);
+		typeIds_[slot] = typeID;
+		AddToTypeList(slot);
+	}
+
+	bounds_[slot] = ComputeBounds(slot);
+}
+
+
+/// -------------------------------------------------------------
+///				　				全削除
+/// -------------------------------------------------------------
+void ShapeProxyBuffer::Clear()
+{
+	typeIds_.clear();
+	uniqueIds_.clear();
+	flags_.clear();
+	obbCenters_.clear();
+	obbAxes_.clear();
+	obbHalfSizes_.clear();
+	capsules_.clear();
+	segments_.clear();
+	spheres_.clear();
+	children_.clear();
+	bounds_.clear();
+	typeIndices_.clear();
+	for (auto& slots : slotsByType_) slots.clear();
+}
+
+
+/// -------------------------------------------------------------
+///				　	型ごとのスロット一覧への追加・削除
+/// -------------------------------------------------------------
+void ShapeProxyBuffer::AddToTypeList(uint32_t slot)
+{
+	const uint32_t typeID = typeIds_[slot];
+	if (typeID >= kMaxTypes) return;
+
+	typeIndices_[slot] = static_cast<uint32_t>(slotsByType_[typeID].size());
+	slotsByType_[typeID].push_back(slot);
+}
+
+void ShapeProxyBuffer::RemoveFromTypeList(uint32_t slot)
+{
+	const uint32_t typeID = typeIds_[slot];
+	if (typeID >= kMaxTypes) return;
+
+	// 一覧の末尾を空いた位置に移す
+	std::vector<uint32_t>& slots = slotsByType_[typeID];
+	const uint32_t index = typeIndices_[slot];
+	const uint32_t moved = slots.back();
+	slots[index] = moved;
+	typeIndices_[moved] = index;
+	slots.pop_back();
+}
+
+
+/// -------------------------------------------------------------
+///				　			OBBの組み立て
+/// -------------------------------------------------------------
+OBB ShapeProxyBuffer::GetOBB(uint32_t slot) const
+{
+	OBB obb{};
+	obb.center = obbCenters_[slot];
+	obb.orientations[0] = obbAxes_[slot][0];
+	obb.orientations[1] = obbAxes_[slot][1];
+	obb.orientations[2] = obbAxes_[slot][2];
+	obb.size = obbHalfSizes_[slot];
+	return obb;
+}
+
+
+/// -------------------------------------------------------------
+///				　	一括判定用のカプセルを詰める
+/// -------------------------------------------------------------
+void ShapeProxyBuffer::GatherCapsules(const uint32_t* slots, uint32_t count, CapsuleBatch& out) const
+{
+	// 使わないレーンは半径0の点にしておく（結果はマスクで捨てられる）
+	out = CapsuleBatch{};
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		const Capsule& capsule = capsules_[slots[i]];
+		out.ax[i] = capsule.segment.origin.x;
+		out.ay[i] = capsule.segment.origin.y;
+		out.az[i] = capsule.segment.origin.z;
+		out.bx[i] = capsule.segment.diff.x;
+		out.by[i] = capsule.segment.diff.y;
+		out.bz[i] = capsule.segment.diff.z;
+		out.radius[i] = capsule.radius;
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　	一括判定用のOBBを詰める
+/// -------------------------------------------------------------
+void ShapeProxyBuffer::GatherOBBs(const uint32_t* slots, uint32_t count, OBBBatch& out) const
+{
+	out = OBBBatch{};
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		const uint32_t slot = slots[i];
+		out.cx[i] = obbCenters_[slot].x;
+		out.cy[i] = obbCenters_[slot].y;
+		out.cz[i] = obbCenters_[slot].z;
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			out.axis[axis][0][i] = obbAxes_[slot][axis].x;
+			out.axis[axis][1][i] = obbAxes_[slot][axis].y;
+			out.axis[axis][2][i] = obbAxes_[slot][axis].z;
+		}
+		out.sx[i] = obbHalfSizes_[slot].x;
+		out.sy[i] = obbHalfSizes_[slot].y;
+		out.sz[i] = obbHalfSizes_[slot].z;
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				使用している形状すべてを囲むAABB
+/// -------------------------------------------------------------
+AABB ShapeProxyBuffer::ComputeBounds(uint32_t slot) const
+{
+	// 形状を持たないコライダーは中心の点として扱う
+	const Vector3 center = obbCenters_[slot];
+	AABB bounds{ center, center };
+	bool hasShape = false;
+
+	auto expand = [&](const Vector3& min, const Vector3& max) {
+		if (!hasShape) { bounds = { min, max }; hasShape = true; return; }
+		bounds.min = { std::min(bounds.min.x, min.x), std::min(bounds.min.y, min.y), std::min(bounds.min.z, min.z) };
+		bounds.max = { std::max(bounds.max.x, max.x), std::max(bounds.max.y, max.y), std::max(bounds.max.z, max.z) };
+		};
+
+	const uint8_t flags = flags_[slot];
+
+	// OBB（判定関数によって size を半サイズとして扱うので大きい方で囲む）
+	if (flags & kHasOBB)
+	{
+		const auto& axes = obbAxes_[slot];
+		const Vector3& size = obbHalfSizes_[slot];
+		Vector3 extent{};
+		for (int i = 0; i < 3; ++i)
+		{
+			extent[i] =
+				std::abs(axes[0][i]) * size.x +
+				std::abs(axes[1][i]) * size.y +
+				std::abs(axes[2][i]) * size.z;
+		}
+		expand(center - extent, center + extent);
+	}
+
+	// 線分（diff は始点からの差分）
+	if (flags & kHasSegment)
+	{
+		const Segment& segment = segments_[slot];
+		const Vector3 end = segment.origin + segment.diff;
+		expand(
+			{ std::min(segment.origin.x, end.x), std::min(segment.origin.y, end.y), std::min(segment.origin.z, end.z) },
+			{ std::max(segment.origin.x, end.x), std::max(segment.origin.y, end.y), std::max(segment.origin.z, end.z) });
+	}
+
+	// 球
+	if (flags & kHasSphere)
+	{
+		const Sphere& sphere = spheres_[slot];
+		const Vector3 r = { sphere.radius, sphere.radius, sphere.radius };
+		expand(sphere.center - r, sphere.center + r);
+	}
+
+	// カプセル（segment.diff は終点として扱われている）
+	if (flags & kHasCapsule)
+	{
+		const Capsule& capsule = capsules_[slot];
+		const Vector3& p0 = capsule.segment.origin;
+		const Vector3& p1 = capsule.segment.diff;
+		const Vector3 r = { capsule.radius, capsule.radius, capsule.radius };
+		expand(
+			Vector3{ std::min(p0.x, p1.x), std::min(p0.y, p1.y), std::min(p0.z, p1.z) } - r,
+			Vector3{ std::max(p0.x, p1.x), std::max(p0.y, p1.y), std::max(p0.z, p1.z) } + r);
+	}
+
+	return bounds;
+}
@@ -0,0 +1,116 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "AABB.h"
+#include "Capsule.h"
+#include "OBB.h"
+#include "Segment.h"
+#include "ShapeBatch.h"
+#include "Sphere.h"
+#include "Vector3.h"
+
+
+/// ---------- 前方宣言 ---------- ///
+class Collider;
+
+
+/// -------------------------------------------------------------
+///	形状プロキシ（登録中のコライダーのワールド形状。変わったスロットだけ読み直す）
+/// -------------------------------------------------------------
+class ShapeProxyBuffer
+{
+public: /// ---------- 定数 ---------- ///
+
+	// コライダーの最大タイプ数
+	static constexpr uint32_t kMaxTypes = 32;
+
+	// 使用している形状のフラグ
+	static constexpr uint8_t kHasOBB = 1 << 0;
+	static constexpr uint8_t kHasSegment = 1 << 1;
+	static constexpr uint8_t kHasSphere = 1 << 2;
+	static constexpr uint8_t kHasCapsule = 1 << 3;
+	static constexpr uint8_t kHasChildren = 1 << 4; // カプセルは外形で、中に子カプセルがある
+
+public: /// ---------- メンバ関数 ---------- ///
+
+	// スロットを末尾に追加（形状は UpdateSlot で読み込むまで空）
+	uint32_t AddSlot(const Collider& collider);
+
+	// スロットを削除（末尾のスロットを空いた位置に移す）
+	void RemoveSlot(uint32_t slot);
+
+	// コライダーから形状を読み直す（仮想関数の呼び出しと回転行列の生成はここだけ）
+	void UpdateSlot(uint32_t slot, const Collider& collider);
+
+	// 削除待ちのスロットをクエリから外す（形状フラグを消すだけで並びは変えない）
+	void DisableSlot(uint32_t slot) { flags_[slot] = 0; }
+
+	// 全削除
+	void Clear();
+
+public: /// ---------- ゲッター ---------- ///
+
+	// スロット数
+	uint32_t GetCount() const { return static_cast<uint32_t>(typeIds_.size()); }
+
+	// 識別ID・形状フラグ（コライダーが破棄された後でも読めるように値で持つ）
+	uint32_t GetTypeID(uint32_t slot) const { return typeIds_[slot]; }
+	uint32_t GetUniqueID(uint32_t slot) const { return uniqueIds_[slot]; }
+	bool HasCapsule(uint32_t slot) const { return (flags_[slot] & kHasCapsule) != 0; }
+	bool HasSphere(uint32_t slot) const { return (flags_[slot] & kHasSphere) != 0; }
+	bool HasOBB(uint32_t slot) const { return (flags_[slot] & kHasOBB) != 0; }
+	bool HasSegment(uint32_t slot) const { return (flags_[slot] & kHasSegment) != 0; }
+	bool HasChildren(uint32_t slot) const { return (flags_[slot] & kHasChildren) != 0; }
+
+	// 形状（OBBは軸をまとめて持っているので組み立てて返す）
+	OBB GetOBB(uint32_t slot) const;
+	const Capsule& GetCapsule(uint32_t slot) const { return capsules_[slot]; }
+	const Segment& GetSegment(uint32_t slot) const { return segments_[slot]; }
+	const Sphere& GetSphere(uint32_t slot) const { return spheres_[slot]; }
+
+	// 子カプセル（持ち主のコライダーの配列を直接指す。持ち主がその場で書き換えるので読み直しは要らない）
+	std::span<const Capsule> GetChildCapsules(uint32_t slot) const { return children_[slot]; }
+
+	// すべての形状を囲むAABB
+	const AABB& GetBounds(uint32_t slot) const { return bounds_[slot]; }
+	const std::vector<AABB>& GetBoundsArray() const { return bounds_; }
+
+	// 型ごとのスロット一覧
+	const std::vector<uint32_t>& GetSlotsOfType(uint32_t typeID) const { return slotsByType_[typeID]; }
+
+	// 一括判定用に指定スロットの形状をSoAに詰める（count ≦ kShapeBatchWidth）
+	void GatherCapsules(const uint32_t* slots, uint32_t count, CapsuleBatch& out) const;
+	void GatherOBBs(const uint32_t* slots, uint32_t count, OBBBatch& out) const;
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	// 使用している形状すべてを囲むAABB
+	AABB ComputeBounds(uint32_t slot) const;
+
+	// 型ごとのスロット一覧への追加・削除（typeIndices_ で位置を持っているので O(1)）
+	void AddToTypeList(uint32_t slot);
+	void RemoveFromTypeList(uint32_t slot);
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	std::vector<uint32_t> typeIds_;
+	std::vector<uint32_t> uniqueIds_;
+	std::vector<uint8_t> flags_;
+
+	// OBB（回転行列は作り直さず軸だけを持つ）
+	std::vector<Vector3> obbCenters_;
+	std::vector<std::array<Vector3, 3>> obbAxes_;
+	std::vector<Vector3> obbHalfSizes_;
+
+	std::vector<Capsule> capsules_;
+	std::vector<Segment> segments_;
+	std::vector<Sphere> spheres_;
+	std::vector<std::span<const Capsule>> children_;
+	std::vector<AABB> bounds_;
+
+	std::array<std::vector<uint32_t>, kMaxTypes> slotsByType_;
+	std::vector<uint32_t> typeIndices_; // スロット → 型ごとの一覧での位置
+};
@@ -0,0 +1,158 @@
+#define NOMINMAX
+#include "SpatialHashGrid.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+
+/// -------------------------------------------------------------
+///				　		グリッドの構築
+/// -------------------------------------------------------------
+void SpatialHashGrid::Build(const std::vector<AABB>& bounds)
+{
+	// 作業領域は前フレームの容量を使い回す
+	bounds_.assign(bounds.begin(), bounds.end());
+	items_.clear();
+	oversized_.clear();
+
+	/// ---------- セルサイズを大きさの中央値から決める ---------- ///
+	extents_.clear();
+	for (const AABB& aabb : bounds_)
+	{
+		const Vector3 size = aabb.max - aabb.min;
+		extents_.push_back(std::max({ size.x, size.y, size.z }));
+	}
+
+	float median = kMinCellSize;
+	if (!extents_.empty())
+	{
+		auto mid = extents_.begin() + extents_.size() / 2;
+		std::nth_element(extents_.begin(), mid, extents_.end());
+		median = *mid;
+	}
+	cellSize_ = std::max(kMinCellSize, median * kCellSizeScale);
+	invCellSize_ = 1.0f / cellSize_;
+
+	/// ---------- テーブル容量（異なるセル数の上限の2倍） ---------- ///
+	uint64_t totalRefs = 0;
+	hasCellBounds_ = false;
+	for (uint32_t i = 0; i < bounds_.size(); ++i)
+	{
+		const uint64_t cells = ToCellRange(bounds_[i]).Count();
+		if (cells > kMaxCellsPerEntry) { oversized_.push_back(i); continue; }
+		totalRefs += cells;
+
+		// セルに入る要素全体の範囲（レイの走査用）
+		const AABB& aabb = bounds_[i];
+		if (!hasCellBounds_) { cellBounds_ = aabb; hasCellBounds_ = true; continue; }
+		cellBounds_.min = { std::min(cellBounds_.min.x, aabb.min.x), std::min(cellBounds_.min.y, aabb.min.y), std::min(cellBounds_.min.z, aabb.min.z) };
+		cellBounds_.max = { std::max(cellBounds_.max.x, aabb.max.x), std::max(cellBounds_.max.y, aabb.max.y), std::max(cellBounds_.max.z, aabb.max.z) };
+	}
+
+	const uint32_t capacity = std::bit_ceil(std::max<uint32_t>(16u, static_cast<uint32_t>(totalRefs * 2)));
+	table_.assign(capacity, Slot{});
+	tableMask_ = capacity - 1;
+	occupiedCellCount_ = 0;
+
+	/// ---------- 1パス目：セルごとの個数を数える ---------- ///
+	for (const AABB& aabb : bounds_)
+	{
+		const CellRange range = ToCellRange(aabb);
+		if (range.Count() > kMaxCellsPerEntry) continue;
+		ForEachCell(range, [&](int32_t x, int32_t y, int32_t z) { ++FindOrInsertSlot(MakeKey(x, y, z)).count; });
+	}
+
+	/// ---------- 開始位置を割り当て、書き込みカーソルに戻す ---------- ///
+	uint32_t running = 0;
+	for (Slot& slot : table_)
+	{
+		if (slot.key == kEmptyKey) continue;
+		slot.start = running;
+		running += slot.count;
+		slot.count = 0;
+	}
+	items_.resize(running);
+
+	/// ---------- 2パス目：要素番号を詰める ---------- ///
+	for (uint32_t i = 0; i < bounds_.size(); ++i)
+	{
+		const CellRange range = ToCellRange(bounds_[i]);
+		if (range.Count() > kMaxCellsPerEntry) continue;
+		ForEachCell(range, [&](int32_t x, int32_t y, int32_t z) {
+			Slot& slot = FindOrInsertSlot(MakeKey(x, y, z));
+			items_[slot.start + slot.count++] = i;
+			});
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　		セル座標への変換
+/// -------------------------------------------------------------
+int32_t SpatialHashGrid::ToCell(float v) const
+{
+	return static_cast<int32_t>(std::floor(v * invCellSize_));
+}
+
+SpatialHashGrid::CellRange SpatialHashGrid::ToCellRange(const AABB& aabb) const
+{
+	return {
+		ToCell(aabb.min.x), ToCell(aabb.min.y), ToCell(aabb.min.z),
+		ToCell(aabb.max.x), ToCell(aabb.max.y), ToCell(aabb.max.z)
+	};
+}
+
+
+/// -------------------------------------------------------------
+///				　	セル座標からキーとハッシュを作る
+/// -------------------------------------------------------------
+uint64_t SpatialHashGrid::MakeKey(int32_t x, int32_t y, int32_t z)
+{
+	// 各軸21ビットに詰める
+	constexpr uint64_t kMask = (1ull << 21) - 1;
+	return ((uint64_t(uint32_t(x)) & kMask) << 42) | ((uint64_t(uint32_t(y)) & kMask) << 21) | (uint64_t(uint32_t(z)) & kMask);
+}
+
+uint32_t SpatialHashGrid::Hash(uint64_t key) const
+{
+	// フィボナッチハッシュ
+	return static_cast<uint32_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & tableMask_;
+}
+
+
+/// -------------------------------------------------------------
+///				　		スロットの検索
+/// -------------------------------------------------------------
+const SpatialHashGrid::Slot* SpatialHashGrid::FindSlot(uint64_t key) const
+{
+	if (table_.empty()) return nullptr;
+
+	// 線形探索で空きに当たったら存在しない
+	for (uint32_t i = Hash(key);; i = (i + 1) & tableMask_)
+	{
+		const Slot& slot = table_[i];
+		if (slot.key == key) return &slot;
+		if (slot.key == kEmptyKey) return nullptr;
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　		スロットの検索・挿入
+/// -------------------------------------------------------------
+SpatialHashGrid::Slot& SpatialHashGrid::FindOrInsertSlot(uint64_t key)
+{
+	for (uint32_t i = Hash(key);; i = (i + 1) & tableMask_)
+	{
+		Slot& slot = table_[i];
+		if (slot.key == key) return slot;
+		if (slot.key == kEmptyKey)
+		{
+			// 容量は参照数の2倍あるので満杯にはならない
+			slot.key = key;
+			++occupiedCellCount_;
+			return slot;
+		}
+	}
+}
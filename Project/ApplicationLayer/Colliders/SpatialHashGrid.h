@@ -0,0 +1,267 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "AABB.h"
+#include "Vector3.h"
+
+
+/// -------------------------------------------------------------
+///			一様空間ハッシュグリッド（ブロードフェーズ用）
+/// -------------------------------------------------------------
+class SpatialHashGrid
+{
+public: /// ---------- 定数 ---------- ///
+
+	// セルサイズの下限
+	static constexpr float kMinCellSize = 0.25f;
+
+	// 中央値の大きさに対するセルサイズの倍率
+	static constexpr float kCellSizeScale = 2.0f;
+
+	// これより多くのセルにまたがるものはセルに入れず別リストで扱う
+	static constexpr uint32_t kMaxCellsPerEntry = 64;
+
+public: /// ---------- メンバ関数 ---------- ///
+
+	// AABB配列から毎フレーム作り直す（要素番号がそのままIDになる）
+	void Build(const std::vector<AABB>& bounds);
+
+	// AABBと重なる要素を列挙（重複なし。callback(index) が false で打ち切り）
+	template <typename Callback>
+	void Query(const AABB& aabb, Callback&& callback) const;
+
+	// 線分（origin + diff * t, t ∈ [0, maxT]）が通るセルの要素を近い順に列挙（複数セルにまたがる要素は重複して報告される）
+	// callback(index, maxT) は新しい maxT を返す（縮めると以降のセルを打ち切る。0未満で打ち切り）
+	template <typename Callback>
+	void RayCast(const Vector3& origin, const Vector3& diff, float maxT, Callback&& callback) const;
+
+public: /// ---------- ゲッター ---------- ///
+
+	// 自動調整されたセルサイズ
+	float GetCellSize() const { return cellSize_; }
+
+	// 使用中のセル数
+	uint32_t GetOccupiedCellCount() const { return occupiedCellCount_; }
+
+	// セルに入らなかった大きな要素の数
+	uint32_t GetOversizedCount() const { return static_cast<uint32_t>(oversized_.size()); }
+
+private: /// ---------- 構造体 ---------- ///
+
+	// セル座標の範囲
+	struct CellRange
+	{
+		int32_t minX, minY, minZ;
+		int32_t maxX, maxY, maxZ;
+
+		uint64_t Count() const
+		{
+			return uint64_t(maxX - minX + 1) * uint64_t(maxY - minY + 1) * uint64_t(maxZ - minZ + 1);
+		}
+	};
+
+	// オープンアドレス法のスロット（セル → items_ の範囲）
+	struct Slot
+	{
+		uint64_t key = kEmptyKey;
+		uint32_t start = 0;
+		uint32_t count = 0;
+	};
+
+	static constexpr uint64_t kEmptyKey = ~0ull;
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	// セル座標・キー・ハッシュ
+	int32_t ToCell(float v) const;
+	CellRange ToCellRange(const AABB& aabb) const;
+	static uint64_t MakeKey(int32_t x, int32_t y, int32_t z);
+	uint32_t Hash(uint64_t key) const;
+
+	// スロットの検索（なければ nullptr）と挿入
+	const Slot* FindSlot(uint64_t key) const;
+	Slot& FindOrInsertSlot(uint64_t key);
+
+	// 範囲のセルを順に処理
+	template <typename Func>
+	static void ForEachCell(const CellRange& range, Func&& func);
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	// 要素のAABB
+	std::vector<AABB> bounds_;
+
+	// セルごとにまとめた要素番号
+	std::vector<uint32_t> items_;
+
+	// セルに入れない大きな要素
+	std::vector<uint32_t> oversized_;
+
+	// セルに入っている要素全体を囲むAABB（レイの走査範囲を絞る）
+	AABB cellBounds_{};
+	bool hasCellBounds_ = false;
+
+	// ハッシュテーブル（容量は2の累乗）
+	std::vector<Slot> table_;
+	uint32_t tableMask_ = 0;
+	uint32_t occupiedCellCount_ = 0;
+
+	// セルサイズ自動調整用の作業領域
+	std::vector<float> extents_;
+
+	float cellSize_ = 1.0f;
+	float invCellSize_ = 1.0f;
+};
+
+
+/// -------------------------------------------------------------
+///				　範囲のセルを順に処理
+/// -------------------------------------------------------------
+template<typename Func>
+inline void SpatialHashGrid::ForEachCell(const CellRange& range, Func&& func)
+{
+	for (int32_t x = range.minX; x <= range.maxX; ++x)
+		for (int32_t y = range.minY; y <= range.maxY; ++y)
+			for (int32_t z = range.minZ; z <= range.maxZ; ++z)
+				func(x, y, z);
+}
+
+
+/// -------------------------------------------------------------
+///				　AABBと重なる要素を列挙
+/// -------------------------------------------------------------
+template<typename Callback>
+inline void SpatialHashGrid::Query(const AABB& aabb, Callback&& callback) const
+{
+	auto overlaps = [](const AABB& a, const AABB& b) {
+		return a.min.x <= b.max.x && a.max.x >= b.min.x &&
+			a.min.y <= b.max.y && a.max.y >= b.min.y &&
+			a.min.z <= b.max.z && a.max.z >= b.min.z;
+		};
+
+	const CellRange range = ToCellRange(aabb);
+
+	if (range.Count() > kMaxCellsPerEntry)
+	{
+		// 問い合わせ自体が大きいときはセルを回らず全要素を調べる
+		for (uint32_t i = 0; i < bounds_.size(); ++i)
+		{
+			if (overlaps(bounds_[i], aabb) && !callback(i)) return;
+		}
+		return;
+	}
+
+	bool keepGoing = true;
+	ForEachCell(range, [&](int32_t x, int32_t y, int32_t z) {
+		if (!keepGoing) return;
+
+		const Slot* slot = FindSlot(MakeKey(x, y, z));
+		if (!slot) return;
+
+		for (uint32_t n = 0; n < slot->count && keepGoing; ++n)
+		{
+			const uint32_t index = items_[slot->start + n];
+			const AABB& other = bounds_[index];
+			if (!overlaps(other, aabb)) continue;
+
+			// 重なり領域の最小角が入っているセルでだけ報告する（確保なしの重複除去）
+			const int32_t cx = ToCell(other.min.x > aabb.min.x ? other.min.x : aabb.min.x);
+			const int32_t cy = ToCell(other.min.y > aabb.min.y ? other.min.y : aabb.min.y);
+			const int32_t cz = ToCell(other.min.z > aabb.min.z ? other.min.z : aabb.min.z);
+			if (cx != x || cy != y || cz != z) continue;
+
+			keepGoing = callback(index);
+		}
+		});
+
+	// 大きな要素は常に個別に調べる
+	for (uint32_t n = 0; n < oversized_.size() && keepGoing; ++n)
+	{
+		const uint32_t index = oversized_[n];
+		if (overlaps(bounds_[index], aabb)) keepGoing = callback(index);
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　線分が通るセルの要素を列挙
+/// -------------------------------------------------------------
+template<typename Callback>
+inline void SpatialHashGrid::RayCast(const Vector3& origin, const Vector3& diff, float maxT, Callback&& callback) const
+{
+	// 大きな要素は先に個別に調べる
+	for (uint32_t index : oversized_)
+	{
+		maxT = callback(index, maxT);
+		if (maxT < 0.0f) return;
+	}
+
+	if (!hasCellBounds_) return;
+
+	/// ---------- セルが存在する範囲に線分を切り詰める ---------- ///
+	float tStart = 0.0f;
+	float tEnd = maxT;
+	for (int i = 0; i < 3; ++i)
+	{
+		if (diff[i] == 0.0f)
+		{
+			if (origin[i] < cellBounds_.min[i] || origin[i] > cellBounds_.max[i]) return;
+			continue;
+		}
+		float t0 = (cellBounds_.min[i] - origin[i]) / diff[i];
+		float t1 = (cellBounds_.max[i] - origin[i]) / diff[i];
+		if (t0 > t1) { const float tmp = t0; t0 = t1; t1 = tmp; }
+		if (t0 > tStart) tStart = t0;
+		if (t1 < tEnd) tEnd = t1;
+		if (tStart > tEnd) return;
+	}
+
+	/// ---------- 3D DDA（Amanatides–Woo）でセルを順に辿る ---------- ///
+	int32_t cell[3];
+	int32_t step[3];
+	float tNext[3];
+	float tDelta[3];
+	for (int i = 0; i < 3; ++i)
+	{
+		cell[i] = ToCell(origin[i] + diff[i] * tStart);
+		if (diff[i] > 0.0f)
+		{
+			step[i] = 1;
+			tNext[i] = (static_cast<float>(cell[i] + 1) * cellSize_ - origin[i]) / diff[i];
+			tDelta[i] = cellSize_ / diff[i];
+		}
+		else if (diff[i] < 0.0f)
+		{
+			step[i] = -1;
+			tNext[i] = (static_cast<float>(cell[i]) * cellSize_ - origin[i]) / diff[i];
+			tDelta[i] = -cellSize_ / diff[i];
+		}
+		else
+		{
+			step[i] = 0;
+			tNext[i] = std::numeric_limits<float>::infinity();
+			tDelta[i] = std::numeric_limits<float>::infinity();
+		}
+	}
+
+	float tCell = tStart;
+	while (tCell <= tEnd && tCell <= maxT)
+	{
+		if (const Slot* slot = FindSlot(MakeKey(cell[0], cell[1], cell[2])))
+		{
+			for (uint32_t n = 0; n < slot->count; ++n)
+			{
+				maxT = callback(items_[slot->start + n], maxT);
+				if (maxT < 0.0f) return;
+			}
+		}
+
+		// 次に境界をまたぐ軸へ進む
+		const int axis = (tNext[0] < tNext[1]) ? (tNext[0] < tNext[2] ? 0 : 2) : (tNext[1] < tNext[2] ? 1 : 2);
+		tCell = tNext[axis];
+		tNext[axis] += tDelta[axis];
+		cell[axis] += step[axis];
+	}
+}
@@ -0,0 +1,68 @@
+#define NOMINMAX
+#include "StaticCollisionWorld.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+/// -------------------------------------------------------------
+///				　			箱を追加
+/// -------------------------------------------------------------
+uint32_t StaticCollisionWorld::AddBox(const AABB& aabb)
+{
+	Box box{};
+	box.center = (aabb.min + aabb.max) * 0.5f;
+	box.axes[0] = { 1.0f, 0.0f, 0.0f };
+	box.axes[1] = { 0.0f, 1.0f, 0.0f };
+	box.axes[2] = { 0.0f, 0.0f, 1.0f };
+	box.halfSize = (aabb.max - aabb.min) * 0.5f;
+	box.isAxisAligned = true;
+
+	boxes_.push_back(box);
+	bounds_.push_back(aabb);
+	return static_cast<uint32_t>(boxes_.size() - 1);
+}
+
+uint32_t StaticCollisionWorld::AddBox(const OBB& obb)
+{
+	Box box{};
+	box.center = obb.center;
+	box.halfSize = obb.size;
+	box.isAxisAligned = false;
+	for (int i = 0; i < 3; ++i) box.axes[i] = obb.orientations[i];
+
+	// ワールドAABBの半サイズは各軸の絶対値の和
+	Vector3 extent{};
+	for (int i = 0; i < 3; ++i)
+	{
+		extent.x += std::abs(box.axes[i].x) * box.halfSize[i];
+		extent.y += std::abs(box.axes[i].y) * box.halfSize[i];
+		extent.z += std::abs(box.axes[i].z) * box.halfSize[i];
+	}
+
+	boxes_.push_back(box);
+	bounds_.push_back({ box.center - extent, box.center + extent });
+	return static_cast<uint32_t>(boxes_.size() - 1);
+}
+
+
+/// -------------------------------------------------------------
+///				　		グリッドを作り直す
+/// -------------------------------------------------------------
+void StaticCollisionWorld::Build()
+{
+	grid_.Build(bounds_);
+}
+
+
+/// -------------------------------------------------------------
+///				　			全削除
+/// -------------------------------------------------------------
+void StaticCollisionWorld::Clear()
+{
+	boxes_.clear();
+	bounds_.clear();
+	grid_.Build(bounds_);
+	hasGround_ = false;
+	staticMesh_ = nullptr;
+}
@@ -0,0 +1,80 @@
+#pragma once
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "Vector3.h"
+#include "AABB.h"
+#include "OBB.h"
+#include "SpatialHashGrid.h"
+
+/// ---------- 前方宣言 ---------- ///
+class StaticMeshBVH;
+
+
+/// -------------------------------------------------------------
+///		動かない当たり形状の集まり（箱・床・静的メッシュ。キャラクター移動用）
+/// -------------------------------------------------------------
+class StaticCollisionWorld
+{
+public: /// ---------- 構造体 ---------- ///
+
+	// 箱（AABBは軸がワールド軸のOBBとして持つ）
+	struct Box
+	{
+		Vector3 center;
+		Vector3 axes[3];  // 正規直交
+		Vector3 halfSize;
+		bool isAxisAligned;
+	};
+
+public: /// ---------- メンバ関数 ---------- ///
+
+	// 箱を追加（OBB の size は半サイズ。追加したら Build を呼ぶ）
+	uint32_t AddBox(const AABB& aabb);
+	uint32_t AddBox(const OBB& obb);
+
+	// 箱のグリッドを作り直す（箱を追加・削除した後に一度だけ）
+	void Build();
+
+	// 箱と床を全削除（静的メッシュの参照も外す）
+	void Clear();
+
+	// AABBと重なりそうな箱を列挙（重複なし。callback(boxIndex) が false で打ち切り）
+	template <typename Callback>
+	void QueryBoxes(const AABB& aabb, Callback&& callback) const
+	{
+		if (!boxes_.empty()) grid_.Query(aabb, std::forward<Callback>(callback));
+	}
+
+public: /// ---------- 設定 ---------- ///
+
+	// 無限に広い床（y = height より下には入れない）
+	void SetGroundHeight(float height) { groundHeight_ = height; hasGround_ = true; }
+	void ClearGround() { hasGround_ = false; }
+
+	// 静的メッシュ（所有はしない。nullptr で外す）
+	void SetStaticMesh(const StaticMeshBVH* staticMesh) { staticMesh_ = staticMesh; }
+
+public: /// ---------- ゲッター ---------- ///
+
+	uint32_t GetBoxCount() const { return static_cast<uint32_t>(boxes_.size()); }
+	const Box& GetBox(uint32_t index) const { return boxes_[index]; }
+	const AABB& GetBoxBounds(uint32_t index) const { return bounds_[index]; }
+
+	bool HasGround() const { return hasGround_; }
+	float GetGroundHeight() const { return groundHeight_; }
+
+	const StaticMeshBVH* GetStaticMesh() const { return staticMesh_; }
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	std::vector<Box> boxes_;
+	std::vector<AABB> bounds_; // 箱ごとのワールドAABB（グリッドの要素）
+	SpatialHashGrid grid_;
+
+	bool hasGround_ = false;
+	float groundHeight_ = 0.0f;
+
+	const StaticMeshBVH* staticMesh_ = nullptr;
+};
@@ -0,0 +1,602 @@
+#define NOMINMAX
+#include "StaticMeshBVH.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+
+namespace
+{
+	constexpr float kInfinity = std::numeric_limits<float>::infinity();
+
+	// 空のAABB（最初の Grow でその点になる）
+	AABB EmptyAABB()
+	{
+		return { { kInfinity, kInfinity, kInfinity }, { -kInfinity, -kInfinity, -kInfinity } };
+	}
+
+	void Grow(AABB& aabb, const Vector3& point)
+	{
+		aabb.min = { std::min(aabb.min.x, point.x), std::min(aabb.min.y, point.y), std::min(aabb.min.z, point.z) };
+		aabb.max = { std::max(aabb.max.x, point.x), std::max(aabb.max.y, point.y), std::max(aabb.max.z, point.z) };
+	}
+
+	void Grow(AABB& aabb, const AABB& other)
+	{
+		Grow(aabb, other.min);
+		Grow(aabb, other.max);
+	}
+
+	// 表面積の半分（SAH の比にしか使わないので 2 倍は省く）
+	float HalfArea(const Vector3& min, const Vector3& max)
+	{
+		const Vector3 e = max - min;
+		if (e.x < 0.0f || e.y < 0.0f || e.z < 0.0f) return 0.0f;
+		return e.x * e.y + e.y * e.z + e.z * e.x;
+	}
+
+	// 点と三角形の最近接点（頂点・辺・面のどの領域かを順に調べる）
+	Vector3 ClosestPointOnTriangle(const Vector3& p, const Triangle& triangle)
+	{
+		const Vector3& a = triangle.vertices[0];
+		const Vector3& b = triangle.vertices[1];
+		const Vector3& c = triangle.vertices[2];
+
+		const Vector3 ab = b - a;
+		const Vector3 ac = c - a;
+		const Vector3 ap = p - a;
+		const float d1 = Vector3::Dot(ab, ap);
+		const float d2 = Vector3::Dot(ac, ap);
+		if (d1 <= 0.0f && d2 <= 0.0f) return a;
+
+		const Vector3 bp = p - b;
+		const float d3 = Vector3::Dot(ab, bp);
+		const float d4 = Vector3::Dot(ac, bp);
+		if (d3 >= 0.0f && d4 <= d3) return b;
+
+		const float vc = d1 * d4 - d3 * d2;
+		if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) return a + ab * (d1 / (d1 - d3));
+
+		const Vector3 cp = p - c;
+		const float d5 = Vector3::Dot(ab, cp);
+		const float d6 = Vector3::Dot(ac, cp);
+		if (d6 >= 0.0f && d5 <= d6) return c;
+
+		const float vb = d5 * d2 - d1 * d6;
+		if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) return a + ac * (d2 / (d2 - d6));
+
+		const float va = d3 * d6 - d5 * d4;
+		if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f) return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+
+		const float denom = 1.0f / (va + vb + vc);
+		return a + ab * (vb * denom) + ac * (vc * denom);
+	}
+
+	// 線分 p1-q1 と p2-q2 の最近接点
+	void ClosestPointsSegmentSegment(const Vector3& p1, const Vector3& q1, const Vector3& p2, const Vector3& q2, Vector3& c1, Vector3& c2)
+	{
+		const Vector3 d1 = q1 - p1;
+		const Vector3 d2 = q2 - p2;
+		const Vector3 r = p1 - p2;
+		const float a = Vector3::Dot(d1, d1);
+		const float e = Vector3::Dot(d2, d2);
+		const float f = Vector3::Dot(d2, r);
+		constexpr float kEpsilon = 1.0e-8f;
+
+		float s = 0.0f;
+		float t = 0.0f;
+		if (a <= kEpsilon && e <= kEpsilon)
+		{
+			c1 = p1; c2 = p2;
+			return;
+		}
+		if (a <= kEpsilon)
+		{
+			t = std::clamp(f / e, 0.0f, 1.0f);
+		}
+		else
+		{
+			const float c = Vector3::Dot(d1, r);
+			if (e <= kEpsilon)
+			{
+				s = std::clamp(-c / a, 0.0f, 1.0f);
+			}
+			else
+			{
+				const float b = Vector3::Dot(d1, d2);
+				const float denom = a * e - b * b;
+				s = denom > kEpsilon ? std::clamp((b * f - c * e) / denom, 0.0f, 1.0f) : 0.0f;
+				t = (b * s + f) / e;
+				if (t < 0.0f) { t = 0.0f; s = std::clamp(-c / a, 0.0f, 1.0f); }
+				else if (t > 1.0f) { t = 1.0f; s = std::clamp((b - c) / a, 0.0f, 1.0f); }
+			}
+		}
+
+		c1 = p1 + d1 * s;
+		c2 = p2 + d2 * t;
+	}
+
+	// 線分 a-b と三角形の最近接点（交わっていれば交点を両方に入れる）、距離²を返す
+	float ClosestPointsSegmentTriangle(const Vector3& a, const Vector3& b, const Triangle& triangle, Vector3& onSegment, Vector3& onTriangle)
+	{
+		float t = 0.0f;
+		if (StaticMeshBVH::IntersectTriangle(triangle, a, b - a, 1.0f, t))
+		{
+			onSegment = onTriangle = a + (b - a) * t;
+			return 0.0f;
+		}
+
+		// 交わらなければ、端点と面・線分と各辺のどれかが最短になる
+		float best = kInfinity;
+		auto consider = [&](const Vector3& s, const Vector3& q) {
+			const Vector3 d = s - q;
+			const float dist2 = Vector3::Dot(d, d);
+			if (dist2 < best) { best = dist2; onSegment = s; onTriangle = q; }
+			};
+
+		consider(a, ClosestPointOnTriangle(a, triangle));
+		consider(b, ClosestPointOnTriangle(b, triangle));
+		for (int i = 0; i < 3; ++i)
+		{
+			Vector3 c1, c2;
+			ClosestPointsSegmentSegment(a, b, triangle.vertices[i], triangle.vertices[(i + 1) % 3], c1, c2);
+			consider(c1, c2);
+		}
+		return best;
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　	三角形の一覧から構築
+/// -------------------------------------------------------------
+void StaticMeshBVH::Build(std::vector<Triangle> triangles)
+{
+	Clear();
+
+	// 面積のない三角形は何にも当たらないので捨てる
+	triangles.erase(std::remove_if(triangles.begin(), triangles.end(), [](const Triangle& triangle) {
+		const Vector3 n = Vector3::Cross(triangle.vertices[1] - triangle.vertices[0], triangle.vertices[2] - triangle.vertices[0]);
+		return Vector3::Dot(n, n) <= 1.0e-12f;
+		}), triangles.end());
+
+	const uint32_t triangleCount = static_cast<uint32_t>(triangles.size());
+	if (triangleCount == 0) return;
+
+	triangles_ = std::move(triangles);
+
+	// 分割には重心を使い、並べ替えは番号の配列だけで行う
+	std::vector<Vector3> centroids(triangleCount);
+	for (uint32_t i = 0; i < triangleCount; ++i)
+	{
+		const Triangle& triangle = triangles_[i];
+		centroids[i] = (triangle.vertices[0] + triangle.vertices[1] + triangle.vertices[2]) * (1.0f / 3.0f);
+	}
+	std::vector<uint32_t> order(triangleCount);
+	std::iota(order.begin(), order.end(), 0u);
+
+	// 葉が1三角形でもノードは 2N - 1 個に収まる
+	nodes_.reserve(triangleCount * 2 - 1);
+	nodes_.push_back(Node{ {}, 0, {}, triangleCount });
+	UpdateBounds(nodes_[0], order);
+
+	struct Entry { uint32_t nodeIndex; uint32_t depth; };
+	std::vector<Entry> stack;
+	stack.push_back({ 0, 0 });
+
+	while (!stack.empty())
+	{
+		const Entry entry = stack.back();
+		stack.pop_back();
+		depth_ = std::max(depth_, entry.depth);
+
+		const Node node = nodes_[entry.nodeIndex];
+		if (node.count <= kMaxLeafTriangles || entry.depth >= kMaxDepth) continue;
+
+		int32_t axis = 0;
+		float position = 0.0f;
+		if (!FindSplit(node, order, centroids, axis, position)) continue;
+
+		// 分割位置の左右に番号を振り分ける
+		const auto first = order.begin() + node.leftOrFirst;
+		const auto last = first + node.count;
+		auto middle = std::partition(first, last, [&](uint32_t i) { return centroids[i][axis] < position; });
+
+		// 丸め誤差で片側が空になったら中央で分ける
+		if (middle == first || middle == last)
+		{
+			middle = first + node.count / 2;
+			std::nth_element(first, middle, last, [&](uint32_t a, uint32_t b) { return centroids[a][axis] < centroids[b][axis]; });
+		}
+
+		const uint32_t leftCount = static_cast<uint32_t>(middle - first);
+		const uint32_t leftIndex = static_cast<uint32_t>(nodes_.size());
+
+		Node left{ {}, node.leftOrFirst, {}, leftCount };
+		Node right{ {}, node.leftOrFirst + leftCount, {}, node.count - leftCount };
+		UpdateBounds(left, order);
+		UpdateBounds(right, order);
+		nodes_.push_back(left);
+		nodes_.push_back(right);
+
+		nodes_[entry.nodeIndex].leftOrFirst = leftIndex;
+		nodes_[entry.nodeIndex].count = 0;
+
+		stack.push_back({ leftIndex + 1, entry.depth + 1 });
+		stack.push_back({ leftIndex, entry.depth + 1 });
+	}
+
+	// 葉の範囲がそのまま三角形の番号になるように並べ直す
+	std::vector<Triangle> sorted(triangleCount);
+	normals_.resize(triangleCount);
+	for (uint32_t i = 0; i < triangleCount; ++i)
+	{
+		sorted[i] = triangles_[order[i]];
+		normals_[i] = ComputeNormal(sorted[i]);
+	}
+	triangles_ = std::move(sorted);
+}
+
+
+/// -------------------------------------------------------------
+///				　			全削除
+/// -------------------------------------------------------------
+void StaticMeshBVH::Clear()
+{
+	nodes_.clear();
+	triangles_.clear();
+	normals_.clear();
+	depth_ = 0;
+}
+
+
+/// -------------------------------------------------------------
+///				　		線分との交差
+/// -------------------------------------------------------------
+bool StaticMeshBVH::IntersectSegment(const Segment& segment, Hit& outHit) const
+{
+	return IntersectRay(segment.origin, segment.diff, 1.0f, outHit);
+}
+
+
+/// -------------------------------------------------------------
+///				　		レイとの交差
+/// -------------------------------------------------------------
+bool StaticMeshBVH::Raycast(const Vector3& origin, const Vector3& direction, float maxDistance, Hit& outHit) const
+{
+	return IntersectRay(origin, direction, maxDistance, outHit);
+}
+
+
+/// -------------------------------------------------------------
+///				　		球との接触
+/// -------------------------------------------------------------
+bool StaticMeshBVH::OverlapSphere(const Sphere& sphere, Contact& outContact) const
+{
+	const Vector3 extent = { sphere.radius, sphere.radius, sphere.radius };
+	const AABB query = { sphere.center - extent, sphere.center + extent };
+
+	bool found = false;
+	Query(query, [&](uint32_t index) {
+		Contact contact;
+		if (ContactSphere(sphere, triangles_[index], normals_[index], contact) && (!found || contact.depth > outContact.depth))
+		{
+			outContact = contact;
+			outContact.triangleIndex = index;
+			found = true;
+		}
+		return true;
+		});
+
+	return found;
+}
+
+
+/// -------------------------------------------------------------
+///				　		カプセルとの接触
+/// -------------------------------------------------------------
+bool StaticMeshBVH::OverlapCapsule(const Capsule& capsule, Contact& outContact) const
+{
+	const Vector3& a = capsule.segment.origin;
+	const Vector3& b = capsule.segment.diff;
+	const Vector3 extent = { capsule.radius, capsule.radius, capsule.radius };
+	const AABB query = {
+		Vector3{ std::min(a.x, b.x), std::min(a.y, b.y), std::min(a.z, b.z) } - extent,
+		Vector3{ std::max(a.x, b.x), std::max(a.y, b.y), std::max(a.z, b.z) } + extent,
+	};
+
+	bool found = false;
+	Query(query, [&](uint32_t index) {
+		Contact contact;
+		if (ContactCapsule(capsule, triangles_[index], normals_[index], contact) && (!found || contact.depth > outContact.depth))
+		{
+			outContact = contact;
+			outContact.triangleIndex = index;
+			found = true;
+		}
+		return true;
+		});
+
+	return found;
+}
+
+
+/// -------------------------------------------------------------
+///			　線分と三角形の交点の t（両面。Möller–Trumbore）
+/// -------------------------------------------------------------
+bool StaticMeshBVH::IntersectTriangle(const Triangle& triangle, const Vector3& origin, const Vector3& diff, float maxT, float& outT)
+{
+	const Vector3 e1 = triangle.vertices[1] - triangle.vertices[0];
+	const Vector3 e2 = triangle.vertices[2] - triangle.vertices[0];
+	const Vector3 p = Vector3::Cross(diff, e2);
+	const float det = Vector3::Dot(e1, p);
+	if (std::fabs(det) < 1.0e-12f) return false; // 平行
+
+	const float invDet = 1.0f / det;
+	const Vector3 s = origin - triangle.vertices[0];
+	const float u = Vector3::Dot(s, p) * invDet;
+	if (u < 0.0f || u > 1.0f) return false;
+
+	const Vector3 q = Vector3::Cross(s, e1);
+	const float v = Vector3::Dot(diff, q) * invDet;
+	if (v < 0.0f || u + v > 1.0f) return false;
+
+	outT = Vector3::Dot(e2, q) * invDet;
+	return outT >= 0.0f && outT <= maxT;
+}
+
+
+/// -------------------------------------------------------------
+///				　		球と三角形の接触
+/// -------------------------------------------------------------
+bool StaticMeshBVH::ContactSphere(const Sphere& sphere, const Triangle& triangle, const Vector3& normal, Contact& outContact)
+{
+	const Vector3 closest = ClosestPointOnTriangle(sphere.center, triangle);
+	const Vector3 d = sphere.center - closest;
+	const float dist2 = Vector3::Dot(d, d);
+	if (dist2 > sphere.radius * sphere.radius) return false;
+
+	// 中心が面上にあるときは面の法線で押し出す
+	const float dist = std::sqrt(dist2);
+	outContact.point = closest;
+	outContact.normal = dist > 1.0e-6f ? d * (1.0f / dist) : normal;
+	outContact.depth = sphere.radius - dist;
+	return true;
+}
+
+
+/// -------------------------------------------------------------
+///				　	カプセルと三角形の接触
+/// -------------------------------------------------------------
+bool StaticMeshBVH::ContactCapsule(const Capsule& capsule, const Triangle& triangle, const Vector3& normal, Contact& outContact)
+{
+	const Vector3& a = capsule.segment.origin;
+	const Vector3& b = capsule.segment.diff;
+
+	Vector3 onSegment, onTriangle;
+	const float dist2 = ClosestPointsSegmentTriangle(a, b, triangle, onSegment, onTriangle);
+	if (dist2 > capsule.radius * capsule.radius) return false;
+
+	const float dist = std::sqrt(dist2);
+	if (dist > 1.0e-6f)
+	{
+		outContact.normal = (onSegment - onTriangle) * (1.0f / dist);
+		outContact.depth = capsule.radius - dist;
+	}
+	else
+	{
+		// 軸が面を貫いているときは、中点のある側へ面の法線で押し出す（反対側の端点の分だけ深い）
+		const Vector3& v0 = triangle.vertices[0];
+		outContact.normal = Vector3::Dot(normal, (a + b) * 0.5f - v0) < 0.0f ? normal * -1.0f : normal;
+		const float behind = std::max(-Vector3::Dot(outContact.normal, a - v0), -Vector3::Dot(outContact.normal, b - v0));
+		outContact.depth = capsule.radius + std::max(behind, 0.0f);
+	}
+	outContact.point = onTriangle;
+	return true;
+}
+
+
+/// -------------------------------------------------------------
+///				　		三角形の面の法線
+/// -------------------------------------------------------------
+Vector3 StaticMeshBVH::ComputeNormal(const Triangle& triangle)
+{
+	return Vector3::Normalize(Vector3::Cross(triangle.vertices[1] - triangle.vertices[0], triangle.vertices[2] - triangle.vertices[0]));
+}
+
+
+/// -------------------------------------------------------------
+///				　	ノードのAABBを求める
+/// -------------------------------------------------------------
+void StaticMeshBVH::UpdateBounds(Node& node, const std::vector<uint32_t>& order) const
+{
+	AABB bounds = EmptyAABB();
+	for (uint32_t i = 0; i < node.count; ++i)
+	{
+		const Triangle& triangle = triangles_[order[node.leftOrFirst + i]];
+		Grow(bounds, triangle.vertices[0]);
+		Grow(bounds, triangle.vertices[1]);
+		Grow(bounds, triangle.vertices[2]);
+	}
+	node.min = bounds.min;
+	node.max = bounds.max;
+}
+
+
+/// -------------------------------------------------------------
+///				　		SAHで分割位置を探す
+/// -------------------------------------------------------------
+bool StaticMeshBVH::FindSplit(const Node& node, const std::vector<uint32_t>& order, const std::vector<Vector3>& centroids, int32_t& outAxis, float& outPosition) const
+{
+	// 重心の範囲でビンを切る（AABB で切ると大きな三角形に引っ張られる）
+	AABB centroidBounds = EmptyAABB();
+	for (uint32_t i = 0; i < node.count; ++i) Grow(centroidBounds, centroids[order[node.leftOrFirst + i]]);
+
+	// 分割しない場合のコスト（三角形をすべて調べる）を基準にする
+	const float nodeArea = HalfArea(node.min, node.max);
+	if (nodeArea <= 0.0f) return false;
+	float bestCost = static_cast<float>(node.count);
+	bool found = false;
+
+	for (int32_t axis = 0; axis < 3; ++axis)
+	{
+		const float minC = centroidBounds.min[axis];
+		const float extent = centroidBounds.max[axis] - minC;
+		if (extent <= 1.0e-6f) continue;
+
+		std::array<Bin, kBinCount> bins;
+		for (Bin& bin : bins) bin.bounds = EmptyAABB();
+
+		const float scale = static_cast<float>(kBinCount) / extent;
+		for (uint32_t i = 0; i < node.count; ++i)
+		{
+			const uint32_t index = order[node.leftOrFirst + i];
+			const uint32_t b = std::min(kBinCount - 1, static_cast<uint32_t>((centroids[index][axis] - minC) * scale));
+			const Triangle& triangle = triangles_[index];
+			++bins[b].count;
+			Grow(bins[b].bounds, triangle.vertices[0]);
+			Grow(bins[b].bounds, triangle.vertices[1]);
+			Grow(bins[b].bounds, triangle.vertices[2]);
+		}
+
+		// 左から・右から累積した面積と数（境界 i はビン i とビン i + 1 の間）
+		std::array<float, kBinCount - 1> leftArea{}, rightArea{};
+		std::array<uint32_t, kBinCount - 1> leftCount{}, rightCount{};
+		AABB leftBox = EmptyAABB(), rightBox = EmptyAABB();
+		uint32_t leftSum = 0, rightSum = 0;
+		for (uint32_t i = 0; i < kBinCount - 1; ++i)
+		{
+			leftSum += bins[i].count;
+			if (bins[i].count > 0) Grow(leftBox, bins[i].bounds);
+			leftCount[i] = leftSum;
+			leftArea[i] = HalfArea(leftBox.min, leftBox.max);
+
+			const uint32_t j = kBinCount - 1 - i;
+			rightSum += bins[j].count;
+			if (bins[j].count > 0) Grow(rightBox, bins[j].bounds);
+			rightCount[j - 1] = rightSum;
+			rightArea[j - 1] = HalfArea(rightBox.min, rightBox.max);
+		}
+
+		for (uint32_t i = 0; i < kBinCount - 1; ++i)
+		{
+			if (leftCount[i] == 0 || rightCount[i] == 0) continue;
+
+			const float cost = kTraversalCost + (leftCount[i] * leftArea[i] + rightCount[i] * rightArea[i]) / nodeArea;
+			if (cost < bestCost)
+			{
+				bestCost = cost;
+				outAxis = axis;
+				outPosition = minC + extent * static_cast<float>(i + 1) / static_cast<float>(kBinCount);
+				found = true;
+			}
+		}
+	}
+
+	return found;
+}
+
+
+/// -------------------------------------------------------------
+///				　	線分・レイの最も近い当たり
+/// -------------------------------------------------------------
+bool StaticMeshBVH::IntersectRay(const Vector3& origin, const Vector3& diff, float maxT, Hit& outHit) const
+{
+	if (nodes_.empty()) return false;
+
+	const Vector3 invDiff = {
+		diff.x != 0.0f ? 1.0f / diff.x : kInfinity,
+		diff.y != 0.0f ? 1.0f / diff.y : kInfinity,
+		diff.z != 0.0f ? 1.0f / diff.z : kInfinity,
+	};
+
+	// 積むときに入る t も持っておき、取り出すときは縮んだ maxT と比べるだけにする
+	struct Entry { uint32_t nodeIndex; float tEnter; };
+	std::array<Entry, kStackSize> stack;
+	uint32_t top = 0;
+
+	float tRoot = 0.0f;
+	if (!RayEnter(nodes_[0].min, nodes_[0].max, origin, invDiff, maxT, tRoot)) return false;
+	stack[top++] = { 0, tRoot };
+
+	bool found = false;
+	while (top > 0)
+	{
+		const Entry entry = stack[--top];
+
+		// 前の葉で maxT が縮んでいれば枝刈り
+		if (entry.tEnter > maxT) continue;
+
+		const Node& node = nodes_[entry.nodeIndex];
+		if (node.IsLeaf())
+		{
+			for (uint32_t i = 0; i < node.count; ++i)
+			{
+				const uint32_t index = node.leftOrFirst + i;
+				float t = 0.0f;
+				if (IntersectTriangle(triangles_[index], origin, diff, maxT, t))
+				{
+					maxT = t;
+					outHit.t = t;
+					outHit.triangleIndex = index;
+					found = true;
+				}
+			}
+			continue;
+		}
+
+		// 入る t が遠い方を先に積んで、近い方から調べる
+		const uint32_t child1 = node.leftOrFirst;
+		const uint32_t child2 = node.leftOrFirst + 1;
+		float t1 = 0.0f;
+		float t2 = 0.0f;
+		const bool hit1 = RayEnter(nodes_[child1].min, nodes_[child1].max, origin, invDiff, maxT, t1);
+		const bool hit2 = RayEnter(nodes_[child2].min, nodes_[child2].max, origin, invDiff, maxT, t2);
+
+		if (hit1 && hit2)
+		{
+			if (t1 <= t2) { stack[top++] = { child2, t2 }; stack[top++] = { child1, t1 }; }
+			else { stack[top++] = { child1, t1 }; stack[top++] = { child2, t2 }; }
+		}
+		else if (hit1) stack[top++] = { child1, t1 };
+		else if (hit2) stack[top++] = { child2, t2 };
+	}
+
+	if (!found) return false;
+
+	// 法線は線分の向きと逆にそろえる（地形は両面で判定する）
+	outHit.point = origin + diff * outHit.t;
+	outHit.normal = normals_[outHit.triangleIndex];
+	if (Vector3::Dot(outHit.normal, diff) > 0.0f) outHit.normal = outHit.normal * -1.0f;
+	return true;
+}
+
+
+/// -------------------------------------------------------------
+///				　	線分がAABBに入る t
+/// -------------------------------------------------------------
+bool StaticMeshBVH::RayEnter(const Vector3& min, const Vector3& max, const Vector3& origin, const Vector3& invDiff, float maxT, float& tEnter)
+{
+	float tMin = 0.0f;
+	float tMax = maxT;
+	for (int i = 0; i < 3; ++i)
+	{
+		float t0 = (min[i] - origin[i]) * invDiff[i];
+		float t1 = (max[i] - origin[i]) * invDiff[i];
+		if (t0 > t1) std::swap(t0, t1);
+
+		if (!(t0 <= tMax) || !(t1 >= tMin))
+		{
+			// 軸に平行で始点がちょうど面上にある場合（NaN）は範囲内なら通す
+			if (invDiff[i] == kInfinity && origin[i] >= min[i] && origin[i] <= max[i]) continue;
+			return false;
+		}
+		if (t0 > tMin) tMin = t0;
+		if (t1 < tMax) tMax = t1;
+	}
+
+	tEnter = tMin;
+	return true;
+}
@@ -0,0 +1,182 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "Vector3.h"
+#include "Matrix4x4.h"
+#include "AABB.h"
+#include "Sphere.h"
+#include "Segment.h"
+#include "Capsule.h"
+#include "Triangle.h"
+
+/// ---------- 前方宣言 ---------- ///
+struct ModelData;
+
+
+/// -------------------------------------------------------------
+///		静的な三角形メッシュのBVH（地形・ステージとの当たり判定）
+/// -------------------------------------------------------------
+class StaticMeshBVH
+{
+public: /// ---------- 構造体 ---------- ///
+
+	// 線分・レイの当たり（最も近いもの）
+	struct Hit
+	{
+		float t = 0.0f;             // 線分なら 0〜1、レイなら距離
+		Vector3 point{};            // 当たった位置
+		Vector3 normal{};           // 面の法線（線分の向きと逆を向くようにそろえる）
+		uint32_t triangleIndex = 0; // BVH内の三角形番号
+	};
+
+	// 球・カプセルとの接触（最も深いもの）
+	struct Contact
+	{
+		Vector3 point{};            // メッシュ上の最近接点
+		Vector3 normal{};           // 押し出す向き（メッシュから形状へ）
+		float depth = 0.0f;         // めり込み量
+		uint32_t triangleIndex = 0; // BVH内の三角形番号
+	};
+
+public: /// ---------- メンバ関数 ---------- ///
+
+	// モデルの全サブメッシュの三角形をワールド行列で変換して構築
+	void Build(const ModelData& modelData, const Matrix4x4& worldMatrix);
+
+	// 三角形の一覧から構築（並びは葉ごとにまとまるように入れ替わる）
+	void Build(std::vector<Triangle> triangles);
+
+	// 全削除
+	void Clear();
+
+	// 線分（diff は始点からの差分）に最初に当たる三角形
+	bool IntersectSegment(const Segment& segment, Hit& outHit) const;
+
+	// レイ（direction は正規化済み）に maxDistance までで最初に当たる三角形
+	bool Raycast(const Vector3& origin, const Vector3& direction, float maxDistance, Hit& outHit) const;
+
+	// 球・カプセル（segment.diff は終点）と重なる三角形のうち最も深い接触
+	bool OverlapSphere(const Sphere& sphere, Contact& outContact) const;
+	bool OverlapCapsule(const Capsule& capsule, Contact& outContact) const;
+
+	// AABBと重なる葉の三角形を列挙（callback(triangleIndex) が false で打ち切り）
+	template <typename Callback>
+	void Query(const AABB& aabb, Callback&& callback) const;
+
+public: /// ---------- 静的メンバ関数 ---------- ///
+
+	// 1つの三角形との判定（BVH をたどらずに全三角形をなめる検証でも同じ式を使う）
+	static bool IntersectTriangle(const Triangle& triangle, const Vector3& origin, const Vector3& diff, float maxT, float& outT);
+	static bool ContactSphere(const Sphere& sphere, const Triangle& triangle, const Vector3& normal, Contact& outContact);
+	static bool ContactCapsule(const Capsule& capsule, const Triangle& triangle, const Vector3& normal, Contact& outContact);
+
+	// 三角形の面の法線（Build で GetTriangleNormal に入るもの）
+	static Vector3 ComputeNormal(const Triangle& triangle);
+
+public: /// ---------- ゲッター ---------- ///
+
+	bool IsEmpty() const { return nodes_.empty(); }
+	uint32_t GetTriangleCount() const { return static_cast<uint32_t>(triangles_.size()); }
+	uint32_t GetNodeCount() const { return static_cast<uint32_t>(nodes_.size()); }
+	uint32_t GetDepth() const { return depth_; }
+	const Triangle& GetTriangle(uint32_t index) const { return triangles_[index]; }
+	const Vector3& GetTriangleNormal(uint32_t index) const { return normals_[index]; }
+
+	// 全体のAABB
+	AABB GetBounds() const { return nodes_.empty() ? AABB{} : AABB{ nodes_[0].min, nodes_[0].max }; }
+
+private: /// ---------- 構造体 ---------- ///
+
+	// ノード（32バイト。内部ノードは子2つが並んでいて leftOrFirst が左の子、葉は三角形の範囲）
+	struct alignas(32) Node
+	{
+		Vector3 min;
+		uint32_t leftOrFirst;
+		Vector3 max;
+		uint32_t count; // 0なら内部ノード
+
+		bool IsLeaf() const { return count > 0; }
+	};
+	static_assert(sizeof(Node) == 32, "StaticMeshBVH::Node must stay 32 bytes");
+
+	// SAH のビン
+	struct Bin
+	{
+		AABB bounds{};
+		uint32_t count = 0;
+	};
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	// ノードのAABBを三角形から求める
+	void UpdateBounds(Node& node, const std::vector<uint32_t>& order) const;
+
+	// ビン分けしたSAHで分割位置を探す（分割しない方が安ければ false）
+	bool FindSplit(const Node& node, const std::vector<uint32_t>& order, const std::vector<Vector3>& centroids, int32_t& outAxis, float& outPosition) const;
+
+	// 線分（origin + diff * t, t ∈ [0, maxT]）の共通部分
+	bool IntersectRay(const Vector3& origin, const Vector3& diff, float maxT, Hit& outHit) const;
+
+	// 線分がAABBに入る t（範囲外なら false。invDiff は diff の逆数で、0成分は無限大）
+	static bool RayEnter(const Vector3& min, const Vector3& max, const Vector3& origin, const Vector3& invDiff, float maxT, float& tEnter);
+
+	// ノードとAABBの重なり
+	static bool Overlaps(const Node& node, const AABB& aabb)
+	{
+		return node.min.x <= aabb.max.x && node.max.x >= aabb.min.x &&
+			node.min.y <= aabb.max.y && node.max.y >= aabb.min.y &&
+			node.min.z <= aabb.max.z && node.max.z >= aabb.min.z;
+	}
+
+private: /// ---------- 定数 ---------- ///
+
+	static constexpr uint32_t kBinCount = 12;         // SAH のビン数
+	static constexpr uint32_t kMaxLeafTriangles = 4;  // これ以下なら無条件で葉にする
+	static constexpr uint32_t kMaxDepth = 60;         // 深さの上限（探索スタックの大きさに合わせる）
+	static constexpr float kTraversalCost = 1.0f;     // 三角形1つの判定を1としたノードをたどるコスト
+
+	// 探索スタックの大きさ（深さ + 1 あれば足りる）
+	static constexpr uint32_t kStackSize = 64;
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	std::vector<Node> nodes_;
+	std::vector<Triangle> triangles_; // 葉ごとにまとめた並び
+	std::vector<Vector3> normals_;    // 三角形ごとの面の法線
+	uint32_t depth_ = 0;
+};
+
+
+/// -------------------------------------------------------------
+///				　AABBと重なる三角形を列挙
+/// -------------------------------------------------------------
+template<typename Callback>
+inline void StaticMeshBVH::Query(const AABB& aabb, Callback&& callback) const
+{
+	if (nodes_.empty()) return;
+
+	std::array<uint32_t, kStackSize> stack;
+	uint32_t top = 0;
+	stack[top++] = 0;
+
+	while (top > 0)
+	{
+		const Node& node = nodes_[stack[--top]];
+		if (!Overlaps(node, aabb)) continue;
+
+		if (node.IsLeaf())
+		{
+			for (uint32_t i = 0; i < node.count; ++i)
+			{
+				if (!callback(node.leftOrFirst + i)) return;
+			}
+		}
+		else
+		{
+			stack[top++] = node.leftOrFirst + 1;
+			stack[top++] = node.leftOrFirst;
+		}
+	}
+}
@@ -0,0 +1,45 @@
+#include "StaticMeshBVH.h"
+#include "ModelData.h"
+
+// モデルからの構築だけここに分ける（本体の StaticMeshBVH.cpp はグラフィックスに依存しない）
+
+
+/// -------------------------------------------------------------
+///				　	モデルから構築
+/// -------------------------------------------------------------
+void StaticMeshBVH::Build(const ModelData& modelData, const Matrix4x4& worldMatrix)
+{
+	std::vector<Triangle> triangles;
+	std::vector<Vector3> positions;
+
+	for (const SubMesh& subMesh : modelData.subMeshes)
+	{
+		// 頂点ごとに1回だけ、まとめてワールドへ（インデックスで共有される頂点を何度も変換しない）
+		positions.resize(subMesh.vertices.size());
+		for (size_t i = 0; i < subMesh.vertices.size(); ++i)
+		{
+			const Vector4& p = subMesh.vertices[i].position;
+			positions[i] = { p.x, p.y, p.z };
+		}
+		Vector3::TransformPoints(positions, worldMatrix, positions);
+
+		auto toWorld = [&](uint32_t index) { return positions[index]; };
+
+		// インデックスがなければ頂点を3つずつ並べたものとみなす
+		const uint32_t indexCount = subMesh.indices.empty() ? static_cast<uint32_t>(subMesh.vertices.size()) : static_cast<uint32_t>(subMesh.indices.size());
+		triangles.reserve(triangles.size() + indexCount / 3);
+		for (uint32_t i = 0; i + 2 < indexCount; i += 3)
+		{
+			if (subMesh.indices.empty())
+			{
+				triangles.push_back({ { toWorld(i), toWorld(i + 1), toWorld(i + 2) } });
+			}
+			else
+			{
+				triangles.push_back({ { toWorld(subMesh.indices[i]), toWorld(subMesh.indices[i + 1]), toWorld(subMesh.indices[i + 2]) } });
+			}
+		}
+	}
+
+	Build(std::move(triangles));
+}
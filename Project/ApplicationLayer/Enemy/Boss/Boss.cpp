@@ -33,6 +33,12 @@ void Boss::Initialize()
 	model_ = models_[BossState::Idle].get();
 	model_->SetTranslate({ 0.0f, 0.0f, 50.0f });
 
+	// 部位の複合コライダー（子はボディパーツのジョイント番号で骨に付く）
+	bodyCollider_ = std::make_unique<CompoundCollider>();
+	bodyCollider_->SetTypeID(static_cast<uint32_t>(CollisionTypeIdDef::kBoss));
+	bodyCollider_->SetOwner(this);
+	bodyCollider_->Bind(*model_);
+
 	//　武器の初期化
 	weapon_ = std::make_unique<BossWeapon>();
 	weapon_->Initialize();
@@ -67,24 +73,8 @@ void Boss::Update()
 		// 共通更新
 		model_->Update();
 
-		// 毎フレームカプセルを骨に追従
-		auto partCaps = model_->GetBodyPartCapsulesWorld();
-
-		if (bodyCols_.size() != partCaps.size()) {
-			// Bone 本数が変わったら作り直し（開発中のモデル差し替え対策）
-			bodyCols_.clear();
-			for (auto& [name, cap] : partCaps) {
-				auto c = std::make_unique<Collider>();
-				c->SetTypeID(static_cast<uint32_t>(CollisionTypeIdDef::kBoss));
-				c->SetCapsule(cap);
-				c->SetOwner(this);
-				bodyCols_.push_back({ name, std::move(c) });
-			}
-		}
-
-		for (size_t i = 0; i < partCaps.size(); ++i) {
-			bodyCols_[i].col->SetCapsule(partCaps[i].second);
-		}
+		// 毎フレーム部位カプセルを骨に追従（その場で書き換えるので確保も名前の検索もしない）
+		bodyCollider_->UpdateFromModel(*model_);
 	}
 
 	if (isDying_)
@@ -127,7 +117,7 @@ void Boss::Draw()
 	if (!isDying_) {
 		// デバッグ表示は演出中は不要ならスキップ
 		model_->DrawSkeletonWireframe();
-		for (auto& pc : bodyCols_) pc.col->Draw();
+		bodyCollider_->Draw();
 	}
 
 	Object3DCommon::GetInstance()->SetRenderSetting(); // アニメーションパイプラインの描画設定
@@ -140,16 +130,9 @@ void Boss::DrawImGui()
 	ImGui::Begin("Boss Colliders");
 	static bool visible = false;
 	if (ImGui::Checkbox("Show All Capsules", &visible)) {
-		for (auto& pc : bodyCols_) {
-			pc.col->SetCapsuleVisible(visible);
-		}
-	}
-	for (size_t i = 0; i < bodyCols_.size(); ++i) {
-		if (ImGui::TreeNode(bodyCols_[i].name.c_str())) {
-			bodyCols_[i].col->DrawImGui();
-			ImGui::TreePop();
-		}
+		bodyCollider_->SetCapsuleVisible(visible);
 	}
+	bodyCollider_->DrawChildrenImGui();
 	ImGui::End();
 
 	// --- ステート切り替え用 UI ---
@@ -173,22 +156,14 @@ void Boss::DrawImGui()
 
 void Boss::RegisterColliders(CollisionManager* collisionManager) const
 {
-	// 死亡演出 or ディゾルブ or 完全死亡ならコライダーを削除
-	if (isDying_ || isDissolving_ || isDead_)
-	{
-		for (const auto& pc : bodyCols_) {
-			collisionManager->RemoveCollider(pc.col.get());
-		}
-		return;
-	}
+	// 死亡演出 or ディゾルブ or 完全死亡なら登録しない（死亡演出の開始時に UnregisterColliders で外れる）
+	if (isDying_ || isDissolving_ || isDead_) return;
 
 	// 本体（必要なら）も先に登録
 	collisionManager->AddCollider(const_cast<Boss*>(this));
 
-	// 部位カプセルをすべて登録
-	for (const auto& pc : bodyCols_) {
-		collisionManager->AddCollider(pc.col.get());
-	}
+	// 部位カプセルは外形1つで登録（子は外形に当たったときだけ調べられる）
+	collisionManager->AddCollider(bodyCollider_.get());
 
 	// 武器の弾も登録
 	if (weapon_)
@@ -202,6 +177,19 @@ void Boss::RegisterColliders(CollisionManager* collisionManager) const
 	}
 }
 
+void Boss::UnregisterColliders()
+{
+	// 本体・部位・飛んでいる弾をすべて外す
+	Unregister();
+	bodyCollider_->Unregister();
+	if (weapon_)
+	{
+		for (const auto& bullet : weapon_->GetBullets()) {
+			bullet->Unregister();
+		}
+	}
+}
+
 void Boss::OnCollision(Collider* other)
 {
 
@@ -219,8 +207,9 @@ void Boss::TakeDamage(float damage)
 		// ★ここでキル加算を一度だけ実行
 		ScoreManager::GetInstance()->AddKill();
 
-		// 死亡演出開始
+		// 死亡演出開始（以降は当たり判定に参加しない）
 		isDying_ = true;
+		UnregisterColliders();
 		deathTime_ = 0.0f;
 		ChangeState(BossState::Dead);
 		Log("Boss is dying.");
@@ -252,6 +241,9 @@ void Boss::ChangeState(BossState newState)
 		// 状態に応じて時間を初期化 or 継続
 		model_->SetAnimationTime(newAnimTime);
 
+		// モデルごとにジョイント番号が違うので部位を作り直す
+		if (bodyCollider_) bodyCollider_->Bind(*model_);
+
 		// 安全のためアニメ・ディゾルブ初期化
 		//model_->SetDissolveThreshold(0.0f);
 		//model_->SetIsPlaying(true);
@@ -1,6 +1,7 @@
 #pragma once
 #include "AnimationModel.h"
 #include "Collider.h"
+#include "CompoundCollider.h"
 #include "ContactRecord.h"
 #include "BossWeapon.h"
 
@@ -28,13 +29,8 @@ class Boss : public Collider
 {
 private: /// ---------- 構造体 ---------- ///
 
-	// ★各部位ごとの Collider を保持
-	struct PartCol
-	{
-		std::string name;
-		std::unique_ptr<Collider> col;
-	};
-	std::vector<PartCol> bodyCols_;
+	// 部位カプセルをまとめた複合コライダー（ブロードフェーズには外形だけが入る）
+	std::unique_ptr<CompoundCollider> bodyCollider_;
 
 public: /// ---------- メンバ関数 ---------- ///
 
@@ -53,6 +49,9 @@ public: /// ---------- メンバ関数 ---------- ///
 	// すべての部位コライダーを CollisionManager へ登録
 	void RegisterColliders(CollisionManager* collisionManager) const;
 
+	// 本体・部位・弾の登録をすべて解除
+	void UnregisterColliders();
+
 	// 衝突処理
 	void OnCollision(Collider* other) override;
 
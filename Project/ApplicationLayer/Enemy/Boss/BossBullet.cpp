@@ -1,5 +1,6 @@
 #include "BossBullet.h"
 #include <CollisionTypeIdDef.h>
+#include <CollisionUtility.h>
 #include "Player.h"
 
 void BossBullet::Initialize()
@@ -16,6 +17,9 @@ void BossBullet::Initialize()
 
 void BossBullet::Update()
 {
+	// 接触履歴のフレームを進める（このあとの衝突判定で Add される）
+	contactRecord_.NextFrame();
+
 	// 位置更新前に記録
 	previousPosition_ = position_;
 	position_ += velocity_;
@@ -58,15 +62,35 @@ void BossBullet::OnCollision(Collider* other)
 	// 衝突相手のユニークIDを取得
 	uint32_t targetID = other->GetUniqueID();
 
-	// すでに当たった相手かどうかを確認
+	// すでに当たった相手かどうかを確認（1発の弾が同じ相手に当たるのは生涯1回だけ）
 	if (contactRecord_.Check(targetID)) return; // すでに当たった相手なので無視
 
-	contactRecord_.Add(targetID); // 初めて当たった相手として記録
+	contactRecord_.Add(targetID); // 初めて当たった相手として記録（このフレームの接触にもなる）
 
 	if (auto player = other->GetOwner<Player>())        // ★ 追加
 	{
 		player->TakeDamage(GetDamage() * 0.125f);
 	}
 
+	// 線分がカプセルに入った時刻から命中位置を求めて弾をそこに止める（複合コライダーは最初に入った部位で）
+	float toi = 2.0f;
+	float t = 0.0f;
+	const std::span<const Capsule> children = other->GetChildCapsules();
+	if (children.empty() && other->HasCapsule() && CollisionUtility::IntersectSegmentCapsule(segment_, other->GetCapsule(), t)) toi = t;
+	for (const Capsule& child : children)
+	{
+		if (CollisionUtility::IntersectSegmentCapsule(segment_, child, t) && t < toi) toi = t;
+	}
+	if (toi <= 1.0f)
+	{
+		position_ = segment_.origin + segment_.diff * toi;
+		model_->SetTranslate(position_);
+		SetCenterPosition(position_);
+
+		// 線分も命中位置までにして形状の更新を知らせる
+		segment_.diff = segment_.diff * toi;
+		SetSegment(segment_);
+	}
+
 	isDead_ = true;
 }
@@ -1,4 +1,6 @@
 #include "BossWeapon.h"
+#include "Boss.h"
+#include "CollisionManager.h"
 #include <ParticleManager.h>
 
 void BossWeapon::Initialize()
@@ -41,6 +43,9 @@ void BossWeapon::TryFire(const Vector3& pos, const Vector3& dir)
 	bullet->SetDamage(bulletDamage_);
 	bullet->SetBoss(boss_);
 
+	// ボスと同じマネージャーに登録（死亡演出中のボスは外れているので登録されない）
+	if (boss_ && boss_->GetCollisionManager()) boss_->GetCollisionManager()->AddCollider(bullet.get());
+
 	bullets_.push_back(std::move(bullet));
 }
 
@@ -0,0 +1,406 @@
+#define NOMINMAX
+#include "CrowdSeparation.h"
+#include "JobSystem.h"
+#include <LogString.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <imgui.h>
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	float ElapsedMilliseconds(Clock::time_point start)
+	{
+		return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　		仲間を追加する
+/// -------------------------------------------------------------
+uint32_t CrowdSeparation::AddAgent(const Vector3& position, float radius)
+{
+	positions_.push_back(position);
+	radii_.push_back(radius);
+	return static_cast<uint32_t>(positions_.size() - 1);
+}
+
+
+/// -------------------------------------------------------------
+///				　	フレーム開始時の位置でまとめる
+/// -------------------------------------------------------------
+void CrowdSeparation::BeginFrame()
+{
+	const auto startTime = Clock::now();
+	Build(positions_, radii_);
+	neighborTests_ = 0;
+	solveMilliseconds_ = ElapsedMilliseconds(startTime);
+}
+
+
+/// -------------------------------------------------------------
+///				　		1体分の押し離し
+/// -------------------------------------------------------------
+Vector3 CrowdSeparation::Separate(uint32_t index, const Vector3& position, float dt)
+{
+	const auto startTime = Clock::now();
+	uint32_t tests = 0;
+	const Vector3 correction = SolveAgent(index, position, radii_[index], dt, tests);
+	neighborTests_ += tests;
+	solveMilliseconds_ += ElapsedMilliseconds(startTime);
+	return correction;
+}
+
+
+/// -------------------------------------------------------------
+///				　		動いた位置を知らせる
+/// -------------------------------------------------------------
+void CrowdSeparation::Move(uint32_t index, const Vector3& position)
+{
+	uint32_t& slot = agentSlots_[index];
+	if (slot & kMovedBit)
+	{
+		SortedAgent& moved = movedAgents_[slot & ~kMovedBit];
+		moved.x = position.x;
+		moved.z = position.z;
+		return;
+	}
+
+	// 同じバケットの中ならその場で書き換える
+	SortedAgent& agent = sortedAgents_[slot];
+	if (Hash(ToCell(position.x), ToCell(position.z)) == agentCells_[index])
+	{
+		agent.x = position.x;
+		agent.z = position.z;
+		return;
+	}
+
+	// 別のバケットに移ったら移った仲間の一覧に載せ、元の場所は誰からも届かない座標にする
+	slot = static_cast<uint32_t>(movedAgents_.size()) | kMovedBit;
+	movedAgents_.push_back({ position.x, position.z, agent.radius, index });
+	agent.x = std::numeric_limits<float>::infinity();
+	agent.z = std::numeric_limits<float>::infinity();
+}
+
+
+/// -------------------------------------------------------------
+///				　		補正量を求める
+/// -------------------------------------------------------------
+void CrowdSeparation::Solve(const std::vector<Vector3>& positions, const std::vector<float>& radii, float dt, std::vector<Vector3>& outCorrections)
+{
+	const auto startTime = Clock::now();
+
+	const uint32_t count = static_cast<uint32_t>(positions.size());
+	outCorrections.resize(count);
+	Build(positions, radii);
+
+	if (isParallel_ && count >= kParallelThreshold)
+	{
+		// 自分の補正量にしか書かないので、ワーカーに分けても結果は直列と同じ
+		std::atomic<uint32_t> tests = 0;
+		JobSystem::GetInstance()->ParallelFor(count, kSolveGrain, [&](size_t begin, size_t end) {
+			uint32_t localTests = 0;
+			for (size_t i = begin; i < end; ++i)
+			{
+				outCorrections[i] = SolveAgent(static_cast<uint32_t>(i), positions[i], radii[i], dt, localTests);
+			}
+			tests += localTests;
+			});
+		neighborTests_ = tests;
+	}
+	else
+	{
+		uint32_t tests = 0;
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			outCorrections[i] = SolveAgent(i, positions[i], radii[i], dt, tests);
+		}
+		neighborTests_ = tests;
+	}
+
+	solveMilliseconds_ = ElapsedMilliseconds(startTime);
+}
+
+
+/// -------------------------------------------------------------
+///				　	全員同士で補正量を求める
+/// -------------------------------------------------------------
+void CrowdSeparation::SolveBruteForce(const std::vector<Vector3>& positions, const std::vector<float>& radii, float dt, std::vector<Vector3>& outCorrections)
+{
+	const uint32_t count = static_cast<uint32_t>(positions.size());
+	outCorrections.resize(count);
+
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		Vector3 accum{};
+		for (uint32_t j = 0; j < count; ++j)
+		{
+			if (j == i) continue;
+			Accumulate(positions[i].x, positions[i].z, radii[i], positions[j].x, positions[j].z, radii[j], accum);
+		}
+		outCorrections[i] = Clamp(accum, dt);
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　		ベンチマーク
+/// -------------------------------------------------------------
+void CrowdSeparation::RunBenchmark()
+{
+	constexpr uint32_t kAgentCounts[] = { 100, 1000, 10000 };
+	constexpr uint32_t kRepeatCount = 5;
+	constexpr float kDeltaTime = 1.0f / 60.0f;
+
+	benchmarkResults_.clear();
+	std::mt19937 random(12345);
+
+	std::vector<Vector3> positions;
+	std::vector<float> radii;
+	std::vector<Vector3> grid, brute, sequential, reference;
+	const bool wasParallel = isParallel_;
+
+	for (uint32_t agentCount : kAgentCounts)
+	{
+		// 人数が増えても密度が同じになるように広げる（1体あたり約9m²）
+		const float halfSide = std::sqrt(static_cast<float>(agentCount)) * 1.5f;
+		std::uniform_real_distribution<float> coordinate(-halfSide, halfSide);
+		std::uniform_real_distribution<float> radius(0.8f, 1.6f);
+
+		positions.resize(agentCount);
+		radii.resize(agentCount);
+		for (uint32_t i = 0; i < agentCount; ++i)
+		{
+			positions[i] = { coordinate(random), 1.0f, coordinate(random) };
+			radii[i] = radius(random);
+		}
+
+		BenchmarkResult result;
+		result.agentCount = agentCount;
+
+		auto measure = [&](auto&& solve) {
+			const auto startTime = Clock::now();
+			for (uint32_t n = 0; n < kRepeatCount; ++n) solve();
+			return ElapsedMilliseconds(startTime) / static_cast<float>(kRepeatCount);
+			};
+
+		isParallel_ = false;
+		result.gridMilliseconds = measure([&] { Solve(positions, radii, kDeltaTime, grid); });
+		result.neighborTests = neighborTests_;
+
+		isParallel_ = true;
+		result.parallelMilliseconds = measure([&] { Solve(positions, radii, kDeltaTime, grid); });
+
+		result.bruteMilliseconds = measure([&] { SolveBruteForce(positions, radii, kDeltaTime, brute); });
+
+		// 1体ずつ押して動かす（ゲームと同じ使い方）
+		result.sequentialMilliseconds = measure([&] {
+			Clear();
+			for (uint32_t i = 0; i < agentCount; ++i) AddAgent(positions[i], radii[i]);
+			BeginFrame();
+			sequential = positions;
+			for (uint32_t i = 0; i < agentCount; ++i)
+			{
+				sequential[i] += Separate(i, sequential[i], kDeltaTime);
+				Move(i, sequential[i]);
+			}
+			});
+
+		// 同じ順番で全員同士を調べて1体ずつ動かしたもの（以前の Enemy::SeparateFromNeighbors）
+		reference = positions;
+		for (uint32_t i = 0; i < agentCount; ++i)
+		{
+			Vector3 accum{};
+			for (uint32_t j = 0; j < agentCount; ++j)
+			{
+				if (j == i) continue;
+				Accumulate(reference[i].x, reference[i].z, radii[i], reference[j].x, reference[j].z, radii[j], accum);
+			}
+			reference[i] += Clamp(accum, kDeltaTime);
+		}
+
+		// 足し合わせる順番だけが違うので、差は丸め誤差の範囲に収まる
+		for (uint32_t i = 0; i < agentCount; ++i)
+		{
+			const Vector3 d = grid[i] - brute[i];
+			result.maxError = std::max(result.maxError, std::max({ std::fabs(d.x), std::fabs(d.y), std::fabs(d.z) }));
+
+			const Vector3 e = sequential[i] - reference[i];
+			result.sequentialMaxError = std::max(result.sequentialMaxError, std::max({ std::fabs(e.x), std::fabs(e.y), std::fabs(e.z) }));
+		}
+
+		benchmarkResults_.push_back(result);
+	}
+
+	isParallel_ = wasParallel;
+
+	for (const BenchmarkResult& result : benchmarkResults_)
+	{
+		Log(std::format("[CrowdSeparation] {:5} agents grid {:8.3f} ms parallel {:8.3f} ms sequential {:8.3f} ms brute {:9.3f} ms ({} tests, max error {:.2e} / {:.2e})\n",
+			result.agentCount, result.gridMilliseconds, result.parallelMilliseconds, result.sequentialMilliseconds, result.bruteMilliseconds,
+			result.neighborTests, result.maxError, result.sequentialMaxError));
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　			ImGui描画処理
+/// -------------------------------------------------------------
+void CrowdSeparation::DrawImGui()
+{
+	ImGui::Begin("Crowd");
+	ImGui::Text("Agents : %u (cell %.2f, %u tests, %.3f ms)", GetAgentCount(), cellSize_, neighborTests_, solveMilliseconds_);
+	ImGui::Checkbox("Parallel", &isParallel_);
+
+	if (ImGui::Button("Run Benchmark")) RunBenchmark();
+	for (const BenchmarkResult& result : benchmarkResults_)
+	{
+		ImGui::Text("%5u grid %7.3f ms / parallel %7.3f ms / sequential %7.3f ms / brute %8.3f ms (err %.1e / %.1e)",
+			result.agentCount, result.gridMilliseconds, result.parallelMilliseconds, result.sequentialMilliseconds, result.bruteMilliseconds,
+			result.maxError, result.sequentialMaxError);
+	}
+	ImGui::End();
+}
+
+
+/// -------------------------------------------------------------
+///				　		セルごとにまとめ直す
+/// -------------------------------------------------------------
+void CrowdSeparation::Build(const std::vector<Vector3>& positions, const std::vector<float>& radii)
+{
+	const uint32_t count = static_cast<uint32_t>(positions.size());
+
+	// 押し合う距離は半径の和なので、最大半径の2倍をセルにすれば隣の 3x3 セルだけで足りる
+	float maxRadius = kEpsilon;
+	for (float radius : radii) maxRadius = std::max(maxRadius, radius);
+	cellSize_ = maxRadius * 2.0f;
+	invCellSize_ = 1.0f / cellSize_;
+
+	// バケット数は人数の2倍以上の2の累乗（別のセルが同じバケットに入っても距離で弾かれる）
+	const uint32_t bucketCount = std::bit_ceil(std::max(count * 2u, 16u));
+	bucketMask_ = bucketCount - 1;
+
+	// 数えて累積和を取り、番号順に詰める（同じバケット内は番号順のまま）
+	bucketStart_.assign(bucketCount + 1, 0);
+	agentCells_.resize(count);
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		agentCells_[i] = Hash(ToCell(positions[i].x), ToCell(positions[i].z));
+		++bucketStart_[agentCells_[i] + 1];
+	}
+	for (uint32_t b = 0; b < bucketCount; ++b) bucketStart_[b + 1] += bucketStart_[b];
+
+	sortedAgents_.resize(count);
+	agentSlots_.resize(count);
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		agentSlots_[i] = bucketStart_[agentCells_[i]]++;
+		sortedAgents_[agentSlots_[i]] = { positions[i].x, positions[i].z, radii[i], i };
+	}
+	movedAgents_.clear();
+
+	// 詰めるときに進めた開始位置を1つずつ戻す
+	for (uint32_t b = bucketCount; b > 0; --b) bucketStart_[b] = bucketStart_[b - 1];
+	bucketStart_[0] = 0;
+}
+
+
+/// -------------------------------------------------------------
+///				　		1体分の補正量
+/// -------------------------------------------------------------
+Vector3 CrowdSeparation::SolveAgent(uint32_t index, const Vector3& position, float radius, float dt, uint32_t& tests) const
+{
+	const int32_t cx = ToCell(position.x);
+	const int32_t cz = ToCell(position.z);
+
+	// 隣のセルが同じバケットになることがあるので、調べたバケットは飛ばす
+	uint32_t visited[9];
+	uint32_t visitedCount = 0;
+
+	Vector3 accum{};
+	for (int32_t dx = -1; dx <= 1; ++dx)
+	{
+		for (int32_t dz = -1; dz <= 1; ++dz)
+		{
+			const uint32_t bucket = Hash(cx + dx, cz + dz);
+			if (std::find(visited, visited + visitedCount, bucket) != visited + visitedCount) continue;
+			visited[visitedCount++] = bucket;
+
+			for (uint32_t k = bucketStart_[bucket]; k < bucketStart_[bucket + 1]; ++k)
+			{
+				const SortedAgent& other = sortedAgents_[k];
+				if (other.index == index) continue;
+				++tests;
+				Accumulate(position.x, position.z, radius, other.x, other.z, other.radius, accum);
+			}
+		}
+	}
+
+	// 別のバケットに移った仲間は少ないので全員見る
+	for (const SortedAgent& other : movedAgents_)
+	{
+		if (other.index == index) continue;
+		++tests;
+		Accumulate(position.x, position.z, radius, other.x, other.z, other.radius, accum);
+	}
+
+	return Clamp(accum, dt);
+}
+
+
+/// -------------------------------------------------------------
+///				　	セル座標とバケット
+/// -------------------------------------------------------------
+int32_t CrowdSeparation::ToCell(float v) const
+{
+	return static_cast<int32_t>(std::floor(v * invCellSize_));
+}
+
+uint32_t CrowdSeparation::Hash(int32_t x, int32_t z) const
+{
+	const uint32_t h = static_cast<uint32_t>(x) * 73856093u ^ static_cast<uint32_t>(z) * 19349663u;
+	return h & bucketMask_;
+}
+
+
+/// -------------------------------------------------------------
+///				　		1組分の押し戻し
+/// -------------------------------------------------------------
+void CrowdSeparation::Accumulate(float selfX, float selfZ, float selfRadius, float otherX, float otherZ, float otherRadius, Vector3& accum)
+{
+	// 内側のループなので Vector3 の演算子を通さずに成分で計算する
+	const float dx = selfX - otherX;
+	const float dz = selfZ - otherZ;
+	const float minDist = selfRadius + otherRadius; // 望ましい最小距離
+
+	// 遠い相手は平方根を取らずに落とす
+	const float lengthSq = dx * dx + dz * dz;
+	if (lengthSq >= minDist * minDist) return;
+
+	const float length = std::sqrt(lengthSq);
+	if (length > kEpsilon)
+	{
+		const float scale = (minDist - length) / length; // 押し戻し方向 × 重なり量
+		accum.x += dx * scale;
+		accum.z += dz * scale;
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　	積算した押し戻しをクランプ
+/// -------------------------------------------------------------
+Vector3 CrowdSeparation::Clamp(const Vector3& accum, float dt)
+{
+	const float length = Vector3::Length(accum);
+	if (length <= kEpsilon) return {};
+	return accum * (std::min(length, kMaxPushPerSecond * dt) / length);
+}
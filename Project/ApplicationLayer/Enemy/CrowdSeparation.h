@@ -0,0 +1,136 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Vector3.h"
+
+
+/// -------------------------------------------------------------
+///		群れの押し合い（XZ平面の空間ハッシュで近傍だけを調べる）
+/// -------------------------------------------------------------
+class CrowdSeparation
+{
+public: /// ---------- 構造体 ---------- ///
+
+	// ベンチマークの結果
+	struct BenchmarkResult
+	{
+		uint32_t agentCount = 0;
+		float gridMilliseconds = 0.0f;     // グリッド（直列）
+		float parallelMilliseconds = 0.0f; // グリッド（並列）
+		float sequentialMilliseconds = 0.0f; // グリッド（1体ずつ押して動かす。ゲームと同じ）
+		float bruteMilliseconds = 0.0f;    // 全員同士
+		uint32_t neighborTests = 0;        // グリッドで距離を調べた組
+		float maxError = 0.0f;             // 全員同士との補正量の差の最大
+		float sequentialMaxError = 0.0f;   // 1体ずつ全員同士を調べた場合との位置の差の最大
+	};
+
+public: /// ---------- メンバ関数 ---------- ///
+
+	// 1体ずつ押し離す（以前の Enemy::SeparateFromNeighbors と同じく、先に動いた仲間は動いたあとの位置で見る）
+	// 毎フレーム Clear → AddAgent（全員）→ BeginFrame のあと、更新順に Separate → Move を呼ぶ
+	void Clear() { positions_.clear(); radii_.clear(); }
+	uint32_t AddAgent(const Vector3& position, float radius);
+	void BeginFrame();
+
+	// 今の位置での補正量（dt 秒あたり最大 kMaxPushPerSecond * dt）
+	Vector3 Separate(uint32_t index, const Vector3& position, float dt);
+
+	// 動いたあとの位置を知らせる（このあとに Separate する仲間から見える）
+	void Move(uint32_t index, const Vector3& position);
+
+	// 位置と半径（同じ数）から、全員がその位置のまま水平に押し離す補正量をまとめて求める（並列にできる）
+	void Solve(const std::vector<Vector3>& positions, const std::vector<float>& radii, float dt, std::vector<Vector3>& outCorrections);
+
+	// 全員同士を調べる版（Solve と同じ結果になる。確認用）
+	static void SolveBruteForce(const std::vector<Vector3>& positions, const std::vector<float>& radii, float dt, std::vector<Vector3>& outCorrections);
+
+	// 100 / 1000 / 10000 体で計測（結果はログにも出る）
+	void RunBenchmark();
+
+	// ImGui描画処理
+	void DrawImGui();
+
+public: /// ---------- 設定 ---------- ///
+
+	// 並列で解くか
+	void SetParallel(bool isParallel) { isParallel_ = isParallel; }
+
+public: /// ---------- ゲッター ---------- ///
+
+	uint32_t GetAgentCount() const { return static_cast<uint32_t>(agentCells_.size()); }
+	uint32_t GetNeighborTestCount() const { return neighborTests_; }
+	float GetCellSize() const { return cellSize_; }
+	float GetSolveMilliseconds() const { return solveMilliseconds_; }
+
+public: /// ---------- 定数 ---------- ///
+
+	static constexpr float kMaxPushPerSecond = 6.0f; // 1秒あたり最大押し戻し量
+	static constexpr float kEpsilon = 1.0e-4f;
+
+private: /// ---------- 構造体 ---------- ///
+
+	// バケット順に並べた1体分（近傍を調べるときに連続して読めるようにする）
+	struct SortedAgent
+	{
+		float x;
+		float z;
+		float radius;
+		uint32_t index; // 元の番号
+	};
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	// セルごとにまとめ直す（バケットごとの数え上げソート）
+	void Build(const std::vector<Vector3>& positions, const std::vector<float>& radii);
+
+	// 1体分の補正量（近傍のバケットと、別のバケットに移った仲間だけを調べる）
+	Vector3 SolveAgent(uint32_t index, const Vector3& position, float radius, float dt, uint32_t& tests) const;
+
+	// セル座標とバケット
+	int32_t ToCell(float v) const;
+	uint32_t Hash(int32_t x, int32_t z) const;
+
+	// 1組分の押し戻し（全員同士版と同じ式。水平だけを見る）
+	static void Accumulate(float selfX, float selfZ, float selfRadius, float otherX, float otherZ, float otherRadius, Vector3& accum);
+
+	// 積算した押し戻しを dt でクランプ
+	static Vector3 Clamp(const Vector3& accum, float dt);
+
+private: /// ---------- 定数 ---------- ///
+
+	// 並列時の1チャンクあたりの人数
+	static constexpr size_t kSolveGrain = 256;
+
+	// 並列にする人数の下限
+	static constexpr uint32_t kParallelThreshold = 512;
+
+	// agentSlots_ で、移った仲間の一覧の位置であることを示すビット
+	static constexpr uint32_t kMovedBit = 0x80000000u;
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	// バケット（容量は2の累乗）ごとの開始位置と、バケット順に並べた番号
+	std::vector<uint32_t> bucketStart_;
+	std::vector<SortedAgent> sortedAgents_;
+	std::vector<uint32_t> agentCells_; // 番号 → バケット
+	std::vector<uint32_t> agentSlots_; // 番号 → sortedAgents_ の位置（kMovedBit 付きなら movedAgents_ の位置）
+	std::vector<SortedAgent> movedAgents_; // BeginFrame のあとで別のバケットに移った仲間
+	uint32_t bucketMask_ = 0;
+
+	// 1体ずつ押し離すときの位置と半径（毎フレーム作り直すので使い回す）
+	std::vector<Vector3> positions_;
+	std::vector<float> radii_;
+
+	float cellSize_ = 1.0f;
+	float invCellSize_ = 1.0f;
+
+	bool isParallel_ = true;
+
+	// 統計
+	uint32_t neighborTests_ = 0;
+	float solveMilliseconds_ = 0.0f;
+
+	// ベンチマーク
+	std::vector<BenchmarkResult> benchmarkResults_;
+};
@@ -6,6 +6,7 @@
 #include "LinearInterpolation.h"
 
 #include "ItemManager.h"
+#include "CollisionManager.h"
 
 #include <algorithm>
 #include <cmath> // atan2f
@@ -116,8 +117,12 @@ void Enemy::Update()
 		model_->SetRotate({ 0.0f, yaw, 0.0f });
 	}
 
-	// 近い仲間とは水平に分離
-	SeparateFromNeighbors(pos, dt);
+	// 近い仲間とは水平に分離（先に更新した仲間は動いたあとの位置で、まだの仲間はフレーム開始時の位置で見る）
+	if (crowd_) {
+		pos += crowd_->Separate(crowdIndex_, pos, dt);
+		if (pos.y < 0.0f) pos.y = 0.0f; // 地面クランプ維持
+		crowd_->Move(crowdIndex_, pos);
+	}
 
 	fireTimer_ -= dt;
 	TryRangedAttack(dist, dt);
@@ -154,6 +159,7 @@ void Enemy::TakeDamage(float damage)
 	{
 		hp_ = 0.0f;
 		isDead_ = true;
+		Unregister(); // 当たり判定から外す
 
 		// ★死亡が確定した瞬間に一度だけキル加算
 		ScoreManager::GetInstance()->AddKill();
@@ -190,43 +196,24 @@ void Enemy::ApplyMeleeDamage()
 	player_->TakeDamage(dps_ * dt);
 }
 
-void Enemy::SeparateFromNeighbors(Vector3& currentPos, float dt)
+void Enemy::BeginCrowd(CrowdSeparation& crowd)
 {
-	const float selfR = avoidRadius_;
-	const float maxPushPerSec = 6.0f;          // 1秒あたり最大押し戻し量（調整用）
-	const float eps = 1e-4f;
-
-	Vector3 accum{}; // 積算補正
-
+	// 召喚中の敵は押し返されないが、押す側としては数える
+	crowd.Clear();
 	for (Enemy* e : sActives) {
-		if (e == this || e->isDead_) continue;
-		Vector3 op = e->model_->GetTranslate();   // 相手の位置
-		Vector3 d = currentPos - op; d.y = 0.0f;         // 水平だけを見る
-		float L = Vector3::Length(d);
-		const float minDist = selfR + e->avoidRadius_; // 望ましい最小距離
-
-		if (L > eps && L < minDist) {
-			Vector3 n = d / L;                    // 押し戻し方向
-			float overlap = (minDist - L);        // 重なり量
-			accum += n * overlap;                 // まず合力で貯める
-		}
-	}
-
-	// 積算補正を時間でスケール＆クランプして適用
-	float len = Vector3::Length(accum);
-	if (len > eps) {
-		Vector3 corr = (accum / len) * std::min(len, maxPushPerSec * dt);
-		currentPos += corr;
-		// 地面クランプ維持
-		if (currentPos.y < 0.0f) currentPos.y = 0.0f;
+		e->crowd_ = nullptr;
+		if (e->isDead_) continue;
+		e->crowd_ = &crowd;
+		e->crowdIndex_ = crowd.AddAgent(e->model_->GetTranslate(), e->avoidRadius_);
 	}
+	crowd.BeginFrame();
 }
 
 void Enemy::TryRangedAttack(float dist, float dt)
 {
 	if (!player_ || isDead_) return;
 
-	// 視界判定などは後で足す。まずは距離＆クールダウンのみ
+	// 距離＆クールダウン、射線が通っているか
 	if (dist <= fireRange_ && fireTimer_ <= 0.0f) {
 		// マズル位置を少し高めに
 		Vector3 from = model_->GetTranslate();
@@ -237,6 +224,22 @@ void Enemy::TryRangedAttack(float dist, float dt)
 		float len = Vector3::Length(dir);
 		if (len > 1e-5f) dir = dir / len; else dir = { 0,0,1 };
 
+		// プレイヤーより手前で仲間やボス・地形に当たるなら撃たない（次のフレームで撃ち直す）
+		if (const CollisionManager* collisionManager = GetCollisionManager()) {
+			const uint32_t mask =
+				CollisionManager::ToTypeMask(CollisionTypeIdDef::kPlayer) |
+				CollisionManager::ToTypeMask(CollisionTypeIdDef::kEnemy) |
+				CollisionManager::ToTypeMask(CollisionTypeIdDef::kBoss);
+
+			CollisionManager::RaycastHit hit;
+			if (collisionManager->RaycastClosest(from, dir, len, mask, hit, this) &&
+				hit.typeId != static_cast<uint32_t>(CollisionTypeIdDef::kPlayer)) return;
+
+			// 地形に遮られていても撃たない（狙う位置は足元なので、直前の地面は数えない）
+			StaticMeshBVH::Hit wallHit;
+			if (collisionManager->GetStaticMesh().Raycast(from, dir, std::max(len - 1.0f, 0.0f), wallHit)) return;
+		}
+
 		const float bulletSpeed = 24.0f;
 		EnemyBullet::Create(from, dir * bulletSpeed, fireDamage_);
 
@@ -5,6 +5,7 @@
 #include "ItemDropTable.h"
 #include "Collider.h"
 #include "CollisionTypeIdDef.h"
+#include "CrowdSeparation.h"
 #include <memory>
 
 /// ---------- 前方宣言 ---------- ///
@@ -44,14 +45,15 @@ public: /// ---------- メンバ関数 ---------- ///
 	// ドロップ位置を返すヘルパ（モデル座標など）
 	Vector3 GetWorldPosition() const;  // 実装は model_->GetTranslate() を返すだけ
 
+	// 生きている敵全員をフレーム開始時の位置で押し合いに登録する（敵の Update より前に毎フレーム呼ぶ）
+	static void BeginCrowd(CrowdSeparation& crowd);
+
 private: /// ---------- ヘルパー関数 ---------- ///
 
 	Vector3 PlayerWorldPosition();
 
 	void ApplyMeleeDamage();
 
-	void SeparateFromNeighbors(Vector3& currentPos, float dt);
-
 	void TryRangedAttack(float dist, float dt);
 
 private: /// ---------- メンバ変数 ---------- ///
@@ -64,6 +66,8 @@ private: /// ---------- メンバ変数 ---------- ///
 
 	static std::vector<Enemy*> sActives;   // アクティブ敵の一覧
 	float avoidRadius_ = 1.2f;             // 体の半径（OBB半径相当でOK）
+	CrowdSeparation* crowd_ = nullptr;     // このフレームの押し合い（BeginCrowd で登録されていなければ nullptr）
+	uint32_t crowdIndex_ = 0;              // 押し合いでの番号
 
 	Vector3 knockVel_{}; // ノックバック速度
 
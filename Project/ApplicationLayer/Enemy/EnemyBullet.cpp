@@ -1,6 +1,8 @@
 #include "EnemyBullet.h"
 #include "Player.h"
 #include "LinearInterpolation.h"
+#include "CollisionUtility.h"
+#include "StaticMeshBVH.h"
 #include <cmath>
 
 std::vector<std::unique_ptr<EnemyBullet>> EnemyBullet::sBullets_;
@@ -17,7 +19,7 @@ void EnemyBullet::Create(const Vector3& pos, const Vector3& vel, float damage, f
 	sBullets_.push_back(std::unique_ptr<EnemyBullet>(new EnemyBullet(pos, vel, damage, life)));
 }
 
-void EnemyBullet::UpdateAll(Player* player, float dt)
+void EnemyBullet::UpdateAll(Player* player, float dt, const StaticMeshBVH* staticMesh)
 {
 	for (auto it = sBullets_.begin(); it != sBullets_.end();) {
 		auto& b = *it;
@@ -25,21 +27,28 @@ void EnemyBullet::UpdateAll(Player* player, float dt)
 		if (b->life_ <= 0.0f) { it = sBullets_.erase(it); continue; }
 
 		// 移動
-		b->pos_ += b->vel_ * dt;
+		const Vector3 start = b->pos_;
+		const Vector3 move = b->vel_ * dt;
+		b->pos_ += move;
 
-		// プレイヤーに命中？
+		// 地形に当たる位置（移動量に対する割合。当たらなければ 1 より先）
+		float wallT = 2.0f;
+		StaticMeshBVH::Hit wallHit;
+		if (staticMesh && staticMesh->IntersectSegment(Segment{ start, move }, wallHit)) wallT = wallHit.t;
+
+		// プレイヤーに命中？（移動前後を掃引するので dt が大きくてもすり抜けない。壁より奥なら当たらない）
 		if (player) {
-			Vector3 pp = player->GetAnimationModel()->GetTranslate();
-			Vector3 d = b->pos_ - pp;
-			float  L2 = d.x * d.x + d.y * d.y + d.z * d.z;
-			float  R = b->radius_;
-			if (L2 <= R * R) {
+			const Sphere target = { player->GetAnimationModel()->GetTranslate(), b->radius_ };
+			float toi = 0.0f;
+			if (CollisionUtility::SweepSphere(Sphere{ start, 0.0f }, move, target, toi) && toi <= wallT) {
 				player->TakeDamage(b->damage_);
 				it = sBullets_.erase(it);
 				continue;
 			}
 		}
 
+		if (wallT <= 1.0f) { it = sBullets_.erase(it); continue; }
+
 		// 見た目更新
 		b->model_->SetTranslate(b->pos_);
 		b->model_->Update();
@@ -5,6 +5,7 @@
 #include <Object3D.h>
 
 class Player;
+class StaticMeshBVH;
 
 /// -------------------------------------------------------------
 ///                     　　敵弾クラス
@@ -15,7 +16,8 @@ public: /// ---------- メンバ関数 ---------- ///
 
 	static void Create(const Vector3& pos, const Vector3& vel, float damage, float life = 3.0f);
 
-	static void UpdateAll(Player* player, float dt);
+	// staticMesh を渡すと地形に当たった弾を消す
+	static void UpdateAll(Player* player, float dt, const StaticMeshBVH* staticMesh = nullptr);
 
 	static void DrawAll();
 
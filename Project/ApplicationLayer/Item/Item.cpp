@@ -118,6 +118,7 @@ void Item::ApplyTo(Player* player)
 	}
 
 	collected_ = true;
+	Unregister(); // 取得済みは当たり判定から外す
 }
 
 void Item::OnCollision(Collider* other)
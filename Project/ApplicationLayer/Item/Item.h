@@ -41,14 +41,14 @@ public: /// ---------- オーバーライド ---------- ///
 	Vector3 GetCenterPosition() const override { return position_; }
 
 	// 中心座標を設定
-	void SetCenterPosition(const Vector3& pos) override { position_ = pos; }
+	void SetCenterPosition(const Vector3& pos) override { position_ = pos; MarkShapeDirty(); }
 
 	Vector3 GetOBBHalfSize() const override { return scale_; } // アイテムの大きさに応じて調整}
-	void SetOBBHalfSize(const Vector3& halfSize) override { scale_ = halfSize; }
+	void SetOBBHalfSize(const Vector3& halfSize) override { scale_ = halfSize; MarkShapeDirty(); }
 
 	// 回転（オイラー角）取得・設定
 	Vector3 GetOrientation() const override { return rotation_; }
-	void SetOrientation(const Vector3& rot) override { rotation_ = rot; }
+	void SetOrientation(const Vector3& rot) override { rotation_ = rot; MarkShapeDirty(); }
 
 private: /// ---------- メンバ変数 ---------- ///
 
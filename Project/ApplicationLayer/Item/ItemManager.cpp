@@ -4,7 +4,7 @@
 
 void ItemManager::Initialize()
 {
-	items_.clear();
+	items_.Clear();
 }
 
 void ItemManager::Update(Player* player)
@@ -22,11 +22,8 @@ void ItemManager::Update(Player* player)
 	}
 
 	// 寿命切れまたは取得済みのアイテムを削除
-	items_.erase(
-		std::remove_if(items_.begin(), items_.end(), [](const std::unique_ptr<Item>& item) {
-			return item->IsCollected() || item->IsExpired(); }),
-			items_.end()
-			);
+	items_.EraseIf([](const std::unique_ptr<Item>& item) {
+		return item->IsCollected() || item->IsExpired(); });
 }
 
 void ItemManager::Draw()
@@ -39,6 +36,9 @@ void ItemManager::Draw()
 
 void ItemManager::RegisterColliders(CollisionManager* collisionManager)
 {
+	// 以降に生成するアイテムも同じマネージャーに登録する
+	collisionManager_ = collisionManager;
+
 	for (auto& item : items_)
 	{
 		if (!item->IsCollected())
@@ -52,5 +52,6 @@ void ItemManager::Spawn(ItemType type, const Vector3& position)
 {
 	auto item = std::make_unique<Item>();
 	item->Initialize(type, position);
-	items_.push_back(std::move(item));
+	if (collisionManager_) collisionManager_->AddCollider(item.get());
+	items_.Insert(std::move(item));
 }
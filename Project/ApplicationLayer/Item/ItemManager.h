@@ -3,6 +3,7 @@
 #include <memory>
 #include "Item.h"
 #include "CollisionManager.h"
+#include "SlotMap.h"
 
 class Player;
 
@@ -26,5 +27,6 @@ public: /// ---------- メンバ関数 ---------- ///
 	void Spawn(ItemType type, const Vector3& position);
 
 private:
-	std::vector<std::unique_ptr<Item>> items_;
+	SlotMap<std::unique_ptr<Item>> items_; // 削除は末尾との入れ替えなので並び順は保証しない
+	CollisionManager* collisionManager_ = nullptr; // 生成したアイテムの登録先
 };
@@ -7,6 +7,7 @@
 #include <ParticleManager.h>
 #include <Boss.h>
 #include <Enemy.h>
+#include <CollisionManager.h>
 
 
 /// -------------------------------------------------------------
@@ -48,6 +49,12 @@ void Bullet::Initialize()
 /// -------------------------------------------------------------
 void Bullet::Update()
 {
+	// 前のフレームで地形に当たっていれば消す
+	if (isStaticHit_) { isDead_ = true; return; }
+
+	// 接触履歴のフレームを進める（このあとの衝突判定で Add される）
+	contactRecord_.NextFrame();
+
 	// 位置更新前に記録
 	previousPosition_ = position_;
 	position_ += velocity_;
@@ -61,6 +68,7 @@ void Bullet::Update()
 	float margin = 0.2f;
 	segment_.origin = previousPosition_;
 	segment_.diff = direction + normalized * margin;
+	ClipByStaticMesh();
 
 	// 描画・当たり判定更新
 	model_->SetTranslate(position_);
@@ -91,6 +99,7 @@ void Bullet::Draw()
 
 void Bullet::Simulate()
 {
+	if (isStaticHit_) { isDead_ = true; return; }
 	previousPosition_ = position_;
 	position_ += velocity_;
 	distanceTraveled_ += Vector3::Length(velocity_);
@@ -99,6 +108,7 @@ void Bullet::Simulate()
 	float margin = 0.2f;
 	segment_.origin = previousPosition_;
 	segment_.diff = dir + n * margin;
+	ClipByStaticMesh();
 	if (distanceTraveled_ >= maxDistance_) isDead_ = true;
 }
 
@@ -106,6 +116,7 @@ void Bullet::Simulate()
 void Bullet::Commit()
 {
 	if (isDead_) return;
+	contactRecord_.NextFrame();     // このあとの衝突判定に備えて接触履歴のフレームを進める
 	model_->SetTranslate(position_);
 	model_->SetRotate({ 0,0,0 });
 	model_->Update();               // ← D3D操作はここだけ
@@ -113,6 +124,25 @@ void Bullet::Commit()
 	SetSegment(segment_);
 }
 
+/// -------------------------------------------------------------
+///				　		地形で線分を止める
+/// -------------------------------------------------------------
+void Bullet::ClipByStaticMesh()
+{
+	const CollisionManager* collisionManager = GetCollisionManager();
+	if (!collisionManager) return;
+
+	// 壁より手前の敵にはこのフレームで当たれるように、線分を当たった位置までにして次のフレームで消す
+	StaticMeshBVH::Hit hit;
+	if (!collisionManager->GetStaticMesh().IntersectSegment(segment_, hit)) return;
+
+	segment_.diff = segment_.diff * hit.t;
+	position_ = hit.point;
+	velocity_ = { 0.0f, 0.0f, 0.0f };
+	isStaticHit_ = true;
+}
+
+
 /// -------------------------------------------------------------
 ///				　			衝突処理
 /// -------------------------------------------------------------
@@ -130,10 +160,10 @@ void Bullet::OnCollision(Collider* other)
 	// 衝突相手のユニークIDを取得
 	uint32_t targetID = other->GetUniqueID();
 
-	// すでに当たった相手かどうかを確認
+	// すでに当たった相手かどうかを確認（1発の弾が同じ相手に当たるのは生涯1回だけ）
 	if (contactRecord_.Check(targetID)) return; // すでに当たった相手なので無視
 
-	contactRecord_.Add(targetID); // 初めて当たった相手として記録
+	contactRecord_.Add(targetID); // 初めて当たった相手として記録（このフレームの接触にもなる）
 
 	if (other->GetTypeID() == static_cast<uint32_t>(CollisionTypeIdDef::kBoss))        // ★ 追加
 	{
@@ -189,4 +219,5 @@ void Bullet::OnCollision(Collider* other)
 	velocity_ = { 0,0,0 };
 	segment_.origin = { 0,0,0 };
 	segment_.diff = { 0,0,0 };
+	SetSegment(segment_); // 形状が変わったのでブロードフェーズのキャッシュも更新させる
 }
@@ -58,6 +58,11 @@ public: /// ---------- アクセッサ ---------- ///
 
 	void SetPlayer(Player* player) { player_ = player; } // プレイヤーへの参照を設定
 
+private: /// ---------- メンバ関数 ---------- ///
+
+	// 地形に当たったら線分を当たった位置で止める（ワーカーから呼ばれるので読み取りのみ）
+	void ClipByStaticMesh();
+
 private: /// ---------- メンバ変数 ---------- ///
 
 	Player* player_ = nullptr; // プレイヤーへの参照（必要なら）
@@ -73,5 +78,6 @@ private: /// ---------- メンバ変数 ---------- ///
 	float maxDistance_ = 1000.0f;         // 最大飛距離
 	float distanceTraveled_ = 0.0f;       // 現在の飛距離
 	bool isDead_ = false;                 // 死亡フラグ
+	bool isStaticHit_ = false;            // 地形に当たった（このフレームの判定を終えてから消す）
 	ContactRecord contactRecord_;         // 衝突記録
 };
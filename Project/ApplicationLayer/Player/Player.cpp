@@ -73,6 +73,12 @@ void Player::Initialize()
 	controller_->Initialize(animationModel_.get());
 	controller_->SetStaminaPointer(&stamina_);
 
+	// 部位の複合コライダー（子はボディパーツのジョイント番号で骨に付く）
+	bodyCollider_ = std::make_unique<CompoundCollider>();
+	bodyCollider_->SetTypeID(static_cast<uint32_t>(CollisionTypeIdDef::kPlayer));
+	bodyCollider_->SetOwner(this);
+	bodyCollider_->Bind(*animationModel_);
+
 	// HUDの初期化
 	numberSpriteDrawer_ = std::make_unique<NumberSpriteDrawer>();
 	numberSpriteDrawer_->Initialize("number.png", 50.0f, 50.0f);
@@ -128,24 +134,8 @@ void Player::Update()
 		}
 	}
 
-	// 毎フレームカプセルを骨に追従
-	auto partCaps = animationModel_->GetBodyPartCapsulesWorld();
-
-	if (bodyCols_.size() != partCaps.size()) {
-		// Bone 本数が変わったら作り直し（開発中のモデル差し替え対策）
-		bodyCols_.clear();
-		for (auto& [name, cap] : partCaps) {
-			auto c = std::make_unique<Collider>();
-			c->SetTypeID(static_cast<uint32_t>(CollisionTypeIdDef::kPlayer));
-			c->SetCapsule(cap);
-			c->SetOwner(this); // プレイヤーをオーナーに設定
-			bodyCols_.push_back({ name, std::move(c) });
-		}
-	}
-
-	for (size_t i = 0; i < partCaps.size(); ++i) {
-		bodyCols_[i].col->SetCapsule(partCaps[i].second);
-	}
+	// 毎フレーム部位カプセルを骨に追従（その場で書き換えるので確保も名前の検索もしない）
+	bodyCollider_->UpdateFromModel(*animationModel_);
 }
 
 
@@ -192,16 +182,9 @@ void Player::DrawImGui()
 	ImGui::Begin("Player Colliders");
 	static bool visible = false;
 	if (ImGui::Checkbox("Show All Capsules", &visible)) {
-		for (auto& pc : bodyCols_) {
-			pc.col->SetCapsuleVisible(visible);
-		}
-	}
-	for (size_t i = 0; i < bodyCols_.size(); ++i) {
-		if (ImGui::TreeNode(bodyCols_[i].name.c_str())) {
-			bodyCols_[i].col->DrawImGui();
-			ImGui::TreePop();
-		}
+		bodyCollider_->SetCapsuleVisible(visible);
 	}
+	bodyCollider_->DrawChildrenImGui();
 	ImGui::End();
 }
 
@@ -219,22 +202,25 @@ void Player::TakeDamage(float damage)
 	{
 		hp_ = 0.0f;
 		isDead_ = true;
+		Unregister(); // 部位カプセルは残す
 		Log("Player is dead");
 	}
 }
 
 void Player::RegisterColliders(CollisionManager* collisionManager) const
 {
-	// プレイヤーのコライダーを登録
-	collisionManager->AddCollider(const_cast<Player*>(this));
+	// プレイヤーのコライダーを登録（死亡時は TakeDamage で外れる）
+	if (!IsDead()) collisionManager->AddCollider(const_cast<Player*>(this));
 
-	// 部位カプセルをすべて登録
-	for (const auto& pc : bodyCols_) {
-		collisionManager->AddCollider(pc.col.get());
-	}
+	// 部位カプセルは外形1つで登録（子は外形に当たったときだけ調べられる）
+	collisionManager->AddCollider(bodyCollider_.get());
 
-	// プレイヤーが死亡している場合、コライダーを削除
-	if (IsDead()) collisionManager->RemoveCollider(const_cast<Player*>(this));
+	// すでに撃っている弾も登録（以降の弾は Weapon::CreateBullet で登録される）
+	for (const auto& weapon : weapons_) {
+		for (const auto& bullet : weapon->GetBullets()) {
+			if (!bullet->IsDead()) collisionManager->AddCollider(bullet.get());
+		}
+	}
 }
 
 
@@ -318,8 +304,9 @@ void Player::SetAnimationModel(std::shared_ptr<AnimationModel> model)
 		model->SetScale(animationModel_->GetScale());
 	}
 
-	// 新しいモデルに差し替え
+	// 新しいモデルに差し替え（ジョイント番号が変わるので部位も作り直す）
 	animationModel_ = model;
+	if (bodyCollider_) bodyCollider_->Bind(*animationModel_);
 
 	if (controller_) {
 		controller_->SetAnimationModel(model.get());
@@ -4,6 +4,7 @@
 #include "Weapon.h"
 #include <NumberSpriteDrawer.h>
 #include <Collider.h>
+#include <CompoundCollider.h>
 #include <AnimationModel.h>
 
 #include "PlayerBehavior.h"
@@ -33,13 +34,8 @@ enum class ModelState
 /// -------------------------------------------------------------
 class Player : public Collider
 {
-	// 各部位ごとの Collider を保持
-	struct PartCol
-	{
-		std::string name;
-		std::unique_ptr<Collider> col;
-	};
-	std::vector<PartCol> bodyCols_;
+	// 部位カプセルをまとめた複合コライダー（ブロードフェーズには外形だけが入る）
+	std::unique_ptr<CompoundCollider> bodyCollider_;
 
 public: /// ---------- メンバ関数 ---------- ///
 
@@ -173,6 +169,9 @@ public: /// ---------- セッタ ---------- ///
 
 	void SetAnimationModel(std::shared_ptr<AnimationModel> model);
 
+	// 移動で当たる静的な形状を設定
+	void SetStaticWorld(const StaticCollisionWorld* world) { controller_->SetStaticWorld(world); }
+
 private: /// ---------- メンバ変数 ---------- ///
 
 	Input* input_ = nullptr; // 入力クラス
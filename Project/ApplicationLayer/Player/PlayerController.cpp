@@ -23,6 +23,13 @@ void PlayerController::Initialize(AnimationModel* model)
 	coyoteTimer_ = 0.0f;
 	jumpBuffer_ = 0.0f;
 	fovInit_ = false;
+
+	// 当たり用のカプセル（足元から半径 0.4、高さ 1）
+	CharacterController::Settings settings{};
+	settings.radius = 0.4f;
+	settings.height = 1.0f;
+	settings.gravity = jumpConfig_.gravity;
+	character_.Initialize(model->GetTranslate(), settings);
 }
 
 /// -------------------------------------------------------------
@@ -140,7 +147,6 @@ void PlayerController::UpdateMovement(Camera* camera, float deltaTime, bool weap
 	// === コヨーテタイム & ジャンプバッファ（“許し”） ===
 	const float kCoyoteTime = 0.12f;
 	const float kJumpBuffer = 0.12f;
-	const float gravity = 18.0f;
 	const float jumpSpeed = 5.5f;
 
 	coyoteTimer_ = statusFlags_.isGrounded ? kCoyoteTime : std::max(0.0f, coyoteTimer_ - deltaTime);
@@ -154,20 +160,32 @@ void PlayerController::UpdateMovement(Camera* camera, float deltaTime, bool weap
 		inputFlags_.jump = false; // 消費
 	}
 
-	// 重力
-	velocity_.y -= gravity * deltaTime;
-
-	// 位置更新
-	pos += velocity_ * deltaTime;
+	if (staticWorld_) {
+		// 重力・押し出し・壁ずり・接地はキャラクター移動に任せる
+		character_.SetPosition(pos);
+		character_.SetVelocity(velocity_);
+		character_.Update(*staticWorld_, deltaTime);
 
-	// 簡易接地
-	if (pos.y <= 0.0f) {
-		pos.y = 0.0f;
-		velocity_.y = 0.0f;
-		statusFlags_.isGrounded = true;
+		pos = character_.GetPosition();
+		velocity_ = character_.GetVelocity();
+		statusFlags_.isGrounded = character_.IsGrounded();
 	}
 	else {
-		statusFlags_.isGrounded = false;
+		// 重力
+		velocity_.y -= jumpConfig_.gravity * deltaTime;
+
+		// 位置更新
+		pos += velocity_ * deltaTime;
+
+		// 簡易接地
+		if (pos.y <= 0.0f) {
+			pos.y = 0.0f;
+			velocity_.y = 0.0f;
+			statusFlags_.isGrounded = true;
+		}
+		else {
+			statusFlags_.isGrounded = false;
+		}
 	}
 
 	// 反映
@@ -1,5 +1,6 @@
 #pragma once
 #include "Vector3.h"
+#include "CharacterController.h"
 
 
 /// ---------- 前方宣言 ---------- ///
@@ -27,7 +28,7 @@ private: /// ---------- 構造体 ---------- ///
 	// ジャンプ状態を管理する構造体
 	struct JumpConfig
 	{
-		float gravity = -0.98f;	 // 重力加速度
+		float gravity = 18.0f;	 // 重力加速度（単位/秒²。キャラクター移動と簡易接地の両方で使う）
 		float jumpPower = 0.28f; // ジャンプ力
 		float jumpCost = 15.0f;  // ジャンプ時のスタミナ消費量
 	};
@@ -123,6 +124,9 @@ public: /// ---------- アクセサー関数 ---------- ///
 
 	void SetAnimationModel(AnimationModel* model) { animationModel_ = model; }
 
+	// 移動で当たる静的な形状（nullptr なら y = 0 の床だけ）
+	void SetStaticWorld(const StaticCollisionWorld* world) { staticWorld_ = world; }
+
 private: /// ---------- メンバ変数 ---------- ///
 
 	// スタミナの更新処理
@@ -133,6 +137,10 @@ private: /// ---------- メンバ変数 ---------- ///
 	AnimationModel* animationModel_ = nullptr;
 	Input* input_ = nullptr;
 
+	// 箱・床・地形に沿った移動
+	const StaticCollisionWorld* staticWorld_ = nullptr;
+	CharacterController character_;
+
 	Vector3 velocity_{};
 	Vector3 move_{};
 
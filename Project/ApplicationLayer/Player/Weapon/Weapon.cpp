@@ -4,9 +4,11 @@
 #include <AudioManager.h>
 #include <Player.h>
 #include <FpsCamera.h>
+#include <CollisionManager.h>
 
 #include <imgui.h>
 #include <ParticleManager.h>
+#include <JobSystem.h>
 
 
 /// -------------------------------------------------------------
@@ -75,34 +77,14 @@ void Weapon::Update()
 	}
 
 	// --- 物理だけ並列 Simulate ---
-	// Nが小さいときはスレッド起動コストのほうが高いので閾値を設ける
-	if (N < 256) {
-		for (size_t i = 0; i < N; ++i) {
-			auto& b = bullets_[i];
-			if (!b->IsDead()) b->Simulate();
+	// 常駐ワーカーに分割して流す（grain以下ならその場で直列処理される）
+	constexpr size_t kSimulateGrain = 128;
+	JobSystem::GetInstance()->ParallelFor(N, kSimulateGrain, [this](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i) {
+			auto& bullet = bullets_[i];
+			if (!bullet->IsDead()) bullet->Simulate();
 		}
-	}
-	else {
-		const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
-		// 過剰スレッドを避けるため、弾256個/スレッドを目安に上限をかける
-		const unsigned T = std::max(1u, std::min<unsigned>(hw, static_cast<unsigned>((N + 255) / 256)));
-		const size_t stride = (N + T - 1) / T;
-
-		std::vector<std::thread> ths;
-		ths.reserve(T);
-		auto worker = [&](size_t b, size_t e) {
-			for (size_t i = b; i < e; ++i) {
-				auto& bullet = bullets_[i];
-				if (!bullet->IsDead()) bullet->Simulate();
-			}
-			};
-		for (unsigned t = 0; t < T; ++t) {
-			const size_t b = t * stride;
-			const size_t e = std::min(N, b + stride);
-			if (b < e) ths.emplace_back(worker, b, e);
-		}
-		for (auto& th : ths) th.join();
-	}
+		});
 
 	// --- メインスレッドで描画/衝突登録 ---
 	for (auto& b : bullets_) b->Commit();
@@ -291,6 +273,9 @@ void Weapon::CreateBullet(const Vector3& position, const Vector3& direction)
 	bullet->SetVelocity(bulletVelocity);
 	bullet->SetDamage(ammoInfo_.bulletDamage);  // ダメージ
 	bullet->SetPlayer(player_);                 // 命中通知用に Player を渡す
+
+	// プレイヤーと同じマネージャーに登録（破棄されると自動的に外れる）
+	if (CollisionManager* collisionManager = player_->GetCollisionManager()) collisionManager->AddCollider(bullet.get());
 	bullets_.push_back(std::move(bullet));
 
 	// ✅ レーザービーム演出
@@ -86,9 +86,10 @@ void GamePlayScene::Initialize()
 
 	player_->SetCrosshair(crosshair_.get()); // プレイヤーにクロスヘアを設定
 
-	// 衝突マネージャの生成
+	// 衝突マネージャの生成（コライダーは生成時に一度だけ登録し、死亡・破棄時に外れる）
 	collisionManager_ = std::make_unique<CollisionManager>();
 	collisionManager_->Initialize();
+	player_->RegisterColliders(collisionManager_.get());
 
 	// HUDマネージャーの生成と初期化
 	hudManager_ = std::make_unique<HUDManager>();
@@ -103,12 +104,20 @@ void GamePlayScene::Initialize()
 	// 初期化内に追加（プレイヤー近くに1個スポーン）
 	itemManager_ = std::make_unique<ItemManager>();
 	itemManager_->Initialize();
+	itemManager_->RegisterColliders(collisionManager_.get());
 
 	terrein_ = std::make_unique<Object3D>();
 	// 地形オブジェクトの初期化
 	terrein_->Initialize("terrain.gltf");
 	terrein_->SetScale({ 50.0f, 50.0f, 50.0f });
 
+	// 地形の三角形から静的BVHを構築（弾・射線の判定に使う。地形は動かさない前提）
+	collisionManager_->BuildStaticMesh(terrein_->GetModelData(), Matrix4x4::MakeAffineMatrix(terrein_->GetScale(), terrein_->GetRotate(), terrein_->GetTranslate()));
+
+	// プレイヤーは地形と y = 0 の床の上を歩く
+	collisionManager_->GetStaticWorld().SetGroundHeight(0.0f);
+	player_->SetStaticWorld(&collisionManager_->GetStaticWorld());
+
 	skyBox_ = std::make_unique<SkyBox>();
 	skyBox_->Initialize("SkyBox/skybox.dds");
 }
@@ -168,7 +177,7 @@ void GamePlayScene::Update()
 
 	skyBox_->Update();
 
-	EnemyBullet::UpdateAll(player_.get(), player_->GetDeltaTime());
+	EnemyBullet::UpdateAll(player_.get(), player_->GetDeltaTime(), &collisionManager_->GetStaticMesh());
 
 }
 
@@ -279,6 +288,12 @@ void GamePlayScene::DrawImGui()
 	if (boss_) boss_->DrawImGui();
 
 	terrein_->DrawImGui();
+
+	// 衝突判定の統計
+	collisionManager_->DrawImGui();
+
+	// 敵の押し合いの統計
+	crowd_.DrawImGui();
 }
 
 
@@ -306,29 +321,8 @@ void GamePlayScene::UpdateDebug()
 /// -------------------------------------------------------------
 void GamePlayScene::CheckAllCollisions()
 {
-	// 衝突マネージャのリセット
-	collisionManager_->Reset();
-
-	// コライダーをリストに登録
-	player_->RegisterColliders(collisionManager_.get()); // プレイヤーのコライダーを登録
-	if (boss_) boss_->RegisterColliders(collisionManager_.get());
-
-	for (auto& enemy : enemies_)
-	{
-		if (enemy && !enemy->IsDead()) collisionManager_->AddCollider(enemy.get());
-	}
-
-	// プレイヤーの弾の登録
-	for (const auto& bullet : player_->GetBullets())
-	{
-		if (!bullet->IsDead()) collisionManager_->AddCollider(bullet.get());
-	}
-
-	// プレイヤーが死亡している場合、コライダーを削除
-	if (player_->IsDead()) collisionManager_->RemoveCollider(player_.get());
-
-	// アイテムのコライダーを登録
-	itemManager_->RegisterColliders(collisionManager_.get());
+	// コライダーは生成時に登録済み（弾・部位は持ち主と同じマネージャーに、死亡・破棄で自動的に外れる）
+	// ここでは動いたものだけがブロードフェーズに反映される
 
 	// 衝突判定と応答
 	collisionManager_->CheckAllCollisions();
@@ -367,6 +361,7 @@ void GamePlayScene::UpdatePlaying()
 
 	player_->Update();
 	if (boss_) boss_->Update();
+	Enemy::BeginCrowd(crowd_); // 押し合いは敵の更新順に1体ずつ解く
 	for (auto& enemy : enemies_) enemy->Update();
 
 	// ボスが死んだらリザルト画面へ移行
@@ -504,6 +499,7 @@ void GamePlayScene::UpdateWaveSpawner(float dt)
 					boss_ = std::make_unique<Boss>();
 					boss_->Initialize();
 					boss_->SetPlayer(player_.get());
+					boss_->RegisterColliders(collisionManager_.get());
 					bossSpawned_ = true;
 				}
 			}
@@ -519,6 +515,7 @@ void GamePlayScene::SpawnOneEnemy(const Vector3& pos)
 	auto enemy = std::make_unique<Enemy>();
 	enemy->Initialize(player_.get(), pos);
 	enemy->SetItemManager(itemManager_.get());
+	collisionManager_->AddCollider(enemy.get());
 	enemies_.push_back(std::move(enemy));
 }
 
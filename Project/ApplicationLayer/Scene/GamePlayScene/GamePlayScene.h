@@ -136,6 +136,7 @@ private: /// ---------- メンバ変数 ---------- ///
 
 	std::unique_ptr<Player> player_ = nullptr; // プレイヤーオブジェクト
 	std::vector<std::unique_ptr<Enemy>> enemies_; // 敵オブジェクトのリスト
+	CrowdSeparation crowd_; // 敵同士の押し合い（作業領域を使い回す）
 	std::unique_ptr<Boss> boss_ = nullptr;
 
 	std::unique_ptr<AnimationModel> dModel_;
@@ -8,16 +8,14 @@
 #include <SceneManager.h>
 #include <CollisionUtility.h>
 
+#include <cmath>
+
 #include <imgui.h>
 
 void PhysicalScene::Initialize()
 {
 	input_ = Input::GetInstance();
 
-	// カプセルの初期化
-	capsule_.segment = { { 0.0f, 0.5f, 0.0f }, { 0.0f, 1.5f, 0.0f } };
-	capsule_.radius = 0.3f;
-
 	// AABBの初期化（地面）
 	AABB ground;
 	ground.min = { -2.0f, -0.5f, -4.0f };
@@ -29,6 +27,26 @@ void PhysicalScene::Initialize()
 	wall.min = { +2.0f, -0.5f, -4.0f };
 	wall.max = { +2.2f, +1.5f, +4.0f };
 	aabbs_.emplace_back(ColliderType::Wall, wall);
+
+	// OBBの初期化（+Z に向かって登る20度の坂）
+	const float slope = 0.35f;
+	ramp_.center = { -0.5f, 0.3f, 2.0f };
+	ramp_.orientations[0] = { 1.0f, 0.0f, 0.0f };
+	ramp_.orientations[1] = { 0.0f, std::cos(slope), -std::sin(slope) };
+	ramp_.orientations[2] = { 0.0f, std::sin(slope), std::cos(slope) };
+	ramp_.size = { 0.8f, 0.1f, 1.2f };
+
+	// 当たり形状を登録
+	for (const auto& [type, aabb] : aabbs_) world_.AddBox(aabb);
+	world_.AddBox(ramp_);
+	world_.Build();
+
+	// キャラクターの初期化（足元から半径 0.3、高さ 1）
+	CharacterController::Settings settings{};
+	settings.radius = 0.3f;
+	settings.height = 1.0f;
+	settings.gravity = 36.0f;
+	character_.Initialize({ 0.0f, 0.2f, 0.0f }, settings);
 }
 
 void PhysicalScene::Update()
@@ -42,86 +60,20 @@ void PhysicalScene::Update()
 	if (input_->PushKey(DIK_D)) { move.x += 1.0f; }
 
 	if (Vector3::Length(move) > 0.0f) {
-		move = Vector3::Normalize(move) * 0.05f; // 移動スピード
+		move = Vector3::Normalize(move) * walkSpeed_; // 移動スピード
 	}
 
+	// --- 落下速度は残して、横の速度を入力で決める ---
+	Vector3 velocity = { move.x, character_.GetVelocity().y, move.z };
+
 	// --- ジャンプ ---
-	if (isGrounded_ && input_->TriggerKey(DIK_SPACE)) {
-		jumpVelocity_ = jumpPower_;
-		isGrounded_ = false;
+	if (character_.IsGrounded() && input_->TriggerKey(DIK_SPACE)) {
+		velocity.y = jumpPower_;
 	}
 
-	// --- Y軸速度に重力を適用 ---
-	jumpVelocity_ -= gravity_;
-	move.y += jumpVelocity_;
-
-	// --- カプセルの移動適用 ---
-	capsule_.segment.origin += move;
-	capsule_.segment.diff = Vector3{ 0.0f, 1.0f, 0.0f }; // 高さ1固定
-
-	const int kMaxCorrection = 4; // 多段補正回数の最大
-	for (int step = 0; step < kMaxCorrection; ++step) {
-		Vector3 bestPushVec{};
-		float bestDistSq = FLT_MAX;
-		ColliderType bestType = ColliderType::None;
-
-		for (const auto& [type, aabb] : aabbs_) {
-			if (!CollisionUtility::IsCollision(capsule_, aabb)) { continue; }
-
-			const int kSteps = 10;
-			for (int i = 0; i <= kSteps; ++i) {
-				float t = static_cast<float>(i) / kSteps;
-				Vector3 pt = capsule_.segment.origin + capsule_.segment.diff * t;
-
-				Vector3 closest = {
-					std::clamp(pt.x, aabb.min.x, aabb.max.x),
-					std::clamp(pt.y, aabb.min.y, aabb.max.y),
-					std::clamp(pt.z, aabb.min.z, aabb.max.z),
-				};
-
-				Vector3 diff = pt - closest;
-				float distSq = Vector3::Dot(diff, diff);
-
-				if (distSq < bestDistSq && distSq < capsule_.radius * capsule_.radius && distSq > 0.00001f) {
-					bestDistSq = distSq;
-					bestPushVec = diff;
-					bestType = type;
-				}
-			}
-		}
-
-		if (bestType == ColliderType::None) break;
-
-		float dist = std::sqrt(bestDistSq);
-		Vector3 pushDir = bestPushVec / dist;
-		float pushLen = capsule_.radius - dist;
-
-		Vector3 correction{};
-
-		if (bestType == ColliderType::Ground || bestType == ColliderType::Wall) {
-			if (pushDir.y > 0.0f) {
-				correction.y = pushDir.y * pushLen;
-
-				// 上から接触していれば接地扱い（Ground or Wall問わず）
-				if (pushDir.y > 0.5f) {
-					isGrounded_ = true;
-					jumpVelocity_ = 0.0f;
-				}
-			}
-
-			// 横方向補正（壁の場合のみ必要）
-			if (bestType == ColliderType::Wall) {
-				if (fabs(pushDir.x) > fabs(pushDir.z)) {
-					correction.x = pushDir.x * pushLen;
-				}
-				else {
-					correction.z = pushDir.z * pushLen;
-				}
-			}
-		}
-
-		capsule_.segment.origin += correction;
-	}
+	// --- 重力・押し出し・滑り・接地は固定サブステップで解く ---
+	character_.SetVelocity(velocity);
+	character_.Update(world_, ImGui::GetIO().DeltaTime);
 
 	for (const auto& [type, aabb] : aabbs_) {
 		Vector4 color;
@@ -138,9 +90,11 @@ void PhysicalScene::Update()
 		}
 		Wireframe::GetInstance()->DrawAABB(aabb, color);
 	}
+	Wireframe::GetInstance()->DrawOBB(ramp_, { 1.0f, 0.8f, 0.2f, 1.0f }); // 黄
 
-	// カプセル描画（常に赤で表示）
-	Wireframe::GetInstance()->DrawCapsule(capsule_, { 1.0f, 0.0f, 0.0f, 1.0f });
+	// カプセル描画（接地中は赤、空中は橙）
+	const Vector4 capsuleColor = character_.IsGrounded() ? Vector4{ 1.0f, 0.0f, 0.0f, 1.0f } : Vector4{ 1.0f, 0.5f, 0.0f, 1.0f };
+	Wireframe::GetInstance()->DrawCapsule(character_.GetCapsule(), capsuleColor);
 }
 
 void PhysicalScene::Draw3DObjects()
@@ -180,19 +134,49 @@ void PhysicalScene::DrawImGui()
 	ImGui::Begin("Physical Scene Debug");
 	ImGui::Text("AABB Min: (%.2f, %.2f, %.2f)", aabb_.min.x, aabb_.min.y, aabb_.min.z);
 	ImGui::Text("AABB Max: (%.2f, %.2f, %.2f)", aabb_.max.x, aabb_.max.y, aabb_.max.z);
-	ImGui::Text("Capsule Start: (%.2f, %.2f, %.2f)", capsule_.segment.origin.x, capsule_.segment.origin.y, capsule_.segment.origin.z);
-	ImGui::Text("Capsule End: (%.2f, %.2f, %.2f)",
-		capsule_.segment.origin.x + capsule_.segment.diff.x,
-		capsule_.segment.origin.y + capsule_.segment.diff.y,
-		capsule_.segment.origin.z + capsule_.segment.diff.z);
-	ImGui::Text("Capsule Radius: %.2f", capsule_.radius);
+	const Vector3& position = character_.GetPosition();
+	const Vector3& velocity = character_.GetVelocity();
+	ImGui::Text("Character Position: (%.2f, %.2f, %.2f)", position.x, position.y, position.z);
+	ImGui::Text("Character Velocity: (%.2f, %.2f, %.2f)", velocity.x, velocity.y, velocity.z);
+	ImGui::Text("Grounded: %s  Contacts: %u", character_.IsGrounded() ? "true" : "false", character_.GetContactCount());
+	for (uint32_t i = 0; i < character_.GetContactCount(); ++i) {
+		const CharacterController::ContactPlane& contact = character_.GetContact(i);
+		ImGui::Text("  Normal: (%.2f, %.2f, %.2f) Depth: %.4f", contact.normal.x, contact.normal.y, contact.normal.z, contact.depth);
+	}
 	ImGui::End();
 
 	ImGui::Begin("Physical Scene Controls");
 	ImGui::DragFloat3("AABB Min", &aabb_.min.x, 0.1f);
 	ImGui::DragFloat3("AABB Max", &aabb_.max.x, 0.1f);
-	ImGui::DragFloat3("Capsule Start", &capsule_.segment.origin.x, 0.1f);
-	ImGui::DragFloat3("Capsule End", &capsule_.segment.diff.x, 0.1f);
-	ImGui::DragFloat("Capsule Radius", &capsule_.radius, 0.1f, 0.0f, FLT_MAX);
+	Vector3 editPosition = character_.GetPosition();
+	if (ImGui::DragFloat3("Character Position", &editPosition.x, 0.1f)) {
+		character_.SetPosition(editPosition);
+	}
+	CharacterController::Settings settings = character_.GetSettings();
+	bool isChanged = false;
+	isChanged |= ImGui::DragFloat("Capsule Radius", &settings.radius, 0.01f, 0.05f, 1.0f);
+	isChanged |= ImGui::DragFloat("Capsule Height", &settings.height, 0.01f, 0.0f, 3.0f);
+	isChanged |= ImGui::DragFloat("Gravity", &settings.gravity, 0.1f, 0.0f, 100.0f);
+	if (isChanged) character_.SetSettings(settings);
+
+	// 1000体 × 1000箱で計測（直列と JobSystem の並列）
+	if (ImGui::Button("Run Benchmark")) {
+		benchmarkResult_ = CharacterController::RunBenchmark(1000, 1000);
+		hasBenchmarkResult_ = true;
+	}
+	if (hasBenchmarkResult_) {
+		ImGui::Text("%u controllers / %u boxes / %u frames", benchmarkResult_.controllerCount, benchmarkResult_.boxCount, benchmarkResult_.frameCount);
+		ImGui::Text("Serial: %.3f ms  Parallel: %.3f ms (per frame)", benchmarkResult_.serialMilliseconds, benchmarkResult_.parallelMilliseconds);
+		ImGui::Text("Grounded: %.0f%%  Max Penetration: %.2e  Parallel Error: %.1e",
+			benchmarkResult_.groundedRatio * 100.0f, benchmarkResult_.maxPenetration, benchmarkResult_.maxParallelError);
+	}
+
+	// 行列などの演算ごとの計測と、SIMD 版とスカラー版の一致
+	if (ImGui::Button("Run Math Benchmark")) mathBenchmark_.Run();
+	mathBenchmark_.DrawImGui();
+
+	// モデルキャッシュのキー・ヒット数・共有の確認と、同じモデルを大量に作ったときの計測
+	if (ImGui::Button("Run Asset Cache Benchmark")) assetCacheBenchmark_.Run();
+	assetCacheBenchmark_.DrawImGui();
 	ImGui::End();
 }
@@ -8,6 +8,10 @@
 #include <Segment.h>
 #include <Sphere.h>
 #include <Triangle.h>
+#include <CharacterController.h>
+#include <StaticCollisionWorld.h>
+#include <MathBenchmark.h>
+#include <AssetCacheBenchmark.h>
 
 #include <vector>
 
@@ -56,21 +60,26 @@ private: /// ---------- メンバ変数 ---------- ///
 	AABB wallAABB_ = {}; // 壁用のAABBを追加
 
 
-	Capsule capsule_ = {};
 	OBB obb_ = {};
 	Plane plane_ = {};
 	Segment segment_ = {};
 	Sphere sphere_ = {};
 	Triangle triangle_ = {};
 
-	float gravity_ = 0.01f; // 重力の値
-	bool isGrounded_ = false;     // 接地判定
-	float jumpVelocity_ = 0.0f;   // ジャンプの上向き速度
-	const float jumpPower_ = 0.25f; // ジャンプ初速度
-
-	// 壁判定
-	bool isWallCollision_ = false;
+	const float walkSpeed_ = 3.0f;  // 歩く速さ（単位/秒）
+	const float jumpPower_ = 15.0f; // ジャンプ初速度（単位/秒）
 
 	std::vector<std::pair<ColliderType, AABB>> aabbs_;
+	OBB ramp_ = {}; // 坂
+
+	// キャラクター移動
+	StaticCollisionWorld world_;
+	CharacterController character_;
+
+	// ベンチマーク
+	CharacterController::BenchmarkResult benchmarkResult_{};
+	bool hasBenchmarkResult_ = false;
+	MathBenchmark mathBenchmark_;
+	AssetCacheBenchmark assetCacheBenchmark_;
 };
 
@@ -225,9 +225,16 @@ void AnimationModel::Update()
 		auto& nodeAnimations = animation.nodeAnimations;
 		auto& joints = skeleton_->GetJoints();
 
-		// 2. ノードアニメーションの適用
-		for (auto& joint : joints)
+		// 2. ノードアニメーションの適用（キーの間にある回転は rotationBatch_ に積んで後でまとめて補間）
+		RotationBatch& batch = rotationBatch_;
+		batch.jointIndices.clear();
+		batch.fromX.clear(); batch.fromY.clear(); batch.fromZ.clear(); batch.fromW.clear();
+		batch.toX.clear(); batch.toY.clear(); batch.toZ.clear(); batch.toW.clear();
+		batch.t.clear();
+
+		for (uint32_t jointIndex = 0; jointIndex < joints.size(); ++jointIndex)
 		{
+			Joint& joint = joints[jointIndex];
 			auto it = nodeAnimations.find(joint.name);
 
 			// ノードアニメーションが見つからなかった場合は、親の行列を使用
@@ -235,18 +242,40 @@ void AnimationModel::Update()
 			{
 				NodeAnimation& nodeAnim = (*it).second;
 				Vector3 translate = CalculateValue(nodeAnim.translate, animationTime_);
-				Quaternion rotate = CalculateValue(nodeAnim.rotate, animationTime_);
 				Vector3 scale = CalculateValue(nodeAnim.scale, animationTime_);
 
 				// 座標系調整（Z軸反転で伸びを防ぐ）
 				joint.transform.translate = translate;
-				joint.transform.rotate = rotate;
 				joint.transform.scale = scale;
 
-				joint.localMatrix = Matrix4x4::MakeAffineMatrix(joint.transform.scale, joint.transform.rotate, joint.transform.translate);
+				size_t keyIndex = 0;
+				float t = 0.0f;
+				if (rotationInterpolation_ == RotationInterpolation::kSlerp)
+				{
+					joint.transform.rotate = CalculateValue(nodeAnim.rotate, animationTime_);
+				}
+				else if (FindKeyframeSpan(nodeAnim.rotate, animationTime_, keyIndex, t))
+				{
+					const Quaternion& from = nodeAnim.rotate[keyIndex].value;
+					const Quaternion& to = nodeAnim.rotate[keyIndex + 1].value;
+					batch.jointIndices.push_back(jointIndex);
+					batch.fromX.push_back(from.x); batch.fromY.push_back(from.y); batch.fromZ.push_back(from.z); batch.fromW.push_back(from.w);
+					batch.toX.push_back(to.x); batch.toY.push_back(to.y); batch.toZ.push_back(to.z); batch.toW.push_back(to.w);
+					batch.t.push_back(t);
+					continue; // 行列は補間の後で作る
+				}
+				else
+				{
+					joint.transform.rotate = nodeAnim.rotate[keyIndex].value;
+				}
+
+				joint.localMatrix = Affine3x4::MakeAffine(joint.transform.scale, joint.transform.rotate, joint.transform.translate);
 			}
 		}
 
+		// 積んだ回転をまとめて補間
+		InterpolateRotationBatch(joints);
+
 		// 3. スケルトンの更新
 		skeleton_->UpdateSkeleton();
 
@@ -358,10 +387,42 @@ void AnimationModel::DrawImGui()
 			}
 		}
 		ImGui::Checkbox("Use Compute Skinning", &useComputeSkinning_);
+
+		// 回転キーの補間の精度
+		int interpolation = static_cast<int>(rotationInterpolation_);
+		if (ImGui::Combo("Rotation Interpolation", &interpolation, "Slerp\0Fast Slerp\0Nlerp\0"))
+		{
+			rotationInterpolation_ = static_cast<RotationInterpolation>(interpolation);
+		}
 	}
 	ImGui::End();
 }
 
+
+/// -------------------------------------------------------------
+///				　		回転キーの一括補間
+/// -------------------------------------------------------------
+void AnimationModel::InterpolateRotationBatch(std::vector<Joint>& joints)
+{
+	RotationBatch& batch = rotationBatch_;
+	if (batch.jointIndices.empty()) return;
+
+	// 結果は from に上書きする
+	const QuaternionSoA from{ batch.fromX, batch.fromY, batch.fromZ, batch.fromW };
+	const QuaternionSoA to{ batch.toX, batch.toY, batch.toZ, batch.toW };
+	if (rotationInterpolation_ == RotationInterpolation::kNlerp)
+		Quaternion::NlerpN(from, to, batch.t, from);
+	else
+		Quaternion::SlerpN(from, to, batch.t, from);
+
+	for (size_t i = 0; i < batch.jointIndices.size(); ++i)
+	{
+		Joint& joint = joints[batch.jointIndices[i]];
+		joint.transform.rotate = { batch.fromX[i], batch.fromY[i], batch.fromZ[i], batch.fromW[i] };
+		joint.localMatrix = Affine3x4::MakeAffine(joint.transform.scale, joint.transform.rotate, joint.transform.translate);
+	}
+}
+
 void AnimationModel::Clear()
 {
 	animationMesh_.reset();
@@ -386,17 +447,13 @@ void AnimationModel::DrawSkeletonWireframe()
 	if (!skeleton_) { return; }
 
 	const auto& joints = skeleton_->GetJoints();
-	Matrix4x4 worldMatrix = Matrix4x4::MakeAffineMatrix(worldTransform.scale_, worldTransform.rotate_, worldTransform.translate_);
+	const Affine3x4 worldMatrix = Affine3x4::MakeAffine(worldTransform.scale_, worldTransform.rotate_, worldTransform.translate_);
+	ComputeJointWorldPositions(worldMatrix, jointWorldPositions_);
 
 	for (const auto& joint : joints) {
 		if (joint.parent.has_value()) {
-			const auto& parentJoint = joints[*joint.parent];
-
-			Vector3 parentLocal = parentJoint.skeletonSpaceMatrix.GetTranslation();
-			Vector3 jointLocal = joint.skeletonSpaceMatrix.GetTranslation();
-
-			Vector3 parentPos = Vector3::Transform(parentLocal, worldMatrix);
-			Vector3 jointPos = Vector3::Transform(jointLocal, worldMatrix);
+			const Vector3& parentPos = jointWorldPositions_[*joint.parent];
+			const Vector3& jointPos = jointWorldPositions_[joint.index];
 
 			Wireframe::GetInstance()->DrawLine(parentPos, jointPos, { 1.0f, 0.0f, 0.0f, 1.0f });
 		}
@@ -409,24 +466,22 @@ void AnimationModel::DrawBodyPartColliders()
 	if (!skeleton_) { return; }
 
 	const auto& joints = skeleton_->GetJoints();
-	Matrix4x4 worldMatrix = Matrix4x4::MakeAffineMatrix(worldTransform.scale_, worldTransform.rotate_, worldTransform.translate_);
+	const Affine3x4 worldMatrix = Affine3x4::MakeAffine(worldTransform.scale_, worldTransform.rotate_, worldTransform.translate_);
+	ComputeJointWorldPositions(worldMatrix, jointWorldPositions_);
 
 	for (const auto& part : bodyPartColliders_) {
 		if (part.endJointIndex < 0) {
-			// スフィア用
+			// スフィア用（オフセットはジョイントの空間で足してから変換する）
 			const auto& joint = joints[part.startJointIndex];
 			Vector3 localPos = joint.skeletonSpaceMatrix.GetTranslation() + part.offset;
-			Vector3 worldPos = Vector3::Transform(localPos, worldMatrix);
+			Vector3 worldPos = worldMatrix.TransformPoint(localPos);
 
 			Wireframe::GetInstance()->DrawSphere(worldPos, part.radius, { 0.0f, 1.0f, 0.0f, 1.0f });
 		}
 		else {
 			// カプセル用
-			const auto& jointA = joints[part.startJointIndex];
-			const auto& jointB = joints[part.endJointIndex];
-
-			Vector3 a = Vector3::Transform(jointA.skeletonSpaceMatrix.GetTranslation(), worldMatrix);
-			Vector3 b = Vector3::Transform(jointB.skeletonSpaceMatrix.GetTranslation(), worldMatrix);
+			const Vector3& a = jointWorldPositions_[part.startJointIndex];
+			const Vector3& b = jointWorldPositions_[part.endJointIndex];
 
 			Vector3 center = (a + b) * 0.5f;
 			Vector3 axis = Vector3::Normalize(b - a);
@@ -443,8 +498,11 @@ std::vector<std::pair<std::string, Capsule>> AnimationModel::GetBodyPartCapsules
 	if (!skeleton_) { return out; }
 
 	const auto& joints = skeleton_->GetJoints();
-	Matrix4x4 worldMatrix = Matrix4x4::MakeAffineMatrix(worldTransform.scale_, worldTransform.rotate_, worldTransform.translate_);
+	const Affine3x4 worldMatrix = Affine3x4::MakeAffine(worldTransform.scale_, worldTransform.rotate_, worldTransform.translate_);
+	std::vector<Vector3> positions;
+	ComputeJointWorldPositions(worldMatrix, positions);
 
+	out.reserve(bodyPartColliders_.size());
 	for (const auto& part : bodyPartColliders_)
 	{
 		Capsule capsule{};
@@ -453,35 +511,53 @@ std::vector<std::pair<std::string, Capsule>> AnimationModel::GetBodyPartCapsules
 		if (part.endJointIndex < 0) {
 			// Sphere → pointA = pointB
 			const Vector3  local = joints[part.startJointIndex].skeletonSpaceMatrix.GetTranslation() + part.offset;
-			Vector3 world = Vector3::Transform(local, worldMatrix);
+			Vector3 world = worldMatrix.TransformPoint(local);
 			capsule.segment.origin = capsule.segment.diff = world;
 		}
 		else {
 			// カプセル → 始点と終点両方に回転適用
-			Vector3 a = Vector3::Transform(joints[part.startJointIndex].skeletonSpaceMatrix.GetTranslation(), worldMatrix);
-			Vector3 b = Vector3::Transform(joints[part.endJointIndex].skeletonSpaceMatrix.GetTranslation(), worldMatrix);
-			capsule.segment.origin = a;
-			capsule.segment.diff = b;
+			capsule.segment.origin = positions[part.startJointIndex];
+			capsule.segment.diff = positions[part.endJointIndex];
 		}
 		out.emplace_back(part.name, capsule);
 	}
 	return out;
 }
 
+const std::vector<Joint>& AnimationModel::GetJoints() const
+{
+	static const std::vector<Joint> kEmpty;
+	return skeleton_ ? skeleton_->GetJoints() : kEmpty;
+}
+
+void AnimationModel::ComputeJointWorldPositions(const Affine3x4& worldMatrix, std::vector<Vector3>& positions) const
+{
+	const auto& joints = GetJoints();
+
+	// スケルトン空間の位置を並べてから、ワールド行列でまとめて変換
+	positions.resize(joints.size());
+	for (size_t i = 0; i < joints.size(); ++i)
+	{
+		positions[i] = joints[i].skeletonSpaceMatrix.GetTranslation();
+	}
+
+	Vector3::TransformPointsAffine(positions, worldMatrix, positions);
+}
+
 std::vector<std::pair<std::string, Sphere>> AnimationModel::GetBodyPartSpheresWorld() const
 {
 	std::vector<std::pair<std::string, Sphere>> out;
 	if (!skeleton_) { return out; }
 
 	const auto& joints = skeleton_->GetJoints();
-	Matrix4x4 worldMatrix = Matrix4x4::MakeAffineMatrix(
+	const Affine3x4 worldMatrix = Affine3x4::MakeAffine(
 		worldTransform.scale_, worldTransform.rotate_, worldTransform.translate_);
 
 	for (const auto& part : bodyPartColliders_) {
 		if (part.endJointIndex < 0) {
 			Sphere s{};
 			Vector3 local = joints[part.startJointIndex].skeletonSpaceMatrix.GetTranslation() + part.offset;
-			s.center = Vector3::Transform(local, worldMatrix);
+			s.center = worldMatrix.TransformPoint(local);
 			s.radius = part.radius;
 			out.emplace_back(part.name, s);
 		}
@@ -660,7 +736,7 @@ void AnimationModel::UpdateAnimation()
 
 		wvpData_->World = worldMatrix;
 		wvpData_->WVP = worldViewProjectionMatrix;
-		wvpData_->WorldInversedTranspose = Matrix4x4::Transpose(Matrix4x4::Inverse(worldMatrix));
+		wvpData_->WorldInversedTranspose = Matrix4x4::InverseTransposeUpper3x3(worldMatrix);
 	}
 	else
 	{
@@ -685,9 +761,10 @@ void AnimationModel::UpdateAnimation()
 			worldViewProjectionMatrix = worldMatrix;
 		}
 
+		const Matrix4x4 localWorldMatrix = localMatrix * worldMatrix;
 		wvpData_->WVP = localMatrix * worldViewProjectionMatrix;
-		wvpData_->World = localMatrix * worldMatrix;
-		wvpData_->WorldInversedTranspose = Matrix4x4::Transpose(Matrix4x4::Inverse(localMatrix * worldMatrix));
+		wvpData_->World = localWorldMatrix;
+		wvpData_->WorldInversedTranspose = Matrix4x4::InverseTransposeUpper3x3(localWorldMatrix);
 	}
 }
 
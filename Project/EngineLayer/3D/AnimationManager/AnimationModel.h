@@ -38,6 +38,19 @@ private: /// ---------- 構造体 ---------- ///
 		Vector3 worldPosition;
 	};
 
+public: /// ---------- 列挙型 ---------- ///
+
+	// 回転キーの補間の精度
+	enum class RotationInterpolation : int32_t
+	{
+		kSlerp,     // 正確（ジョイントごとに Quaternion::Slerp）
+		kFastSlerp, // 多項式近似（全ジョイントをまとめて Quaternion::SlerpN。Slerp との差は 4e-5 以下）
+		kNlerp,     // 正規化線形補間（まとめて Quaternion::NlerpN。遠くの LOD 向け）
+	};
+
+public: /// ---------- 構造体 ---------- ///
+
+	// 部位の当たり（ジョイント番号で骨に付く）
 	struct BodyPartCollider
 	{
 		std::string name;         // 名前（"LeftArm", "RightLeg", ...）
@@ -47,6 +60,9 @@ private: /// ---------- 構造体 ---------- ///
 		float radius = 0.1f;      // カプセルまたはスフィアの半径
 		float height = 0.0f;      // offset を使う Capsule 用（レガシー用途 or fallback）
 	};
+
+private: /// ---------- ボディパーツ ---------- ///
+
 	std::vector<BodyPartCollider> bodyPartColliders_;
 
 public: /// ---------- メンバ変数 ---------- ///
@@ -170,6 +186,15 @@ public: /// ---------- セッタ ---------- ///
 
 	std::vector<std::pair<std::string, Sphere>> GetBodyPartSpheresWorld() const;
 
+	// ボディパーツの定義（ジョイント番号と半径。複合コライダーの子を作るときに読む）
+	const std::vector<BodyPartCollider>& GetBodyParts() const { return bodyPartColliders_; }
+
+	// ジョイント（スケルトンが無ければ空）
+	const std::vector<Joint>& GetJoints() const;
+
+	// ワールド行列
+	Matrix4x4 GetWorldMatrix() const { return Matrix4x4::MakeAffineMatrix(worldTransform.scale_, worldTransform.rotate_, worldTransform.translate_); }
+
 	// 頭を消すかどうか
 	void SetHideHead(bool hide) { hideHead_ = hide; }
 
@@ -187,6 +212,10 @@ public: /// ---------- セッタ ---------- ///
 	// LODごとの更新間引き（例: {1,1,2,4} = LOD2は隔フレ、LOD3は4フレに1回）
 	void SetLodUpdateEvery(const std::vector<uint32_t>& v) { lodUpdateEvery_ = v; }
 
+	// 回転キーの補間の精度
+	void SetRotationInterpolation(RotationInterpolation mode) { rotationInterpolation_ = mode; }
+	RotationInterpolation GetRotationInterpolation() const { return rotationInterpolation_; }
+
 private: /// ---------- メンバ関数 ---------- ///
 
 	// LODの初期化
@@ -198,6 +227,12 @@ private: /// ---------- メンバ関数 ---------- ///
 	// Animationを解析する
 	Animation LoadAnimationFile(const std::string& fileName);
 
+	// 全ジョイントのワールド座標（joints と同じ並び。Vector3::TransformPointsAffine でまとめて変換）
+	void ComputeJointWorldPositions(const Affine3x4& worldMatrix, std::vector<Vector3>& positions) const;
+
+	// 回転キーをまとめて補間して joints に書き戻す（rotationBatch_ に積んだ分）
+	void InterpolateRotationBatch(std::vector<Joint>& joints);
+
 public: /// ---------- ボーン情報の初期化 ---------- ///
 
 	// ボーン情報の初期化
@@ -214,43 +249,59 @@ public: /// ---------- ボーン情報の初期化 ---------- ///
 
 private: /// ---------- メンバ関数・テンプレート関数 ---------- ///
 
-	// 任意の時刻の値を取得する
+	// 時刻を挟む2つのキーを探す（見つかれば index と index + 1 の間の割合を t に入れて true）
 	template <typename T>
-	inline T CalculateValue(const std::vector<Keyframe<T>>& keyframes, float time)
+	static bool FindKeyframeSpan(const std::vector<Keyframe<T>>& keyframes, float time, size_t& index, float& t)
 	{
 		assert(!keyframes.empty()); // キーがないものは返す値が分からないのでダメ
 		if (keyframes.size() == 1 || time <= keyframes[0].time) // キーが１つか、時刻がキーフレーム前なら最初の値とする
 		{
-			return keyframes[0].value;
+			index = 0;
+			return false;
 		}
 
 		// 
-		for (size_t index = 0; index < keyframes.size() - 1; ++index)
+		for (index = 0; index < keyframes.size() - 1; ++index)
 		{
 			size_t nextIndex = index + 1;
 			// indexとnextIndexの2つのkeyframeを取得して範囲内に自国があるかを判定
 			if (keyframes[index].time <= time && time <= keyframes[nextIndex].time)
 			{
-				// 範囲内を保管する
-				float t = (time - keyframes[index].time) / (keyframes[nextIndex].time - keyframes[index].time);
-				if constexpr (std::is_same_v<T, Vector3>)
-				{
-					// T が Vector3 の場合のみ Lerp を使用
-					return Vector3::Lerp(keyframes[index].value, keyframes[nextIndex].value, t);
-				}
-				else if constexpr (std::is_same_v<T, Quaternion>)
-				{
-					// T が Quaternion の場合のみ Slerp を使用
-					return Quaternion::Slerp(keyframes[index].value, keyframes[nextIndex].value, t);
-				}
-				else
-				{
-					static_assert(false, "Unsupported type for interpolation");
-				}
+				t = (time - keyframes[index].time) / (keyframes[nextIndex].time - keyframes[index].time);
+				return true;
 			}
 		}
 		// ここまでできた場合は一番後の時刻よりも後ろなので最後の値を返すことにする
-		return (*keyframes.rbegin()).value;
+		index = keyframes.size() - 1;
+		return false;
+	}
+
+	// 任意の時刻の値を取得する
+	template <typename T>
+	inline T CalculateValue(const std::vector<Keyframe<T>>& keyframes, float time)
+	{
+		size_t index = 0;
+		float t = 0.0f;
+		if (!FindKeyframeSpan(keyframes, time, index, t))
+		{
+			return keyframes[index].value;
+		}
+
+		// 範囲内を保管する
+		if constexpr (std::is_same_v<T, Vector3>)
+		{
+			// T が Vector3 の場合のみ Lerp を使用
+			return Vector3::Lerp(keyframes[index].value, keyframes[index + 1].value, t);
+		}
+		else if constexpr (std::is_same_v<T, Quaternion>)
+		{
+			// T が Quaternion の場合のみ Slerp を使用
+			return Quaternion::Slerp(keyframes[index].value, keyframes[index + 1].value, t);
+		}
+		else
+		{
+			static_assert(false, "Unsupported type for interpolation");
+		}
 	}
 
 private: /// ---------- メンバ変数 ---------- ///
@@ -297,6 +348,21 @@ private: /// ---------- メンバ変数 ---------- ///
 
 	bool isAnimationPlaying_ = true; // アニメーションが再生中かどうか
 
+	std::vector<Vector3> jointWorldPositions_; // デバッグ描画の作業用（毎回確保しないように持っておく）
+
+	// 回転キーの補間の精度（既定は正確な Slerp。近似は SetRotationInterpolation で選ぶ）
+	RotationInterpolation rotationInterpolation_ = RotationInterpolation::kSlerp;
+
+	// 回転キーの一括補間の作業用（SoA。from に結果を上書きする）
+	struct RotationBatch
+	{
+		std::vector<uint32_t> jointIndices;
+		std::vector<float> fromX, fromY, fromZ, fromW;
+		std::vector<float> toX, toY, toZ, toW;
+		std::vector<float> t;
+	};
+	RotationBatch rotationBatch_;
+
 private: /// ---------- コンピュートシェーダーによるスキニング用 ---------- ///
 
 	ComPtr<ID3D12Resource> staticVBDefault_; // CS入力用の頂点（Deviceローカル）
@@ -34,7 +34,7 @@ void Skeleton::UpdateSkeleton()
 			Joint& joint = joints_[index];
 
 			// ローカル行列を取得
-			joint.localMatrix = Matrix4x4::MakeAffineMatrix(joint.transform.scale, joint.transform.rotate, joint.transform.translate);
+			joint.localMatrix = Affine3x4::MakeAffine(joint.transform.scale, joint.transform.rotate, joint.transform.translate);
 
 			if (joint.parent.has_value())
 			{
@@ -64,8 +64,8 @@ uint32_t Skeleton::CreateJointRecursive(const Node& node, const std::optional<in
 
 	Joint joint;
 	joint.name = node.name;
-	joint.localMatrix = node.localMatrix;
-	joint.skeletonSpaceMatrix = Matrix4x4::MakeIdentity(); // 初期値
+	joint.localMatrix = Affine3x4::FromMatrix(node.localMatrix);
+	joint.skeletonSpaceMatrix = Affine3x4::MakeIdentity(); // 初期値
 	joint.transform = node.transform;
 	joint.index = currentIndex;
 	joint.parent = parent;
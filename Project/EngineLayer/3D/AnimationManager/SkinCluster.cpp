@@ -95,7 +95,7 @@ void SkinCluster::Initialize(const ModelData& modelData, Skeleton& skeleton)
 	mappedInfluenceData_ = { mappedInfluence, totalVerts }; // span
 
 	// inverseBindPose 配列
-	inverseBindPoseMatrices_.resize(joints.size(), Matrix4x4::MakeIdentity());
+	inverseBindPoseMatrices_.resize(joints.size(), Affine3x4::MakeIdentity());
 
 	// --- Influence 書き込み & 範囲チェック ---
 	const auto& jointMap = skeleton.GetJointMap();
@@ -105,7 +105,7 @@ void SkinCluster::Initialize(const ModelData& modelData, Skeleton& skeleton)
 		if (it == jointMap.end()) continue;
 
 		uint32_t jIdx = it->second;
-		inverseBindPoseMatrices_[jIdx] = jWeightData.inverseBindPoseMatrix;
+		inverseBindPoseMatrices_[jIdx] = Affine3x4::FromMatrix(jWeightData.inverseBindPoseMatrix);
 
 		for (const auto& vw : jWeightData.vertexWeights)
 		{
@@ -171,8 +171,10 @@ void SkinCluster::UpdatePaletteMatrix(Skeleton& skeleton)
 	for (size_t jointIndex = 0; jointIndex < joints.size(); ++jointIndex)
 	{
 		assert(jointIndex < inverseBindPoseMatrices_.size());
-		mappedPalette_[jointIndex].skeletonSpaceMatrix = inverseBindPoseMatrices_[jointIndex] * joints[jointIndex].skeletonSpaceMatrix;
-		mappedPalette_[jointIndex].skeletonSpaceInverceTransposeMatrix = Matrix4x4::Transpose(Matrix4x4::Inverse(mappedPalette_[jointIndex].skeletonSpaceMatrix));
+		// 合成は 3x4 のまま行い、GPU に送るときだけ 4x4 に戻す
+		const Matrix4x4 palette = (inverseBindPoseMatrices_[jointIndex] * joints[jointIndex].skeletonSpaceMatrix).ToMatrix();
+		mappedPalette_[jointIndex].skeletonSpaceMatrix = palette;
+		mappedPalette_[jointIndex].skeletonSpaceInverceTransposeMatrix = Matrix4x4::InverseTransposeUpper3x3(palette);
 	}
 
 	// ★ 毎フレ：UPLOAD → DEFAULT へ Copy（既存どおりでOK）
@@ -32,7 +32,7 @@ public: /// ---------- メンバ関数 ---------- ///
 
 private: /// ---------- メンバ変数 ---------- ///
 
-	std::vector<Matrix4x4> inverseBindPoseMatrices_; // パレット行列
+	std::vector<Affine3x4> inverseBindPoseMatrices_; // パレット行列（骨と同じく 3x4 で合成する）
 
 	// influence（頂点ごとのデータ）
 	ComPtr<ID3D12Resource> influenceResource_; // 頂点バッファリソース
@@ -4,10 +4,8 @@
 #include "ResourceManager.h"
 
 #include "ModelManager.h"
-#include "Model.h"
 
 #include "Object3DCommon.h"
-#include "AssimpLoader.h"
 #include "ParameterManager.h"
 #include "SkyBox.h"
 
@@ -20,35 +18,8 @@ void Object3D::Initialize(const std::string& fileName)
 	dxCommon_ = DirectXCommon::GetInstance();
 	camera_ = Object3DCommon::GetInstance()->GetDefaultCamera();
 
-	// モデル読み込み
-	modelData = AssimpLoader::LoadModel(fileName);
-
-	// サブメッシュ配列に対応してメッシュ・テクスチャを用意
-
-	// 既存データをクリア
-	meshes_.clear();
-	materialSRVs_.clear();
-
-	// メッシュとテクスチャの数を予約
-	meshes_.reserve(modelData.subMeshes.size());
-	materialSRVs_.reserve(modelData.subMeshes.size());
-
-	// テクスチャ未指定時のフォールバック
-	static const std::string kDefaultTexturePath = "white.png";
-
-	for (const auto& sub : modelData.subMeshes)
-	{
-		// テクスチャSRV
-		std::string texturePath = sub.material.textureFilePath; // テクスチャパス
-		if (texturePath.empty()) texturePath = kDefaultTexturePath; // フォールバック
-		TextureManager::GetInstance()->LoadTexture(texturePath); // テクスチャ読み込み
-		materialSRVs_.push_back(TextureManager::GetInstance()->GetSrvHandleGPU(texturePath));
-
-		// メッシュ（頂点インデックス）
-		Mesh m = {};
-		m.Initialize(sub.vertices, sub.indices);
-		meshes_.push_back(std::move(m));
-	}
+	// モデル読み込み（2回目以降はキャッシュ済みのデータとメッシュを共有する）
+	model_ = ModelManager::GetInstance()->FindModel(fileName);
 
 	// 環境マップ
 	TextureManager::GetInstance()->LoadTexture("SkyBox/skybox.dds");
@@ -132,10 +103,10 @@ void Object3D::Draw()
 	TextureManager::GetInstance()->SetGraphicsRootDescriptorTable(commandList, 4, environmentMapHandle_);
 
 	// サブメッシュ事にテクスチャを差し替えて描画
-	for (size_t i = 0; i < meshes_.size(); i++)
+	for (size_t i = 0; i < model_->meshes.size(); i++)
 	{
-		TextureManager::GetInstance()->SetGraphicsRootDescriptorTable(commandList, 2, materialSRVs_[i]);
-		meshes_[i].Draw();
+		TextureManager::GetInstance()->SetGraphicsRootDescriptorTable(commandList, 2, model_->materialSRVs[i]);
+		model_->meshes[i].Draw();
 	}
 }
 
@@ -145,13 +116,17 @@ void Object3D::Draw()
 /// -------------------------------------------------------------
 void Object3D::SetModel(const std::string& filePath)
 {
-	// モデルを検索してセットする (例: 方法1)
-	model_ = std::move(ModelManager::GetInstance()->FindModel(filePath));
+	// 共有モデルを差し替える（読み込み済みならハンドルのコピーのみ）
+	model_ = ModelManager::GetInstance()->FindModel(filePath);
+}
 
-	// モデルがセットされた後に初期化が必要な場合
-	if (model_) {
-		model_->Initialize(filePath);
-	}
+
+/// -------------------------------------------------------------
+///					　共有モデルデータの取得
+/// -------------------------------------------------------------
+const ModelData& Object3D::GetModelData() const
+{
+	return model_->modelData;
 }
 
 
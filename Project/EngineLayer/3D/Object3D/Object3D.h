@@ -17,7 +17,7 @@
 
 /// ---------- 前方宣言 ---------- ///
 class DirectXCommon;
-class Model;
+struct ModelAsset;
 class Object3DCommon;
 class SkyBox;
 
@@ -77,6 +77,9 @@ public: /// ---------- 設定処理 ---------- ///
 
 public: /// ---------- ゲッタ ---------- ///
 
+	// 共有モデルデータの取得
+	const ModelData& GetModelData() const;
+
 private: /// ---------- メンバ変数 ---------- ///
 
 	// カメラ用のリソース生成
@@ -88,7 +91,8 @@ private: /// ---------- メンバ変数 ---------- ///
 	Camera* camera_ = nullptr;
 	SkyBox* skyBox_ = nullptr;
 
-	std::shared_ptr<Model> model_;
+	// 共有モデルアセット（ModelManagerのキャッシュから取得）
+	std::shared_ptr<const ModelAsset> model_;
 
 	// マテリアルデータ
 	Material material_;
@@ -96,19 +100,12 @@ private: /// ---------- メンバ変数 ---------- ///
 	// ワールドトランスフォーム
 	WorldTransform worldTransform;
 
-	// メッシュ
-	std::vector<Mesh> meshes_;
-	std::vector<D3D12_GPU_DESCRIPTOR_HANDLE> materialSRVs_;
-
 	// バッファリソースの作成
 	ComPtr <ID3D12Resource> cameraResource;
 
 	// カメラにデータを書き込む
 	CameraForGPU* cameraData = nullptr;
 
-	// モデルデータ（subMeshes を想定）
-	ModelData modelData;
-
 	float alpha = 1.0f; // α値
 
 	// 環境マップのテクスチャ
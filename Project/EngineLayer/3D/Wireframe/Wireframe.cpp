@@ -302,17 +302,20 @@ void Wireframe::DrawOBB(const OBB& obb, const Vector4& color)
 /// -------------------------------------------------------------
 void Wireframe::DrawSphere(const Vector3& center, const float radius, const Vector4& color)
 {
-	Matrix4x4 worldMatrix = Matrix4x4::MakeAffineMatrix(Vector3(radius, radius, radius), Vector3(0.0f, 0.0f, 0.0f), center);
+	// 拡大と平行移動だけなので、回転の sin / cos を使わずに直接作る
+	Affine3x4 worldMatrix = Affine3x4::MakeIdentity();
+	worldMatrix.m[0][0] = worldMatrix.m[1][1] = worldMatrix.m[2][2] = radius;
+	worldMatrix.SetTranslation(center);
 
-	for (uint32_t i = 0; i + 2 < spheres_.size(); i += 3)
-	{
-		Vector3 a = spheres_[i];
-		Vector3 b = spheres_[i + 1];
-		Vector3 c = spheres_[i + 2];
+	// 全頂点をまとめて変換
+	sphereWorldVertices_.resize(spheres_.size());
+	Vector3::TransformPointsAffine(spheres_, worldMatrix, sphereWorldVertices_);
 
-		a = Vector3::Transform(a, worldMatrix);
-		b = Vector3::Transform(b, worldMatrix);
-		c = Vector3::Transform(c, worldMatrix);
+	for (uint32_t i = 0; i + 2 < sphereWorldVertices_.size(); i += 3)
+	{
+		const Vector3& a = sphereWorldVertices_[i];
+		const Vector3& b = sphereWorldVertices_[i + 1];
+		const Vector3& c = sphereWorldVertices_[i + 2];
 
 		// 線描画
 		DrawLine(a, b, color);
@@ -797,11 +800,13 @@ void Wireframe::DrawRotatingTorus(const Vector3& center, float R, float r, uint3
 			float y = (R + r * cos(v)) * sin(u);
 			float z = r * sin(v);
 
-			Vector3 rotatedPoint = Vector3::Transform(center + Vector3(x, y, z), rotationMatrix);
-			points.push_back(rotatedPoint);
+			points.push_back(center + Vector3(x, y, z));
 		}
 	}
 
+	// まとめて回転
+	Vector3::TransformPoints(points, rotationMatrix, points);
+
 	// 頂点を線で結ぶ
 	for (uint32_t i = 0; i < ringSegments; i++) {
 		for (uint32_t j = 0; j < tubeSegments; j++) {
@@ -4,6 +4,7 @@
 #include "Vector3.h"
 #include "Vector4.h"
 #include "Matrix4x4.h"
+#include "Affine3x4.h"
 #include "Camera.h"
 #include "AABB.h"
 #include "OBB.h"
@@ -304,6 +305,9 @@ private: /// ---------- メンバ変数 ---------- ///
 	// 球のデータ
 	std::vector<Vector3> spheres_;
 
+	// 球の頂点をワールドへ変換したもの（DrawSphere の作業用。毎回確保しないように持っておく）
+	std::vector<Vector3> sphereWorldVertices_;
+
 private: /// ---------- メンバ変数 ---------- ///
 
 	// デバッグカメラの有無
@@ -7,6 +7,7 @@
 #include "Material.h"
 #include "Quaternion.h"
 #include "Matrix4x4.h"
+#include "Affine3x4.h"
 #include <span>
 #include <array>
 
@@ -64,8 +65,8 @@ struct Animation
 struct Joint
 {
 	QuaternionTransform transform; // Transform情報
-	Matrix4x4 localMatrix;		   // localMatrix
-	Matrix4x4 skeletonSpaceMatrix; // skeletonSpaceでの変換行列
+	Affine3x4 localMatrix;		   // localMatrix（CPU でしか使わないので 3x4）
+	Affine3x4 skeletonSpaceMatrix; // skeletonSpaceでの変換行列
 	std::string name;			   // 名前
 	std::vector<int32_t> children; // 子JointのIndexのリスト。居なければ空
 	int32_t index;				   // 自身のindex
@@ -10,7 +10,7 @@ Camera::Camera() :
 	aspectRatio_(float(WinApp::kClientWidth) / float(WinApp::kClientHeight)),
 	nearClip_(0.1f), farClip_(1000.0f),
 	worldMatrix_(Matrix4x4::MakeAffineMatrix(worldTransform_.scale_, worldTransform_.rotate_, worldTransform_.translate_)),
-	viewMatrix_(Matrix4x4::Inverse(worldMatrix_)),
+	viewMatrix_(Matrix4x4::InverseAffine(worldMatrix_)),
 	projectionMatrix_(Matrix4x4::MakePerspectiveFovMatrix(fovY_, aspectRatio_, nearClip_, farClip_)),
 	viewProjectionMatrix_(Matrix4x4::Multiply(viewMatrix_, projectionMatrix_))
 {
@@ -25,7 +25,7 @@ void Camera::Update()
 {
 	// ビュー行列の計算処理
 	worldMatrix_ = Matrix4x4::MakeAffineMatrix(worldTransform_.scale_, worldTransform_.rotate_, worldTransform_.translate_);
-	viewMatrix_ = Matrix4x4::Inverse(worldMatrix_);
+	viewMatrix_ = Matrix4x4::InverseAffine(worldMatrix_);
 
 	// プロジェクション行列の更新
 	projectionMatrix_ = Matrix4x4::MakePerspectiveFovMatrix(fovY_, aspectRatio_, nearClip_, farClip_);
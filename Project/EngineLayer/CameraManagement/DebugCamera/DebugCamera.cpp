@@ -81,7 +81,7 @@ void DebugCamera::UpdateViewProjection()
 	worldMatrix_ = Matrix4x4::MakeAffineMatrix(worldTransform_.scale_, worldTransform_.rotate_, worldTransform_.translate_);
 
 	// ビュー行列を作る
-	viewMatrix_ = Matrix4x4::Inverse(worldMatrix_);
+	viewMatrix_ = Matrix4x4::InverseAffine(worldMatrix_);
 
 	// 射影行列を更新
 	projectionMatrix_ = Matrix4x4::MakePerspectiveFovMatrix(fovY_, aspectRatio_, nearClip_, farClip_);
@@ -129,7 +129,7 @@ void FpsCamera::Update(bool ignoreInput)
 	Vector3 camEuler = { pitch_, yaw_, 0.0f }; // X, Y 回転
 	Matrix4x4 rotMat = Matrix4x4::MakeRotateMatrix(camEuler);
 	Matrix4x4 transMat = Matrix4x4::MakeTranslateMatrix(camPos);
-	Matrix4x4 viewMat = Matrix4x4::Inverse(rotMat * transMat);
+	Matrix4x4 viewMat = Matrix4x4::InverseAffine(rotMat * transMat);
 
 	camera_->SetViewMatrix(viewMat);
 	camera_->SetTranslate(camPos);
@@ -0,0 +1,133 @@
+#pragma once
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+
+/// -------------------------------------------------------------
+///	　パスで引く共有アセットのキャッシュ（読み込み後は不変）
+/// -------------------------------------------------------------
+template <typename Asset>
+class AssetCache
+{
+public: /// ---------- メンバ関数 ---------- ///
+
+	// 検索（未登録なら create(filePath) で作って登録する）
+	template <typename Create>
+	std::shared_ptr<const Asset> FindOrCreate(const std::string& filePath, Create&& create);
+
+	// 登録済みなら返す（統計には数えない）
+	std::shared_ptr<const Asset> Find(const std::string& filePath) const;
+
+	// どこからも参照されていないアセットを解放して解放数を返す
+	size_t ReleaseUnused();
+
+	// 全破棄（統計も戻す）
+	void Clear();
+
+public: /// ---------- ゲッター ---------- ///
+
+	// ヒット数・ミス数
+	uint64_t GetHitCount() const { return hitCount_; }
+	uint64_t GetMissCount() const { return missCount_; }
+
+	// 登録済みのアセット数
+	size_t GetCount() const { return assets_.size(); }
+
+	// キャッシュのキーとなるパスの正規化（"\\" は "/" に、"./" や "../" は畳み、大文字小文字は区別しない）
+	static std::string NormalizePath(const std::string& filePath);
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	// 正規化パス → 共有アセット（参照カウントはshared_ptrに任せる）
+	std::unordered_map<std::string, std::shared_ptr<const Asset>> assets_;
+
+	// キャッシュ統計
+	uint64_t hitCount_ = 0;
+	uint64_t missCount_ = 0;
+};
+
+
+/// -------------------------------------------------------------
+///				　	検索（未登録なら作って登録）
+/// -------------------------------------------------------------
+template <typename Asset>
+template <typename Create>
+inline std::shared_ptr<const Asset> AssetCache<Asset>::FindOrCreate(const std::string& filePath, Create&& create)
+{
+	std::string key = NormalizePath(filePath);
+
+	// 読み込み済みならハンドルのコピーだけで済ませる
+	auto it = assets_.find(key);
+	if (it != assets_.end())
+	{
+		++hitCount_;
+		return it->second;
+	}
+
+	// 初回のみ読み込みを行う（パスは呼び出し側の綴りのまま渡す）
+	++missCount_;
+	std::shared_ptr<const Asset> asset = create(filePath);
+	assets_.emplace(std::move(key), asset);
+
+	return asset;
+}
+
+
+/// -------------------------------------------------------------
+///				　	登録済みのアセットの検索
+/// -------------------------------------------------------------
+template <typename Asset>
+inline std::shared_ptr<const Asset> AssetCache<Asset>::Find(const std::string& filePath) const
+{
+	auto it = assets_.find(NormalizePath(filePath));
+	return (it != assets_.end()) ? it->second : nullptr;
+}
+
+
+/// -------------------------------------------------------------
+///				どこからも参照されていないアセットを解放
+/// -------------------------------------------------------------
+template <typename Asset>
+inline size_t AssetCache<Asset>::ReleaseUnused()
+{
+	// キャッシュ自身しか参照していないものを削除
+	return std::erase_if(assets_, [](const auto& pair) { return pair.second.use_count() == 1; });
+}
+
+
+/// -------------------------------------------------------------
+///				　			全破棄
+/// -------------------------------------------------------------
+template <typename Asset>
+inline void AssetCache<Asset>::Clear()
+{
+	assets_.clear();
+	hitCount_ = 0;
+	missCount_ = 0;
+}
+
+
+/// -------------------------------------------------------------
+///				キャッシュのキーとなるパスの正規化
+/// -------------------------------------------------------------
+template <typename Asset>
+inline std::string AssetCache<Asset>::NormalizePath(const std::string& filePath)
+{
+	// "\\" を区切り文字として扱わない環境でも同じキーになるよう先に揃える
+	std::string key = filePath;
+	std::replace(key.begin(), key.end(), '\\', '/');
+
+	// "./" や "../" を畳む
+	key = std::filesystem::path(key).lexically_normal().generic_string();
+
+	// Windowsのファイルシステムに合わせて大文字小文字を区別しない
+	std::transform(key.begin(), key.end(), key.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+	return key;
+}
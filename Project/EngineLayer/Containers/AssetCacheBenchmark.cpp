@@ -0,0 +1,327 @@
+#define NOMINMAX
+#include "AssetCacheBenchmark.h"
+#include "AssetCache.h"
+#include "VertexData.h"
+#include <LogString.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <set>
+#include <string>
+#include <imgui.h>
+
+namespace
+{
+	using Random = std::mt19937;
+	using Clock = std::chrono::steady_clock;
+
+	// ModelAsset のうち CPU 側に残る部分（頂点・インデックス）
+	struct MeshAsset
+	{
+		std::vector<VertexData> vertices;
+		std::vector<uint32_t> indices;
+	};
+
+	// ModelManager 経由で Object3D が持つもの（共有アセットのハンドルとオブジェクトごとの姿勢）
+	struct CubeObject
+	{
+		std::shared_ptr<const MeshAsset> model;
+		Vector3 translate;
+	};
+
+	// キャッシュのテストで使うパス（キーが重ならないもの）
+	const std::array<std::string, 6> kModelPaths = {
+		"Models/cube.gltf", "Models/sphere.gltf", "Models/Enemy/enemy.gltf",
+		"Models/Player/player.gltf", "Resources/Models/bullet.obj", "boss.gltf",
+	};
+
+	/// ---------- 入力を作る ---------- ///
+
+	// 1面4頂点・2三角形の立方体（cube.gltf と同じ 24 頂点・36 インデックス）
+	std::shared_ptr<const MeshAsset> BuildCube(const std::string&)
+	{
+		auto mesh = std::make_shared<MeshAsset>();
+		mesh->vertices.reserve(24);
+		mesh->indices.reserve(36);
+
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			for (float sign : { 1.0f, -1.0f })
+			{
+				const uint32_t base = static_cast<uint32_t>(mesh->vertices.size());
+				for (int corner = 0; corner < 4; ++corner)
+				{
+					const float u = (corner & 1) ? 1.0f : -1.0f;
+					const float v = (corner & 2) ? 1.0f : -1.0f;
+					float position[3] = {};
+					position[axis] = sign;
+					position[(axis + 1) % 3] = u;
+					position[(axis + 2) % 3] = v;
+					float normal[3] = {};
+					normal[axis] = sign;
+					mesh->vertices.push_back({ { position[0], position[1], position[2], 1.0f }, { (u + 1.0f) * 0.5f, (v + 1.0f) * 0.5f }, { normal[0], normal[1], normal[2] } });
+				}
+				for (uint32_t index : { 0u, 1u, 2u, 2u, 1u, 3u }) mesh->indices.push_back(base + index);
+			}
+		}
+		return mesh;
+	}
+
+	// 頂点・インデックスのバイト数
+	size_t MeshBytes(const MeshAsset& mesh)
+	{
+		return mesh.vertices.size() * sizeof(VertexData) + mesh.indices.size() * sizeof(uint32_t);
+	}
+
+	// 同じファイルを指す別の綴り（"./"・"dir/../"・"\\"・大文字小文字を混ぜる）
+	std::string RandomSpelling(Random& random, const std::string& path)
+	{
+		std::string result = (random() % 2) ? "./" : "";
+		size_t begin = 0;
+		while (true)
+		{
+			const size_t end = path.find('/', begin);
+			if (random() % 3 == 0) result += (random() % 2) ? "Temp/../" : "Temp\\..\\";
+			result += path.substr(begin, end - begin);
+			if (end == std::string::npos) break;
+			result += (random() % 2) ? '/' : '\\';
+			begin = end + 1;
+		}
+
+		for (char& c : result)
+		{
+			if (random() % 2) c = static_cast<char>((c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c);
+		}
+		return result;
+	}
+
+	size_t RandomPathIndex(Random& random)
+	{
+		return random() % kModelPaths.size();
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　			すべて実行
+/// -------------------------------------------------------------
+void AssetCacheBenchmark::Run()
+{
+	const auto startTime = Clock::now();
+
+	checkResults_.clear();
+
+	RunChecks();
+	RunSharingBenchmark();
+
+	totalMilliseconds_ = std::chrono::duration<float, std::milli>(Clock::now() - startTime).count();
+	hasRun_ = true;
+
+	LogResults();
+}
+
+
+/// -------------------------------------------------------------
+///				　	性質テストの失敗数の合計
+/// -------------------------------------------------------------
+uint32_t AssetCacheBenchmark::GetTotalFailureCount() const
+{
+	uint32_t count = 0;
+	for (const CheckResult& result : checkResults_) count += result.failureCount;
+	if (hasRun_ && !sharingResult_.isShared) ++count;
+	return count;
+}
+
+
+/// -------------------------------------------------------------
+///				　	成否を件数分調べる
+/// -------------------------------------------------------------
+template <typename Case>
+void AssetCacheBenchmark::Check(const char* name, Case&& testCase)
+{
+	CheckResult result;
+	result.name = name;
+	result.caseCount = kCaseCount;
+
+	Random random(static_cast<uint32_t>(checkResults_.size()) * 1000003u);
+	for (uint32_t i = 0; i < kCaseCount; ++i)
+	{
+		if (!testCase(random)) ++result.failureCount;
+	}
+
+	checkResults_.push_back(result);
+}
+
+
+/// -------------------------------------------------------------
+///				　	キャッシュの性質テスト
+/// -------------------------------------------------------------
+void AssetCacheBenchmark::RunChecks()
+{
+	using Cache = AssetCache<MeshAsset>;
+
+	// 綴りが違っても同じファイルなら同じキー、違うファイルなら違うキー
+	Check("NormalizePath spellings", [](Random& r) {
+		const size_t a = RandomPathIndex(r);
+		const size_t b = (a + 1 + r() % (kModelPaths.size() - 1)) % kModelPaths.size();
+		const std::string key = Cache::NormalizePath(RandomSpelling(r, kModelPaths[a]));
+		return key == Cache::NormalizePath(kModelPaths[a]) && key == Cache::NormalizePath(RandomSpelling(r, kModelPaths[a])) &&
+			key != Cache::NormalizePath(RandomSpelling(r, kModelPaths[b])) && key.find('\\') == std::string::npos; });
+
+	// ミスは初めてのファイルのときだけ（作る関数もその回だけ呼ばれる）
+	Check("Hit / miss = reference", [](Random& r) {
+		Cache cache;
+		std::set<size_t> loaded;
+		uint32_t createCount = 0;
+		bool ok = true;
+		const uint32_t lookupCount = 1 + r() % 32;
+		for (uint32_t i = 0; i < lookupCount; ++i)
+		{
+			const size_t path = RandomPathIndex(r);
+			const bool isFirst = loaded.insert(path).second;
+			const uint32_t before = createCount;
+			cache.FindOrCreate(RandomSpelling(r, kModelPaths[path]), [&](const std::string& filePath) { ++createCount; return BuildCube(filePath); });
+			ok &= (createCount - before) == (isFirst ? 1u : 0u);
+		}
+		return ok && cache.GetMissCount() == loaded.size() && cache.GetHitCount() == lookupCount - loaded.size() && cache.GetCount() == loaded.size(); });
+
+	// 同じファイルのハンドルは同じアセット、ReleaseUnused は誰も持っていないものだけを捨てる
+	Check("Shared asset / ReleaseUnused", [](Random& r) {
+		Cache cache;
+		std::array<std::vector<std::shared_ptr<const MeshAsset>>, kModelPaths.size()> handles;
+		const uint32_t lookupCount = 1 + r() % 32;
+		for (uint32_t i = 0; i < lookupCount; ++i)
+		{
+			const size_t path = RandomPathIndex(r);
+			handles[path].push_back(cache.FindOrCreate(RandomSpelling(r, kModelPaths[path]), BuildCube));
+		}
+
+		bool ok = true;
+		std::set<const MeshAsset*> distinct;
+		size_t dropCount = 0;
+		for (size_t path = 0; path < kModelPaths.size(); ++path)
+		{
+			if (handles[path].empty()) continue;
+			for (const auto& handle : handles[path]) ok &= handle == handles[path].front();
+			distinct.insert(handles[path].front().get());
+
+			// 半分ほどは手放す（キャッシュだけが持つ状態にする）
+			if (r() % 2) { handles[path].clear(); ++dropCount; }
+		}
+		ok &= distinct.size() == cache.GetCount();
+		ok &= cache.ReleaseUnused() == dropCount;
+
+		for (size_t path = 0; path < kModelPaths.size(); ++path)
+		{
+			const auto found = cache.Find(RandomSpelling(r, kModelPaths[path]));
+			ok &= handles[path].empty() ? (found == nullptr) : (found == handles[path].front());
+		}
+		return ok; });
+
+	// Clear は統計も戻し、外で持っているハンドルは生きたまま
+	Check("Clear", [](Random& r) {
+		Cache cache;
+		const size_t path = RandomPathIndex(r);
+		const auto held = cache.FindOrCreate(kModelPaths[path], BuildCube);
+		cache.FindOrCreate(RandomSpelling(r, kModelPaths[path]), BuildCube);
+		cache.Clear();
+		const bool cleared = cache.GetCount() == 0 && cache.GetHitCount() == 0 && cache.GetMissCount() == 0 && cache.Find(kModelPaths[path]) == nullptr;
+		return cleared && held.use_count() == 1 && held->indices.size() == 36 &&
+			cache.FindOrCreate(kModelPaths[path], BuildCube) != held && cache.GetMissCount() == 1; });
+}
+
+
+/// -------------------------------------------------------------
+///				　	同じモデルのオブジェクトを大量に作る
+/// -------------------------------------------------------------
+void AssetCacheBenchmark::RunSharingBenchmark()
+{
+	AssetCache<MeshAsset> cache;
+	std::vector<CubeObject> objects;
+	objects.reserve(kObjectCount);
+
+	// 1体目（メッシュの構築が入る）
+	auto startTime = Clock::now();
+	objects.push_back({ cache.FindOrCreate("cube.gltf", BuildCube), {} });
+	const float coldMicroseconds = std::chrono::duration<float, std::micro>(Clock::now() - startTime).count();
+
+	// 残り（共有アセットのハンドルのコピーだけ）
+	startTime = Clock::now();
+	for (uint32_t i = 1; i < kObjectCount; ++i)
+	{
+		objects.push_back({ cache.FindOrCreate("cube.gltf", BuildCube), { static_cast<float>(i), 0.0f, 0.0f } });
+	}
+	const float cachedMicroseconds = std::chrono::duration<float, std::micro>(Clock::now() - startTime).count();
+
+	SharingResult& result = sharingResult_;
+	result.objectCount = kObjectCount;
+	result.coldMicroseconds = coldMicroseconds;
+	result.cachedMicrosecondsPerObject = cachedMicroseconds / static_cast<float>(kObjectCount - 1);
+	result.hitCount = cache.GetHitCount();
+	result.missCount = cache.GetMissCount();
+	result.cachedMeshBytes = MeshBytes(*objects.front().model) * cache.GetCount();
+	result.isShared = cache.GetCount() == 1 &&
+		std::all_of(objects.begin(), objects.end(), [&](const CubeObject& object) { return object.model == objects.front().model; }) &&
+		static_cast<size_t>(objects.front().model.use_count()) == kObjectCount + 1;
+
+	// キャッシュなし（オブジェクトごとにメッシュを構築する。ファイル読み込みと GPU 転送は含まない）
+	objects.clear();
+	startTime = Clock::now();
+	for (uint32_t i = 0; i < kObjectCount; ++i)
+	{
+		objects.push_back({ BuildCube("cube.gltf"), { static_cast<float>(i), 0.0f, 0.0f } });
+	}
+	const float uncachedMicroseconds = std::chrono::duration<float, std::micro>(Clock::now() - startTime).count();
+
+	result.uncachedMicrosecondsPerObject = uncachedMicroseconds / static_cast<float>(kObjectCount);
+	result.uncachedMeshBytes = 0;
+	for (const CubeObject& object : objects) result.uncachedMeshBytes += MeshBytes(*object.model);
+}
+
+
+/// -------------------------------------------------------------
+///				　			結果をログに出す
+/// -------------------------------------------------------------
+void AssetCacheBenchmark::LogResults() const
+{
+	Log(std::format("[AssetCacheBenchmark] total {:.1f} ms\n", totalMilliseconds_));
+
+	for (const CheckResult& result : checkResults_)
+	{
+		Log(std::format("  {:<32} {} / {} failed\n", result.name, result.failureCount, result.caseCount));
+	}
+
+	const SharingResult& sharing = sharingResult_;
+	Log(std::format("  cube x{} : first {:.2f} us, then {:.3f} us/object cached, {:.3f} us/object uncached ({} hits, {} misses, {})\n",
+		sharing.objectCount, sharing.coldMicroseconds, sharing.cachedMicrosecondsPerObject, sharing.uncachedMicrosecondsPerObject,
+		sharing.hitCount, sharing.missCount, sharing.isShared ? "shared" : "NOT SHARED"));
+	Log(std::format("  mesh memory : {} bytes cached, {} bytes uncached\n", sharing.cachedMeshBytes, sharing.uncachedMeshBytes));
+}
+
+
+/// -------------------------------------------------------------
+///				　			ImGui描画処理
+/// -------------------------------------------------------------
+void AssetCacheBenchmark::DrawImGui() const
+{
+	if (!hasRun_) return;
+
+	ImGui::Text("Asset Cache : %.1f ms, failures %u", totalMilliseconds_, GetTotalFailureCount());
+
+	if (ImGui::CollapsingHeader("Asset Cache Checks", ImGuiTreeNodeFlags_DefaultOpen))
+	{
+		for (const CheckResult& result : checkResults_)
+			ImGui::Text("%-32s %u / %u", result.name, result.failureCount, result.caseCount);
+	}
+
+	if (ImGui::CollapsingHeader("Model Cache", ImGuiTreeNodeFlags_DefaultOpen))
+	{
+		const SharingResult& sharing = sharingResult_;
+		ImGui::Text("cube x%u (%s)", sharing.objectCount, sharing.isShared ? "shared" : "NOT SHARED");
+		ImGui::Text("First : %.2f us, then %.3f us / object (uncached %.3f us)", sharing.coldMicroseconds, sharing.cachedMicrosecondsPerObject, sharing.uncachedMicrosecondsPerObject);
+		ImGui::Text("Cache : %llu hits, %llu misses", static_cast<unsigned long long>(sharing.hitCount), static_cast<unsigned long long>(sharing.missCount));
+		ImGui::Text("Mesh : %zu bytes (uncached %zu bytes)", sharing.cachedMeshBytes, sharing.uncachedMeshBytes);
+	}
+}
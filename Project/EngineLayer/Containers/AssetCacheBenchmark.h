@@ -0,0 +1,78 @@
+#pragma once
+#include <cstdint>
+#include <random>
+#include <vector>
+
+
+/// -------------------------------------------------------------
+///	　アセットキャッシュのテストと計測（デバイスなしで実行する）
+/// -------------------------------------------------------------
+class AssetCacheBenchmark
+{
+public: /// ---------- 構造体 ---------- ///
+
+	// 性質テストの結果
+	struct CheckResult
+	{
+		const char* name = "";
+		uint32_t caseCount = 0;
+		uint32_t failureCount = 0;
+	};
+
+	// 同じモデルのオブジェクトを大量に作ったときの結果
+	struct SharingResult
+	{
+		uint32_t objectCount = 0;
+		float coldMicroseconds = 0.0f;              // 1体目（メッシュの構築を含む）
+		float cachedMicrosecondsPerObject = 0.0f;   // 2体目以降の1体あたり（キャッシュを引く）
+		float uncachedMicrosecondsPerObject = 0.0f; // 1体ごとにメッシュを構築したときの1体あたり
+		uint64_t hitCount = 0;
+		uint64_t missCount = 0;
+		size_t cachedMeshBytes = 0;   // キャッシュありで持つ頂点・インデックスのバイト数
+		size_t uncachedMeshBytes = 0; // キャッシュなしで持つ頂点・インデックスのバイト数
+		bool isShared = false;        // 全オブジェクトが同じアセットを指しているか
+	};
+
+public: /// ---------- メンバ関数 ---------- ///
+
+	// すべて実行
+	void Run();
+
+	// ImGui描画処理（呼び出し側のウィンドウ内に描く）
+	void DrawImGui() const;
+
+public: /// ---------- ゲッター ---------- ///
+
+	const std::vector<CheckResult>& GetCheckResults() const { return checkResults_; }
+	const SharingResult& GetSharingResult() const { return sharingResult_; }
+
+	// 性質テストの失敗数の合計（共有されていなければ 1 つ足す）
+	uint32_t GetTotalFailureCount() const;
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	// キーの正規化・ヒット数とミス数・共有と解放
+	void RunChecks();
+
+	// "cube.gltf" 相当のメッシュを持つオブジェクトを kObjectCount 個作る
+	void RunSharingBenchmark();
+
+	// 結果をログに出す
+	void LogResults() const;
+
+	// 1件ごとに成否を返す関数で、失敗した件を数える
+	template <typename Case>
+	void Check(const char* name, Case&& testCase);
+
+private: /// ---------- 定数 ---------- ///
+
+	static constexpr uint32_t kCaseCount = 2000;    // テストごとの件数
+	static constexpr uint32_t kObjectCount = 10000; // 計測で作るオブジェクトの数
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	std::vector<CheckResult> checkResults_;
+	SharingResult sharingResult_;
+	float totalMilliseconds_ = 0.0f;
+	bool hasRun_ = false;
+};
@@ -0,0 +1,225 @@
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+
+/// -------------------------------------------------------------
+///				　スロットハンドル（番号＋世代）
+/// -------------------------------------------------------------
+struct SlotHandle
+{
+	uint32_t index = 0;      // スロット番号
+	uint32_t generation = 0; // 世代（0は無効なハンドル）
+
+	// 有効な値を持っているか（要素が生きているかは SlotMap::Contains で確認する）
+	bool IsValid() const { return generation != 0; }
+
+	bool operator==(const SlotHandle& other) const { return index == other.index && generation == other.generation; }
+	bool operator!=(const SlotHandle& other) const { return !(*this == other); }
+};
+
+
+/// -------------------------------------------------------------
+///	スロットマップ（要素は詰めて持ち、ハンドルで O(1) に引ける）
+/// -------------------------------------------------------------
+template <typename T>
+class SlotMap
+{
+public: /// ---------- メンバ関数 ---------- ///
+
+	// 追加してハンドルを返す
+	SlotHandle Insert(T value) { return Emplace(std::move(value)); }
+
+	// その場で構築して追加
+	template <typename... Args>
+	SlotHandle Emplace(Args&&... args);
+
+	// 削除（末尾の要素を空いた位置に移す。古いハンドルなら何もしない）
+	bool Erase(SlotHandle handle);
+
+	// 条件に合う要素をすべて削除して削除数を返す
+	template <typename Pred>
+	uint32_t EraseIf(Pred&& pred);
+
+	// 全削除（発行済みのハンドルはすべて無効になる）
+	void Clear();
+
+	// 容量の予約
+	void Reserve(uint32_t count) { values_.reserve(count); denseToSlot_.reserve(count); slots_.reserve(count); }
+
+public: /// ---------- ゲッター ---------- ///
+
+	// ハンドルが生きている要素を指しているか
+	bool Contains(SlotHandle handle) const { return IndexOf(handle) != kInvalidIndex; }
+
+	// 要素を取得（古いハンドルなら nullptr）
+	T* Get(SlotHandle handle) { const uint32_t i = IndexOf(handle); return i != kInvalidIndex ? &values_[i] : nullptr; }
+	const T* Get(SlotHandle handle) const { const uint32_t i = IndexOf(handle); return i != kInvalidIndex ? &values_[i] : nullptr; }
+
+	// 詰めた配列での位置（古いハンドルなら kInvalidIndex）
+	uint32_t IndexOf(SlotHandle handle) const;
+
+	// 詰めた配列の位置からハンドルを作る
+	SlotHandle GetHandle(uint32_t denseIndex) const { const uint32_t slot = denseToSlot_[denseIndex]; return { slot, slots_[slot].generation }; }
+
+	// 要素数
+	uint32_t GetCount() const { return static_cast<uint32_t>(values_.size()); }
+	bool IsEmpty() const { return values_.empty(); }
+
+	// 詰めた配列を直接なめる（削除で並びは変わる）
+	T& operator[](uint32_t denseIndex) { return values_[denseIndex]; }
+	const T& operator[](uint32_t denseIndex) const { return values_[denseIndex]; }
+	auto begin() { return values_.begin(); }
+	auto end() { return values_.end(); }
+	auto begin() const { return values_.begin(); }
+	auto end() const { return values_.end(); }
+
+	// 削除したスロットの次の世代（0は無効なハンドル用なので飛ばす）
+	static uint32_t NextGeneration(uint32_t generation) { return (generation == ~0u) ? 1u : generation + 1u; }
+
+public: /// ---------- 定数 ---------- ///
+
+	static constexpr uint32_t kInvalidIndex = ~0u;
+
+private: /// ---------- 構造体 ---------- ///
+
+	// スロット（使用中は詰めた配列での位置、空きなら次の空きスロットを持つ）
+	struct Slot
+	{
+		uint32_t denseIndexOrNextFree = kInvalidIndex;
+		uint32_t generation = 1;
+		bool isUsed = false;
+	};
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	// 詰めた配列の位置の要素を削除
+	void EraseAt(uint32_t denseIndex);
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	std::vector<T> values_;            // 要素（詰めて持つ）
+	std::vector<uint32_t> denseToSlot_; // 詰めた位置 → スロット番号
+	std::vector<Slot> slots_;          // スロット番号 → 詰めた位置・世代
+	uint32_t freeHead_ = kInvalidIndex; // 空きスロットのリストの先頭
+};
+
+
+/// -------------------------------------------------------------
+///				　			追加処理
+/// -------------------------------------------------------------
+template <typename T>
+template <typename... Args>
+inline SlotHandle SlotMap<T>::Emplace(Args&&... args)
+{
+	// 空きスロットがあれば使い回す（世代は削除時に進めてある）
+	uint32_t slot = freeHead_;
+	if (slot != kInvalidIndex)
+	{
+		freeHead_ = slots_[slot].denseIndexOrNextFree;
+	}
+	else
+	{
+		slot = static_cast<uint32_t>(slots_.size());
+		slots_.emplace_back();
+	}
+
+	const uint32_t denseIndex = static_cast<uint32_t>(values_.size());
+	values_.emplace_back(std::forward<Args>(args)...);
+	denseToSlot_.push_back(slot);
+
+	slots_[slot].denseIndexOrNextFree = denseIndex;
+	slots_[slot].isUsed = true;
+	return { slot, slots_[slot].generation };
+}
+
+
+/// -------------------------------------------------------------
+///				　			削除処理
+/// -------------------------------------------------------------
+template <typename T>
+inline bool SlotMap<T>::Erase(SlotHandle handle)
+{
+	const uint32_t denseIndex = IndexOf(handle);
+	if (denseIndex == kInvalidIndex) return false;
+
+	EraseAt(denseIndex);
+	return true;
+}
+
+
+/// -------------------------------------------------------------
+///				　		条件に合う要素の削除
+/// -------------------------------------------------------------
+template <typename T>
+template <typename Pred>
+inline uint32_t SlotMap<T>::EraseIf(Pred&& pred)
+{
+	// 後ろからなめると、末尾から移ってくる要素は判定済みのものだけになる
+	uint32_t erased = 0;
+	for (uint32_t i = GetCount(); i-- > 0;)
+	{
+		if (pred(values_[i]))
+		{
+			EraseAt(i);
+			++erased;
+		}
+	}
+	return erased;
+}
+
+
+/// -------------------------------------------------------------
+///				　			全削除
+/// -------------------------------------------------------------
+template <typename T>
+inline void SlotMap<T>::Clear()
+{
+	for (uint32_t i = GetCount(); i-- > 0;) EraseAt(i);
+}
+
+
+/// -------------------------------------------------------------
+///				　	ハンドルから詰めた位置を求める
+/// -------------------------------------------------------------
+template <typename T>
+inline uint32_t SlotMap<T>::IndexOf(SlotHandle handle) const
+{
+	if (handle.index >= slots_.size()) return kInvalidIndex;
+
+	const Slot& slot = slots_[handle.index];
+	if (!slot.isUsed || slot.generation != handle.generation) return kInvalidIndex;
+	return slot.denseIndexOrNextFree;
+}
+
+
+/// -------------------------------------------------------------
+///				　	詰めた位置の要素を削除
+/// -------------------------------------------------------------
+template <typename T>
+inline void SlotMap<T>::EraseAt(uint32_t denseIndex)
+{
+	assert(denseIndex < GetCount());
+
+	const uint32_t slot = denseToSlot_[denseIndex];
+	const uint32_t last = GetCount() - 1;
+
+	// 末尾の要素を空いた位置に移す
+	if (denseIndex != last)
+	{
+		values_[denseIndex] = std::move(values_[last]);
+		denseToSlot_[denseIndex] = denseToSlot_[last];
+		slots_[denseToSlot_[denseIndex]].denseIndexOrNextFree = denseIndex;
+	}
+	values_.pop_back();
+	denseToSlot_.pop_back();
+
+	// 世代を進めて古いハンドルを無効にする
+	Slot& freed = slots_[slot];
+	freed.isUsed = false;
+	freed.generation = NextGeneration(freed.generation);
+	freed.denseIndexOrNextFree = freeHead_;
+	freeHead_ = slot;
+}
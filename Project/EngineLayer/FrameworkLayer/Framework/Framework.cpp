@@ -8,6 +8,7 @@
 #include <UAVManager.h>
 #include <TextureManager.h>
 #include <ParticleManager.h>
+#include <ModelManager.h>
 #include <SpriteManager.h>
 #include <Object3DCommon.h>
 #include <DebugCamera.h>
@@ -16,6 +17,7 @@
 #include <SkyBoxManager.h>
 #include <PostEffectManager.h>
 #include <BlendStateFactory.h>
+#include <JobSystem.h>
 
 
 /// -------------------------------------------------------------
@@ -54,6 +56,9 @@ void Framework::Initialize()
 
 
 #pragma region ---------- 基盤システムの初期化処理 ----------
+	// ジョブシステムの初期化（コアごとのワーカースレッドを常駐させる）
+	JobSystem::GetInstance()->Initialize();
+
 	// DirectX共通クラスの生成
 	dxCommon_ = DirectXCommon::GetInstance();
 	dxCommon_->Initialize(winApp_, WinApp::kClientWidth, WinApp::kClientHeight);
@@ -139,6 +144,9 @@ void Framework::Update()
 /// -------------------------------------------------------------
 void Framework::Finalize()
 {
+	// ジョブシステムの終了処理（ワーカースレッドの停止）
+	JobSystem::GetInstance()->Finalize();
+
 	// ウィンドウアプリケーションの終了処理
 	winApp_->Finalize();
 
@@ -153,6 +161,9 @@ void Framework::Finalize()
 	// ParticleManagerの終了処理
 	ParticleManager::GetInstance()->Finalize();
 
+	// ModelManagerの終了処理（共有メッシュの解放）
+	ModelManager::GetInstance()->Finalize();
+
 	// シーンマネージャーの解放
 	//sceneManager_.reset();
 
@@ -0,0 +1,229 @@
+#define NOMINMAX
+#include "JobSystem.h"
+
+#include <algorithm>
+
+// 外部スレッド（メインスレッドなど）はワーカー数と同じ番号のキューを使う
+thread_local uint32_t JobSystem::tlsQueueIndex_ = UINT32_MAX;
+
+
+/// -------------------------------------------------------------
+///					シングルトンインスタンス
+/// -------------------------------------------------------------
+JobSystem* JobSystem::GetInstance()
+{
+	static JobSystem instance;
+	return &instance;
+}
+
+
+/// -------------------------------------------------------------
+///				　			初期化処理
+/// -------------------------------------------------------------
+void JobSystem::Initialize(uint32_t workerCount)
+{
+	if (running_) return;
+
+	// メインスレッドも Wait 中に働くので コア数-1 をワーカーにする
+	if (workerCount == 0)
+	{
+		const uint32_t hw = std::max(1u, std::thread::hardware_concurrency());
+		workerCount = std::max(1u, hw - 1);
+	}
+
+	queues_.clear();
+	for (uint32_t i = 0; i < workerCount + 1; ++i)
+	{
+		queues_.push_back(std::make_unique<WorkQueue>());
+	}
+
+	workerCount_ = workerCount;
+	running_ = true;
+
+	workers_.reserve(workerCount);
+	for (uint32_t i = 0; i < workerCount; ++i)
+	{
+		workers_.emplace_back(&JobSystem::WorkerLoop, this, i);
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　			終了処理
+/// -------------------------------------------------------------
+void JobSystem::Finalize()
+{
+	if (!running_) return;
+
+	// 残っているジョブを消化してから止める
+	while (ExecuteOne()) {}
+
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex_);
+		running_ = false;
+	}
+	sleepCondition_.notify_all();
+
+	for (auto& worker : workers_)
+	{
+		if (worker.joinable()) worker.join();
+	}
+
+	workers_.clear();
+	workerCount_ = 0;
+	queues_.clear();
+}
+
+
+/// -------------------------------------------------------------
+///				　			ジョブの投入
+/// -------------------------------------------------------------
+void JobSystem::Run(Job job, JobCounter* counter)
+{
+	if (counter) counter->pending_.fetch_add(1, std::memory_order_relaxed);
+
+	// 未初期化ならその場で実行
+	if (!running_)
+	{
+		job();
+		if (counter) counter->pending_.fetch_sub(1, std::memory_order_release);
+		return;
+	}
+
+	// ワーカーなら自分のキュー、外部スレッドなら共有キューの後ろに積む
+	WorkQueue& queue = *queues_[GetCurrentQueueIndex()];
+	{
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		queue.tasks.push_back({ std::move(job), counter });
+	}
+	queuedCount_.fetch_add(1, std::memory_order_release);
+
+	// 眠っているワーカーを1つと、Wait 中のスレッドを起こす（手伝えるジョブが増えた）
+	NotifySleepers(true);
+}
+
+
+/// -------------------------------------------------------------
+///				　			完了待ち
+/// -------------------------------------------------------------
+void JobSystem::Wait(JobCounter& counter)
+{
+	while (!counter.IsDone())
+	{
+		// 待つ間も手伝う
+		if (ExecuteOne()) continue;
+
+		// 取れるジョブがなければ、カウンターが0になるか新しいジョブが積まれるまで眠る
+		std::unique_lock<std::mutex> lock(sleepMutex_);
+		waitCondition_.wait(lock, [this, &counter]() { return counter.IsDone() || queuedCount_.load(std::memory_order_acquire) > 0; });
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　		ワーカースレッドの本体
+/// -------------------------------------------------------------
+void JobSystem::WorkerLoop(uint32_t index)
+{
+	tlsQueueIndex_ = index;
+
+	while (true)
+	{
+		if (ExecuteOne()) continue;
+
+		// 仕事がなければ投入されるまで眠る
+		std::unique_lock<std::mutex> lock(sleepMutex_);
+		sleepCondition_.wait(lock, [this]() { return !running_ || queuedCount_.load(std::memory_order_acquire) > 0; });
+
+		if (!running_ && queuedCount_.load(std::memory_order_acquire) == 0) break;
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　	ジョブを1つ取り出して実行
+/// -------------------------------------------------------------
+bool JobSystem::ExecuteOne()
+{
+	if (queues_.empty()) return false;
+
+	const uint32_t index = GetCurrentQueueIndex();
+
+	Task task;
+	if (!PopLocal(index, task) && !Steal(index, task)) return false;
+
+	queuedCount_.fetch_sub(1, std::memory_order_relaxed);
+
+	task.job();
+	executedCount_.fetch_add(1, std::memory_order_relaxed);
+
+	// 完了を通知（Wait側でacquireして結果を読む。最後の1つなら眠っている Wait を起こす）
+	if (task.counter && task.counter->pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) NotifySleepers(false);
+
+	return true;
+}
+
+
+/// -------------------------------------------------------------
+///				　	自分のキューから取り出す
+/// -------------------------------------------------------------
+bool JobSystem::PopLocal(uint32_t index, Task& task)
+{
+	WorkQueue& queue = *queues_[index];
+	std::lock_guard<std::mutex> lock(queue.mutex);
+	if (queue.tasks.empty()) return false;
+
+	// 直近に積んだものから処理してキャッシュを活かす
+	task = std::move(queue.tasks.back());
+	queue.tasks.pop_back();
+	return true;
+}
+
+
+/// -------------------------------------------------------------
+///				　		他のキューから盗む
+/// -------------------------------------------------------------
+bool JobSystem::Steal(uint32_t thief, Task& task)
+{
+	const uint32_t queueCount = static_cast<uint32_t>(queues_.size());
+
+	// 隣から順番に覗き、古いものを前から取る
+	for (uint32_t i = 1; i < queueCount; ++i)
+	{
+		WorkQueue& queue = *queues_[(thief + i) % queueCount];
+		std::unique_lock<std::mutex> lock(queue.mutex, std::try_to_lock);
+		if (!lock.owns_lock() || queue.tasks.empty()) continue;
+
+		task = std::move(queue.tasks.front());
+		queue.tasks.pop_front();
+		stealCount_.fetch_add(1, std::memory_order_relaxed);
+		return true;
+	}
+
+	return false;
+}
+
+
+/// -------------------------------------------------------------
+///				　	呼び出しスレッドのキュー番号
+/// -------------------------------------------------------------
+uint32_t JobSystem::GetCurrentQueueIndex() const
+{
+	// ワーカー以外は最後の共有キューを使う
+	if (tlsQueueIndex_ < workerCount_) return tlsQueueIndex_;
+	return static_cast<uint32_t>(queues_.size() - 1);
+}
+
+
+/// -------------------------------------------------------------
+///				　	眠っているスレッドを起こす
+/// -------------------------------------------------------------
+void JobSystem::NotifySleepers(bool wakeWorker)
+{
+	// 条件を確かめてから眠るまでの間に通知が来て取りこぼさないよう、ロックを挟む
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex_);
+	}
+	if (wakeWorker) sleepCondition_.notify_one();
+	waitCondition_.notify_all();
+}
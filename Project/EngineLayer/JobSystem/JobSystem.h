@@ -0,0 +1,174 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+/// -------------------------------------------------------------
+///				ジョブカウンター（待機用のフェンス）
+/// -------------------------------------------------------------
+class JobCounter
+{
+	friend class JobSystem;
+
+public: /// ---------- ゲッター ---------- ///
+
+	// 登録したジョブがすべて終わったか
+	bool IsDone() const { return pending_.load(std::memory_order_acquire) == 0; }
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	// 未完了のジョブ数
+	std::atomic<uint32_t> pending_ = 0;
+};
+
+
+/// -------------------------------------------------------------
+///				　ジョブシステム（ワークスティーリング）
+/// -------------------------------------------------------------
+class JobSystem
+{
+public: /// ---------- 型定義 ---------- ///
+
+	using Job = std::function<void()>;
+
+public: /// ---------- メンバ関数 ---------- ///
+
+	// シングルトンインスタンス
+	static JobSystem* GetInstance();
+
+	// 初期化処理（0ならコア数-1個のワーカーを起動）
+	void Initialize(uint32_t workerCount = 0);
+
+	// 終了処理
+	void Finalize();
+
+	// ジョブの投入（counterを渡すとWaitで完了を待てる）
+	void Run(Job job, JobCounter* counter = nullptr);
+
+	// カウンターが0になるまで待機（待っている間は自分もジョブを消化し、取れるジョブがなければ眠る）
+	void Wait(JobCounter& counter);
+
+	// [0, count) を grain 個ずつに分割して並列実行する（func(begin, end)）
+	template <typename Func>
+	void ParallelFor(size_t count, size_t grain, Func&& func);
+
+public: /// ---------- ゲッター ---------- ///
+
+	// ワーカースレッド数
+	uint32_t GetWorkerCount() const { return workerCount_; }
+
+	// 統計（実行したジョブ数・スティール成功数）
+	uint64_t GetExecutedJobCount() const { return executedCount_.load(std::memory_order_relaxed); }
+	uint64_t GetStealCount() const { return stealCount_.load(std::memory_order_relaxed); }
+
+private: /// ---------- 構造体 ---------- ///
+
+	// 実行単位
+	struct Task
+	{
+		Job job;
+		JobCounter* counter = nullptr;
+	};
+
+	// ワーカーごとの両端キュー（自分は後ろから、他人は前から取る）
+	struct WorkQueue
+	{
+		std::mutex mutex;
+		std::deque<Task> tasks;
+	};
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	// ワーカースレッドの本体
+	void WorkerLoop(uint32_t index);
+
+	// ジョブを1つ取り出して実行（取れなければfalse）
+	bool ExecuteOne();
+
+	// 自分のキューから取り出す
+	bool PopLocal(uint32_t index, Task& task);
+
+	// 他のキューから盗む
+	bool Steal(uint32_t thief, Task& task);
+
+	// 呼び出しスレッドのキュー番号
+	uint32_t GetCurrentQueueIndex() const;
+
+	// 眠っているスレッドを起こす（wakeWorker ならワーカーも1つ起こす）
+	void NotifySleepers(bool wakeWorker);
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	// キュー（ワーカー数 + 外部スレッド用1本）
+	std::vector<std::unique_ptr<WorkQueue>> queues_;
+
+	// ワーカースレッド
+	std::vector<std::thread> workers_;
+	uint32_t workerCount_ = 0;
+
+	// 稼働中フラグ
+	std::atomic<bool> running_ = false;
+
+	// キューに積まれているジョブ数
+	std::atomic<uint32_t> queuedCount_ = 0;
+
+	// 眠っているワーカーを起こすための同期
+	std::mutex sleepMutex_;
+	std::condition_variable sleepCondition_;
+
+	// Wait で眠っているスレッドを起こすための同期（カウンターが0になったか、ジョブが積まれたとき）
+	std::condition_variable waitCondition_;
+
+	// 統計
+	std::atomic<uint64_t> executedCount_ = 0;
+	std::atomic<uint64_t> stealCount_ = 0;
+
+	// ワーカースレッドが自分のキュー番号を覚えておく
+	static thread_local uint32_t tlsQueueIndex_;
+
+private: /// ---------- コピー禁止 ---------- ///
+
+	JobSystem() = default;
+	~JobSystem() = default;
+	JobSystem(const JobSystem&) = delete;
+	const JobSystem& operator=(const JobSystem&) = delete;
+};
+
+
+/// -------------------------------------------------------------
+///				　		並列forの実行
+/// -------------------------------------------------------------
+template<typename Func>
+inline void JobSystem::ParallelFor(size_t count, size_t grain, Func&& func)
+{
+	if (count == 0) return;
+	if (grain == 0) grain = 1;
+
+	// 分割するほどの量がない、またはワーカーがいないならその場で処理
+	if (count <= grain || workerCount_ == 0)
+	{
+		func(size_t(0), count);
+		return;
+	}
+
+	JobCounter counter;
+	const size_t chunks = (count + grain - 1) / grain;
+
+	// 最後の1チャンク以外を投入し、最後は呼び出しスレッドで処理する
+	for (size_t c = 0; c + 1 < chunks; ++c)
+	{
+		const size_t begin = c * grain;
+		const size_t end = begin + grain;
+		Run([&func, begin, end]() { func(begin, end); }, &counter);
+	}
+	func((chunks - 1) * grain, count);
+
+	Wait(counter);
+}
@@ -1,6 +1,6 @@
 #include "ModelManager.h"
 #include <AssimpLoader.h>
-#include "Model.h"
+#include "TextureManager.h"
 #include <numeric>
 
 /// ---------- 初期容量の設定 ----- ///
@@ -97,38 +97,73 @@ ModelData ModelManager::LoadObjFile(const std::string& directoryPath, const std:
 /// -------------------------------------------------------------
 void ModelManager::LoadModel(const std::string& filePath)
 {
-	// 読み込み済みモデルを検索
-	if (models_.contains(filePath))
-	{
-		return; // 既にロード済み
-	}
+	// キャッシュに載せておくだけ（以降のFindModelはヒットする）
+	FindModel(filePath);
+}
 
-	// モデルの生成とファイル読み込み - 初期化
-	auto model = std::make_shared<Model>();
-	model->Initialize(filePath);
 
-	// モデルをmapコンテナに格納する
-	models_.insert(std::make_pair(filePath, model));
+/// -------------------------------------------------------------
+///					　モデルデータの取得関数
+/// -------------------------------------------------------------
+std::shared_ptr<const ModelAsset> ModelManager::FindModel(const std::string& filePath)
+{
+	// 初回のみ読み込みとGPUバッファの生成を行い、以降はハンドルのコピーだけで済ませる
+	return models_.FindOrCreate(filePath, &ModelManager::CreateModelAsset);
 }
 
 
+/// -------------------------------------------------------------
+///				どこからも参照されていないモデルを解放
+/// -------------------------------------------------------------
+size_t ModelManager::ReleaseUnusedModels()
+{
+	// キャッシュ自身しか参照していないものを削除
+	return models_.ReleaseUnused();
+}
+
 
 /// -------------------------------------------------------------
-///					　モデルデータの取得関数
+///				　			終了処理
 /// -------------------------------------------------------------
-std::shared_ptr<Model> ModelManager::FindModel(const std::string& filePath)
+void ModelManager::Finalize()
 {
-	auto it = models_.find(filePath);
-	if (it != models_.end()) {
-		return it->second; // 既に存在するモデルを共有
-	}
+	// GPUリソースをデバイスより先に解放する
+	models_.Clear();
+}
+
+
+/// -------------------------------------------------------------
+///			モデルデータからGPUメッシュとテクスチャを構築
+/// -------------------------------------------------------------
+std::shared_ptr<const ModelAsset> ModelManager::CreateModelAsset(const std::string& filePath)
+{
+	auto asset = std::make_shared<ModelAsset>();
 
 	// AssimpLoaderに読み込みを委譲
-	ModelData data = AssimpLoader::LoadModel(filePath);
-	std::shared_ptr<Model> model = std::make_shared<Model>();
-	models_[filePath] = model;
+	asset->modelData = AssimpLoader::LoadModel(filePath);
+
+	// メッシュとテクスチャの数を予約
+	asset->meshes.reserve(asset->modelData.subMeshes.size());
+	asset->materialSRVs.reserve(asset->modelData.subMeshes.size());
+
+	// テクスチャ未指定時のフォールバック
+	static const std::string kDefaultTexturePath = "white.png";
+
+	for (const auto& sub : asset->modelData.subMeshes)
+	{
+		// テクスチャSRV
+		std::string texturePath = sub.material.textureFilePath; // テクスチャパス
+		if (texturePath.empty()) texturePath = kDefaultTexturePath; // フォールバック
+		TextureManager::GetInstance()->LoadTexture(texturePath); // テクスチャ読み込み
+		asset->materialSRVs.push_back(TextureManager::GetInstance()->GetSrvHandleGPU(texturePath));
+
+		// メッシュ（頂点インデックス）
+		Mesh m = {};
+		m.Initialize(sub.vertices, sub.indices);
+		asset->meshes.push_back(std::move(m));
+	}
 
-	return model;
+	return asset;
 }
 
 
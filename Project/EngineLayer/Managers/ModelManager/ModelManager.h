@@ -1,18 +1,35 @@
 #pragma once
 #include "VertexData.h"
 #include "ModelData.h"
+#include "Mesh.h"
+#include "AssetCache.h"
 #include <fstream>
 #include <sstream>
 #include <string>
 #include <unordered_map>
 #include <algorithm>
+#include <memory>
 
 // Assimp
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
 
-class Model;
+
+/// -------------------------------------------------------------
+///				共有モデルアセット（読み込み後は不変）
+/// -------------------------------------------------------------
+struct ModelAsset
+{
+	// 読み込み済みのモデルデータ
+	ModelData modelData;
+
+	// サブメッシュごとのGPUメッシュ
+	std::vector<Mesh> meshes;
+
+	// サブメッシュごとのテクスチャSRV
+	std::vector<D3D12_GPU_DESCRIPTOR_HANDLE> materialSRVs;
+};
 
 /// -------------------------------------------------------------
 ///					モデルマネージャークラス
@@ -27,14 +44,30 @@ public: /// ---------- メンバ関数 ---------- ///
 	// .objファイルの読み込み
 	static ModelData LoadObjFile(const std::string& directoryPath, const std::string& filename);
 
-	// モデルファイルの読み込み
+	// モデルファイルの読み込み（キャッシュへの事前登録）
 	void LoadModel(const std::string& filePath);
 
-	// モデルの検索
-	std::shared_ptr<Model> FindModel(const std::string& filePath);
+	// モデルの検索（未登録なら読み込んでキャッシュする）
+	std::shared_ptr<const ModelAsset> FindModel(const std::string& filePath);
+
+	// どこからも参照されていないモデルを解放
+	size_t ReleaseUnusedModels();
+
+	// 終了処理（キャッシュの全破棄）
+	void Finalize();
+
+	// キャッシュのヒット数・ミス数
+	uint64_t GetCacheHitCount() const { return models_.GetHitCount(); }
+	uint64_t GetCacheMissCount() const { return models_.GetMissCount(); }
+
+	// キャッシュ済みモデル数
+	size_t GetCachedModelCount() const { return models_.GetCount(); }
 
 private: /// ---------- 静的メンバ関数 ---------- ///
 
+	// モデルデータからGPUメッシュとテクスチャを構築
+	static std::shared_ptr<const ModelAsset> CreateModelAsset(const std::string& filePath);
+
 	// 頂点データを解析する関数
 	static Vector4 ParseVertex(std::istringstream& s);
 
@@ -52,7 +85,8 @@ private: /// ---------- 静的メンバ関数 ---------- ///
 
 private: /// ---------- メンバ変数 ---------- ///
 
-	std::unordered_map<std::string, std::shared_ptr<Model>> models_;
+	// 正規化パス → 共有モデルアセット（キーの正規化と統計は AssetCache が持つ）
+	AssetCache<ModelAsset> models_;
 
 	const std::string directoryPath = "Resources";
 
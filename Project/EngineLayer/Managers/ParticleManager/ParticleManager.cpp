@@ -116,7 +116,7 @@ void ParticleManager::Update()
 {
 	// ビュー行列とプロジェクション行列をカメラから取得
 	Matrix4x4 cameraMatrix = Matrix4x4::MakeAffineMatrix({ 1.0f, 1.0f, 1.0f }, camera_->GetRotate(), camera_->GetTranslate());
-	Matrix4x4 viewMatrix = Matrix4x4::Inverse(cameraMatrix);
+	Matrix4x4 viewMatrix = Matrix4x4::InverseAffine(cameraMatrix);
 	Matrix4x4 projectionMatrix = camera_->GetProjectionMatrix();
 	Matrix4x4 viewProjectionMatrix = Matrix4x4::Multiply(viewMatrix, projectionMatrix);
 
@@ -133,6 +133,7 @@ void ParticleManager::Update()
 	Matrix4x4 backToFrontMatrix = Matrix4x4::MakeIdentity(); // 必要ならY軸回転行列に置換
 	Matrix4x4 billboardMatrix = Matrix4x4::Multiply(backToFrontMatrix, cameraMatrix);
 	billboardMatrix.m[3][0] = billboardMatrix.m[3][1] = billboardMatrix.m[3][2] = 0.0f;
+	const Affine3x4 billboardAffine = Affine3x4::FromMatrix(billboardMatrix);
 
 	// パーティクルグループごとに更新処理
 	for (auto& group : particleGroups)
@@ -228,12 +229,12 @@ void ParticleManager::Update()
 				}
 
 				// 行列更新（transformに任せる）
-				particle.transform.UpdateMatrix(viewProjectionMatrix, useBillboard, billboardMatrix);
+				particle.transform.UpdateMatrix(viewProjectionMatrix, useBillboard, billboardAffine);
 
 				// 書き込み
 				auto& instance = group.second.mappedData[group.second.numParticles];
 				instance.WVP = particle.transform.GetWVPMatrix();
-				instance.World = particle.transform.GetWorldMatrix();
+				instance.World = particle.transform.GetWorldMatrix().ToMatrix();
 
 				// 色とアルファ
 				instance.color = particle.color;
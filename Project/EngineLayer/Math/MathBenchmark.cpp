@@ -0,0 +1,789 @@
+#define NOMINMAX
+#include "MathBenchmark.h"
+#include "Matrix4x4.h"
+#include "Affine3x4.h"
+#include "Vector3.h"
+#include "Quaternion.h"
+#include <LogString.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <utility>
+#include <imgui.h>
+
+namespace
+{
+	using Random = std::mt19937;
+	using Clock = std::chrono::steady_clock;
+
+	/// ---------- 乱数で入力を作る ---------- ///
+
+	float Range(Random& random, float min, float max)
+	{
+		return std::uniform_real_distribution<float>(min, max)(random);
+	}
+
+	Vector3 RandomVector(Random& random, float min, float max)
+	{
+		return { Range(random, min, max), Range(random, min, max), Range(random, min, max) };
+	}
+
+	// 要素がばらばらの行列
+	Matrix4x4 RandomMatrix(Random& random)
+	{
+		Matrix4x4 matrix;
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j) matrix.m[i][j] = Range(random, -2.0f, 2.0f);
+		}
+		return matrix;
+	}
+
+	// WorldTransform と同じ作り方のアフィン行列（逆行列が安定して求まる）
+	Matrix4x4 RandomAffine(Random& random)
+	{
+		return Matrix4x4::MakeAffineMatrix(RandomVector(random, 0.5f, 2.0f), RandomVector(random, -3.1415926f, 3.1415926f), RandomVector(random, -10.0f, 10.0f));
+	}
+
+	// 正規化したクォータニオン
+	Quaternion RandomQuaternion(Random& random)
+	{
+		Quaternion q = { Range(random, -1.0f, 1.0f), Range(random, -1.0f, 1.0f), Range(random, -1.0f, 1.0f), Range(random, -1.0f, 1.0f) };
+		if (Quaternion::Norm(q) < 1.0e-3f) q = Quaternion::IdentityQuaternion();
+		return Quaternion::Normalize(q);
+	}
+
+	// 3x3部分だけを比べるために残りを単位行列にそろえる
+	Matrix4x4 Upper3x3(const Matrix4x4& matrix)
+	{
+		Matrix4x4 result = Matrix4x4::MakeIdentity();
+		for (int i = 0; i < 3; ++i)
+		{
+			for (int j = 0; j < 3; ++j) result.m[i][j] = matrix.m[i][j];
+		}
+		return result;
+	}
+
+	// 結果の全要素の合計
+	float Checksum(const Matrix4x4& matrix)
+	{
+		float sum = 0.0f;
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j) sum += matrix.m[i][j];
+		}
+		return sum;
+	}
+
+	float Checksum(const Affine3x4& affine)
+	{
+		float sum = 0.0f;
+		for (int i = 0; i < 3; ++i)
+		{
+			for (int j = 0; j < 4; ++j) sum += affine.m[i][j];
+		}
+		return sum;
+	}
+
+	float Checksum(const Vector3& vector)
+	{
+		return vector.x + vector.y + vector.z;
+	}
+
+	// 要素ごとの |差| / max(1, |正解|) の最大
+	float MatrixError(const Matrix4x4& value, const Matrix4x4& expected)
+	{
+		float error = 0.0f;
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				error = std::max(error, std::fabs(value.m[i][j] - expected.m[i][j]) / std::max(1.0f, std::fabs(expected.m[i][j])));
+			}
+		}
+		return error;
+	}
+
+	float VectorError(const Vector3& value, const Vector3& expected)
+	{
+		float error = 0.0f;
+		for (int k = 0; k < 3; ++k)
+		{
+			error = std::max(error, std::fabs(value[k] - expected[k]) / std::max(1.0f, std::fabs(expected[k])));
+		}
+		return error;
+	}
+
+	// 一括変換の入出力（同じ点を AoS と SoA の両方で持つ）
+	struct PointSet
+	{
+		std::vector<Vector3> points;
+		std::vector<float> x, y, z;
+
+		explicit PointSet(size_t count) : points(count), x(count), y(count), z(count) {}
+
+		Vector3 GetSoA(size_t i) const { return { x[i], y[i], z[i] }; }
+	};
+
+	PointSet RandomPoints(Random& random, size_t count)
+	{
+		PointSet set(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			set.points[i] = RandomVector(random, -10.0f, 10.0f);
+			set.x[i] = set.points[i].x;
+			set.y[i] = set.points[i].y;
+			set.z[i] = set.points[i].z;
+		}
+		return set;
+	}
+
+	// AoS と SoA の両方の結果を expected(i) と比べる
+	template <typename Expected>
+	float PointSetError(const PointSet& result, Expected&& expected)
+	{
+		float error = 0.0f;
+		for (size_t i = 0; i < result.points.size(); ++i)
+		{
+			const Vector3 e = expected(i);
+			error = std::max({ error, VectorError(result.points[i], e), VectorError(result.GetSoA(i), e) });
+		}
+		return error;
+	}
+
+	float Checksum(const PointSet& set)
+	{
+		// AoS と SoA のどちらに書いたかによらず両方を合計する
+		float sum = 0.0f;
+		for (size_t i = 0; i < set.points.size(); ++i) sum += Checksum(set.points[i]) + Checksum(set.GetSoA(i));
+		return sum;
+	}
+
+	// 4列目（w 用の列）を 0 にした行列（w = 0 の点で割らない処理を通す）
+	Matrix4x4 RandomMatrixWithZeroW(Random& random)
+	{
+		Matrix4x4 matrix = RandomMatrix(random);
+		for (int i = 0; i < 4; ++i) matrix.m[i][3] = 0.0f;
+		return matrix;
+	}
+
+	// q0 から maxAngle ラジアン以内の回転（アニメーションの隣り合うキー）
+	Quaternion RandomNearQuaternion(Random& random, const Quaternion& q0, float maxAngle)
+	{
+		const Quaternion delta = Quaternion::MakeRotateAxisAngleQuaternion(RandomVector(random, -1.0f, 1.0f) + Vector3(0.0f, 0.0f, 1.0e-3f), Range(random, 0.0f, maxAngle));
+		return Quaternion::Normalize(Quaternion::Multiply(q0, delta));
+	}
+
+	// 倍精度の Slerp（正解）
+	Quaternion ReferenceSlerp(const Quaternion& q0, const Quaternion& q1, float t)
+	{
+		const double a[4] = { q0.x, q0.y, q0.z, q0.w };
+		double b[4] = { q1.x, q1.y, q1.z, q1.w };
+		double dot = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+		if (dot < 0.0)
+		{
+			for (double& value : b) value = -value;
+			dot = -dot;
+		}
+		const double theta = std::acos(std::min(dot, 1.0));
+		double s0 = 1.0 - t, s1 = t;
+		if (theta > 1.0e-9)
+		{
+			s0 = std::sin((1.0 - t) * theta) / std::sin(theta);
+			s1 = std::sin(t * theta) / std::sin(theta);
+		}
+		double r[4];
+		for (int k = 0; k < 4; ++k) r[k] = s0 * a[k] + s1 * b[k];
+		return { static_cast<float>(r[0]), static_cast<float>(r[1]), static_cast<float>(r[2]), static_cast<float>(r[3]) };
+	}
+
+	// 成分ごとの |差| の最大（単位クォータニオンどうしなので相対にはしない）
+	float QuaternionError(const Quaternion& value, const Quaternion& expected)
+	{
+		return std::max({ std::fabs(value.x - expected.x), std::fabs(value.y - expected.y), std::fabs(value.z - expected.z), std::fabs(value.w - expected.w) });
+	}
+
+	// x, y, z, w を別々に持つ配列
+	struct QuaternionArrays
+	{
+		std::vector<float> x, y, z, w;
+
+		explicit QuaternionArrays(size_t count) : x(count), y(count), z(count), w(count) {}
+
+		QuaternionSoA View() { return { x, y, z, w }; }
+		Quaternion Get(size_t i) const { return { x[i], y[i], z[i], w[i] }; }
+		void Set(size_t i, const Quaternion& q) { x[i] = q.x; y[i] = q.y; z[i] = q.z; w[i] = q.w; }
+	};
+
+	// 一括補間の入出力（同じキーの組を AoS と SoA の両方で持つ）
+	struct RotationSet
+	{
+		std::vector<Quaternion> from, to, result;
+		QuaternionArrays fromSoA, toSoA, resultSoA;
+		std::vector<float> t;
+
+		explicit RotationSet(size_t count) : from(count), to(count), result(count), fromSoA(count), toSoA(count), resultSoA(count), t(count) {}
+	};
+
+	// maxAngle が 0 なら q1 も向きのばらばらな回転にする
+	RotationSet RandomRotations(Random& random, size_t count, float maxAngle)
+	{
+		RotationSet set(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			set.from[i] = RandomQuaternion(random);
+			set.to[i] = maxAngle > 0.0f ? RandomNearQuaternion(random, set.from[i], maxAngle) : RandomQuaternion(random);
+			set.t[i] = Range(random, 0.0f, 1.0f);
+			set.fromSoA.Set(i, set.from[i]);
+			set.toSoA.Set(i, set.to[i]);
+		}
+		return set;
+	}
+
+	float Checksum(const RotationSet& set)
+	{
+		// AoS と SoA のどちらに書いたかによらず両方を合計する
+		float sum = 0.0f;
+		for (size_t i = 0; i < set.result.size(); ++i)
+		{
+			const Quaternion aos = set.result[i];
+			const Quaternion soa = set.resultSoA.Get(i);
+			sum += aos.x + aos.y + aos.z + aos.w + soa.x + soa.y + soa.z + soa.w;
+		}
+		return sum;
+	}
+
+	// AoS と SoA の両方の結果を expected(i) と比べる
+	template <typename Expected>
+	float RotationSetError(const RotationSet& set, Expected&& expected)
+	{
+		float error = 0.0f;
+		for (size_t i = 0; i < set.result.size(); ++i)
+		{
+			const Quaternion e = expected(i);
+			error = std::max({ error, QuaternionError(set.result[i], e), QuaternionError(set.resultSoA.Get(i), e) });
+		}
+		return error;
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　			すべて実行
+/// -------------------------------------------------------------
+void MathBenchmark::Run()
+{
+	const auto startTime = Clock::now();
+
+	operationResults_.clear();
+	throughputResults_.clear();
+	toleranceResults_.clear();
+
+	RunMatrixBenchmarks();
+	RunMatrixTests();
+	RunAffineBenchmarks();
+	RunAffineTests();
+	RunAffine3x4Benchmarks();
+	RunAffine3x4Tests();
+	RunTransformBenchmarks();
+	RunTransformTests();
+	RunQuaternionBenchmarks();
+	RunQuaternionTests();
+
+	totalMilliseconds_ = std::chrono::duration<float, std::milli>(Clock::now() - startTime).count();
+	hasRun_ = true;
+
+	LogResults();
+}
+
+
+/// -------------------------------------------------------------
+///				　		失敗数の合計
+/// -------------------------------------------------------------
+uint32_t MathBenchmark::GetTotalFailureCount() const
+{
+	uint32_t count = 0;
+	for (const ToleranceResult& result : toleranceResults_) count += result.failureCount;
+	return count;
+}
+
+
+/// -------------------------------------------------------------
+///				　	演算ごとに同じ入力で計測
+/// -------------------------------------------------------------
+template <typename Make, typename Operation>
+void MathBenchmark::Measure(const char* name, Make&& make, Operation&& operation)
+{
+	// 演算ごとに固定の乱数列（スカラー版と SIMD 版を同じ入力で比べられるように、名前ではなく組の番号で決める）
+	Random random(static_cast<uint32_t>(operationResults_.size() / 2) * 7919u + 1u);
+
+	using Input = decltype(make(random));
+	std::vector<Input> inputs;
+	inputs.reserve(kSampleCount);
+	for (uint32_t i = 0; i < kSampleCount; ++i) inputs.push_back(make(random));
+
+	// 結果は配列に書き出し、計測の後で合計する（計算が消されないように。合計の時間は計測に含めない）
+	using Output = decltype(operation(inputs[0]));
+	std::vector<Output> outputs(kSampleCount);
+
+	const auto startTime = Clock::now();
+	for (uint32_t repeat = 0; repeat < kRepeatCount; ++repeat)
+	{
+		for (uint32_t i = 0; i < kSampleCount; ++i) outputs[i] = operation(inputs[i]);
+	}
+	const float nanoseconds = std::chrono::duration<float, std::nano>(Clock::now() - startTime).count();
+
+	float checksum = 0.0f;
+	for (const Output& output : outputs) checksum += Checksum(output);
+
+	OperationResult result;
+	result.name = name;
+	result.nsPerOperation = nanoseconds / static_cast<float>(kSampleCount * kRepeatCount);
+	result.checksum = checksum;
+	operationResults_.push_back(result);
+}
+
+
+/// -------------------------------------------------------------
+///				　	配列を一括で計測
+/// -------------------------------------------------------------
+template <typename Make, typename Operation>
+void MathBenchmark::MeasureThroughput(const char* name, const char* unit, Make&& make, Operation&& operation)
+{
+	// すべての行で同じ入力
+	Random random(1u);
+	const auto input = make(random);
+	auto output = input;
+
+	const auto startTime = Clock::now();
+	for (uint32_t repeat = 0; repeat < kRepeatCount; ++repeat)
+	{
+		operation(input, output);
+	}
+	const float seconds = std::chrono::duration<float>(Clock::now() - startTime).count();
+
+	ThroughputResult result;
+	result.name = name;
+	result.unit = unit;
+	result.itemsPerSecond = static_cast<float>(kSampleCount) * static_cast<float>(kRepeatCount) / seconds;
+	result.checksum = Checksum(output);
+	throughputResults_.push_back(result);
+}
+
+
+/// -------------------------------------------------------------
+///				　	許容誤差を件数分調べる
+/// -------------------------------------------------------------
+template <typename Case>
+void MathBenchmark::CheckTolerance(const char* name, float tolerance, Case&& testCase)
+{
+	ToleranceResult result;
+	result.name = name;
+	result.tolerance = tolerance;
+	result.caseCount = kCaseCount;
+
+	Random random(static_cast<uint32_t>(toleranceResults_.size()) * 1000003u);
+	for (uint32_t i = 0; i < kCaseCount; ++i)
+	{
+		const float error = testCase(random);
+		result.maxError = std::max(result.maxError, error);
+
+		// NaN も失敗に数える
+		if (!(error <= tolerance)) ++result.failureCount;
+	}
+
+	toleranceResults_.push_back(result);
+}
+
+
+/// -------------------------------------------------------------
+///				　		Matrix4x4 の計測
+/// -------------------------------------------------------------
+void MathBenchmark::RunMatrixBenchmarks()
+{
+	using Pair = std::pair<Matrix4x4, Matrix4x4>;
+	auto matrixPair = [](Random& r) { return Pair{ RandomMatrix(r), RandomMatrix(r) }; };
+	auto affine = [](Random& r) { return RandomAffine(r); };
+	auto trs = [](Random& r) { return std::array<Vector3, 3>{ RandomVector(r, 0.5f, 2.0f), RandomVector(r, -3.1415926f, 3.1415926f), RandomVector(r, -10.0f, 10.0f) }; };
+
+	// 同じ入力のスカラー版と並べる（番号の偶数がスカラー版）
+	Measure("Multiply (Scalar)", matrixPair, [](const Pair& p) { return Matrix4x4::MultiplyScalar(p.first, p.second); });
+	Measure("Multiply", matrixPair, [](const Pair& p) { return Matrix4x4::Multiply(p.first, p.second); });
+	Measure("Inverse (Scalar)", affine, [](const Matrix4x4& m) { return Matrix4x4::InverseScalar(m); });
+	Measure("Inverse", affine, [](const Matrix4x4& m) { return Matrix4x4::Inverse(m); });
+	Measure("Transpose (Scalar)", affine, [](const Matrix4x4& m) { return Matrix4x4::TransposeScalar(m); });
+	Measure("Transpose", affine, [](const Matrix4x4& m) { return Matrix4x4::Transpose(m); });
+	Measure("MakeAffineMatrix (Scalar)", trs, [](const std::array<Vector3, 3>& t) { return Matrix4x4::MakeAffineMatrixScalar(t[0], t[1], t[2]); });
+	Measure("MakeAffineMatrix", trs, [](const std::array<Vector3, 3>& t) { return Matrix4x4::MakeAffineMatrix(t[0], t[1], t[2]); });
+}
+
+
+/// -------------------------------------------------------------
+///				　	Matrix4x4 の許容誤差テスト
+/// -------------------------------------------------------------
+void MathBenchmark::RunMatrixTests()
+{
+	// ---------- 足す順番がスカラー版と同じものはビット単位で一致 ---------- //
+	CheckTolerance("Multiply = Scalar", 0.0f, [](Random& r) {
+		const Matrix4x4 a = RandomMatrix(r); const Matrix4x4 b = RandomMatrix(r);
+		return MatrixError(Matrix4x4::Multiply(a, b), Matrix4x4::MultiplyScalar(a, b)); });
+	CheckTolerance("operator* = Scalar", 0.0f, [](Random& r) {
+		const Matrix4x4 a = RandomMatrix(r); const Matrix4x4 b = RandomMatrix(r);
+		return MatrixError(a * b, Matrix4x4::MultiplyScalar(a, b)); });
+	CheckTolerance("Transpose = Scalar", 0.0f, [](Random& r) {
+		const Matrix4x4 a = RandomMatrix(r);
+		return MatrixError(Matrix4x4::Transpose(a), Matrix4x4::TransposeScalar(a)); });
+
+	// ---------- 式の形が違うものは丸め誤差の範囲で一致 ---------- //
+	CheckTolerance("Inverse = Scalar", 1.0e-4f, [](Random& r) {
+		const Matrix4x4 a = RandomAffine(r);
+		return MatrixError(Matrix4x4::Inverse(a), Matrix4x4::InverseScalar(a)); });
+	CheckTolerance("Inverse * M = I", 1.0e-4f, [](Random& r) {
+		const Matrix4x4 a = RandomAffine(r);
+		return MatrixError(Matrix4x4::MultiplyScalar(Matrix4x4::Inverse(a), a), Matrix4x4::MakeIdentity()); });
+	CheckTolerance("MakeAffineMatrix = S*R*T", 1.0e-5f, [](Random& r) {
+		const Vector3 s = RandomVector(r, 0.5f, 2.0f), rotate = RandomVector(r, -3.1415926f, 3.1415926f), t = RandomVector(r, -10.0f, 10.0f);
+		return MatrixError(Matrix4x4::MakeAffineMatrix(s, rotate, t), Matrix4x4::MakeAffineMatrixScalar(s, rotate, t)); });
+}
+
+
+/// -------------------------------------------------------------
+///				　	アフィン行列専用の処理の計測
+/// -------------------------------------------------------------
+void MathBenchmark::RunAffineBenchmarks()
+{
+	using Pair = std::pair<Matrix4x4, Matrix4x4>;
+	struct TRS { Vector3 scale; Quaternion rotate; Vector3 translate; };
+	auto affine = [](Random& r) { return RandomAffine(r); };
+	auto affinePair = [](Random& r) { return Pair{ RandomAffine(r), RandomAffine(r) }; };
+	auto trs = [](Random& r) { return TRS{ RandomVector(r, 0.5f, 2.0f), RandomQuaternion(r), RandomVector(r, -10.0f, 10.0f) }; };
+
+	// 前が一般の処理、後がアフィン専用（同じ入力）
+	Measure("Inverse (General)", affine, [](const Matrix4x4& m) { return Matrix4x4::Inverse(m); });
+	Measure("InverseAffine", affine, [](const Matrix4x4& m) { return Matrix4x4::InverseAffine(m); });
+	Measure("Normal Transpose(Inverse)", affine, [](const Matrix4x4& m) { return Matrix4x4::Transpose(Matrix4x4::Inverse(m)); });
+	Measure("Normal InverseTransposeUpper3x3", affine, [](const Matrix4x4& m) { return Matrix4x4::InverseTransposeUpper3x3(m); });
+	Measure("Affine(Quaternion) S*R*T", trs, [](const TRS& t) {
+		return Matrix4x4::Multiply(Matrix4x4::Multiply(Matrix4x4::MakeScaleMatrix(t.scale), Quaternion::MakeRotateMatrix(t.rotate)), Matrix4x4::MakeTranslateMatrix(t.translate)); });
+	Measure("Affine(Quaternion) Direct", trs, [](const TRS& t) { return Matrix4x4::MakeAffineMatrix(t.scale, t.rotate, t.translate); });
+
+	// 1ジョイントあたり（SkinCluster::UpdatePaletteMatrix：逆バインド × 骨 → 法線行列）
+	Measure("Palette Joint (Before)", affinePair, [](const Pair& p) {
+		const Matrix4x4 skeletonSpace = p.first * p.second; return skeletonSpace + Matrix4x4::Transpose(Matrix4x4::Inverse(skeletonSpace)); });
+	Measure("Palette Joint (After)", affinePair, [](const Pair& p) {
+		const Matrix4x4 skeletonSpace = p.first * p.second; return skeletonSpace + Matrix4x4::InverseTransposeUpper3x3(skeletonSpace); });
+
+	// 1オブジェクトあたり（WorldTransform::Update：合成 → 法線行列。Skeleton の関節はクォータニオンで合成）
+	Measure("World Object (Before)", trs, [](const TRS& t) {
+		const Matrix4x4 world = Matrix4x4::Multiply(Matrix4x4::Multiply(Matrix4x4::MakeScaleMatrix(t.scale), Quaternion::MakeRotateMatrix(t.rotate)), Matrix4x4::MakeTranslateMatrix(t.translate));
+		return world + Matrix4x4::Transpose(Matrix4x4::Inverse(world)); });
+	Measure("World Object (After)", trs, [](const TRS& t) {
+		const Matrix4x4 world = Matrix4x4::MakeAffineMatrix(t.scale, t.rotate, t.translate);
+		return world + Matrix4x4::InverseTransposeUpper3x3(world); });
+}
+
+
+/// -------------------------------------------------------------
+///				　アフィン行列専用の処理の許容誤差テスト
+/// -------------------------------------------------------------
+void MathBenchmark::RunAffineTests()
+{
+	CheckTolerance("InverseAffine = Inverse", 1.0e-4f, [](Random& r) {
+		const Matrix4x4 a = RandomAffine(r);
+		return MatrixError(Matrix4x4::InverseAffine(a), Matrix4x4::InverseScalar(a)); });
+	CheckTolerance("InverseAffine * M = I", 1.0e-4f, [](Random& r) {
+		const Matrix4x4 a = RandomAffine(r);
+		return MatrixError(Matrix4x4::MultiplyScalar(Matrix4x4::InverseAffine(a), a), Matrix4x4::MakeIdentity()); });
+	CheckTolerance("InverseTransposeUpper3x3 (3x3)", 1.0e-4f, [](Random& r) {
+		const Matrix4x4 a = RandomAffine(r);
+		return MatrixError(Matrix4x4::InverseTransposeUpper3x3(a), Upper3x3(Matrix4x4::TransposeScalar(Matrix4x4::InverseScalar(a)))); });
+	CheckTolerance("Affine(Quaternion) = S*R*T", 1.0e-5f, [](Random& r) {
+		const Vector3 s = RandomVector(r, 0.5f, 2.0f), t = RandomVector(r, -10.0f, 10.0f);
+		const Quaternion q = RandomQuaternion(r);
+		const Matrix4x4 expected = Matrix4x4::MultiplyScalar(Matrix4x4::MultiplyScalar(Matrix4x4::MakeScaleMatrix(s), Quaternion::MakeRotateMatrix(q)), Matrix4x4::MakeTranslateMatrix(t));
+		return MatrixError(Matrix4x4::MakeAffineMatrix(s, q, t), expected); });
+}
+
+
+/// -------------------------------------------------------------
+///				　	Affine3x4 と Matrix4x4 の計測
+/// -------------------------------------------------------------
+void MathBenchmark::RunAffine3x4Benchmarks()
+{
+	using Pair = std::pair<Matrix4x4, Matrix4x4>;
+	using AffinePair = std::pair<Affine3x4, Affine3x4>;
+	using PointPair = std::pair<Matrix4x4, Vector3>;
+	using AffinePointPair = std::pair<Affine3x4, Vector3>;
+	struct Joint { Vector3 scale; Quaternion rotate; Vector3 translate; Matrix4x4 parent; };
+	struct AffineJoint { Vector3 scale; Quaternion rotate; Vector3 translate; Affine3x4 parent; };
+
+	// 同じ乱数列から作り、Affine3x4 側は FromMatrix で変換する（前が Matrix4x4、後が Affine3x4）
+	auto pair = [](Random& r) { return Pair{ RandomAffine(r), RandomAffine(r) }; };
+	auto affinePair = [](Random& r) { return AffinePair{ Affine3x4::FromMatrix(RandomAffine(r)), Affine3x4::FromMatrix(RandomAffine(r)) }; };
+	auto viewProjection = [](Random& r) { return Pair{ RandomAffine(r), RandomMatrix(r) }; };
+	auto affineViewProjection = [](Random& r) { const Affine3x4 a = Affine3x4::FromMatrix(RandomAffine(r)); return std::pair<Affine3x4, Matrix4x4>{ a, RandomMatrix(r) }; };
+	auto point = [](Random& r) { return PointPair{ RandomAffine(r), RandomVector(r, -10.0f, 10.0f) }; };
+	auto affinePoint = [](Random& r) { const Affine3x4 a = Affine3x4::FromMatrix(RandomAffine(r)); return AffinePointPair{ a, RandomVector(r, -10.0f, 10.0f) }; };
+	// 波かっこの中は左から順に評価されるので、乱数を引く順番は両方で同じ
+	auto joint = [](Random& r) {
+		return Joint{ RandomVector(r, 0.5f, 2.0f), RandomQuaternion(r), RandomVector(r, -10.0f, 10.0f), RandomAffine(r) }; };
+	auto affineJoint = [](Random& r) {
+		return AffineJoint{ RandomVector(r, 0.5f, 2.0f), RandomQuaternion(r), RandomVector(r, -10.0f, 10.0f), Affine3x4::FromMatrix(RandomAffine(r)) }; };
+
+	Measure("Compose (Matrix4x4)", pair, [](const Pair& p) { return Matrix4x4::Multiply(p.first, p.second); });
+	Measure("Compose (Affine3x4)", affinePair, [](const AffinePair& p) { return Affine3x4::Multiply(p.first, p.second); });
+	Measure("Inverse (Matrix4x4 Affine)", pair, [](const Pair& p) { return Matrix4x4::InverseAffine(p.first); });
+	Measure("Inverse (Affine3x4)", affinePair, [](const AffinePair& p) { return Affine3x4::Inverse(p.first); });
+	Measure("World * VP (Matrix4x4)", viewProjection, [](const Pair& p) { return Matrix4x4::Multiply(p.first, p.second); });
+	Measure("World * VP (Affine3x4)", affineViewProjection, [](const std::pair<Affine3x4, Matrix4x4>& p) { return Affine3x4::Multiply(p.first, p.second); });
+	Measure("TransformPoint (Matrix4x4)", point, [](const PointPair& p) { return Vector3::Transform(p.second, p.first); });
+	Measure("TransformPoint (Affine3x4)", affinePoint, [](const AffinePointPair& p) { return p.first.TransformPoint(p.second); });
+
+	// 1ジョイントあたり（Skeleton::UpdateSkeleton：ローカル行列を作って親と合成）
+	Measure("Skeleton Joint (Matrix4x4)", joint, [](const Joint& j) {
+		return Matrix4x4::MakeAffineMatrix(j.scale, j.rotate, j.translate) * j.parent; });
+	Measure("Skeleton Joint (Affine3x4)", affineJoint, [](const AffineJoint& j) {
+		return Affine3x4::MakeAffine(j.scale, j.rotate, j.translate) * j.parent; });
+}
+
+
+/// -------------------------------------------------------------
+///				　Affine3x4 の並びと結果の一致テスト
+/// -------------------------------------------------------------
+void MathBenchmark::RunAffine3x4Tests()
+{
+	// ---------- 並び：m[i][j] が Matrix4x4 の m[j][i] と対応し、往復で変わらない ---------- //
+	CheckTolerance("Affine3x4 layout", 0.0f, [](Random& r) {
+		const Matrix4x4 a = RandomAffine(r);
+		const Affine3x4 affine = Affine3x4::FromMatrix(a);
+		float error = MatrixError(affine.ToMatrix(), a);
+		for (int i = 0; i < 3; ++i)
+		{
+			for (int j = 0; j < 4; ++j) error = std::max(error, std::fabs(affine.m[i][j] - a.m[j][i]));
+		}
+		return error; });
+
+	// ---------- 足す順番が Matrix4x4 と同じものはビット単位で一致 ---------- //
+	CheckTolerance("Affine3x4 * = Matrix4x4 *", 0.0f, [](Random& r) {
+		const Matrix4x4 a = RandomAffine(r); const Matrix4x4 b = RandomAffine(r);
+		return MatrixError((Affine3x4::FromMatrix(a) * Affine3x4::FromMatrix(b)).ToMatrix(), Matrix4x4::MultiplyScalar(a, b)); });
+	CheckTolerance("Affine3x4 * VP = Matrix4x4 *", 0.0f, [](Random& r) {
+		const Matrix4x4 a = RandomAffine(r); const Matrix4x4 b = RandomMatrix(r);
+		return MatrixError(Affine3x4::FromMatrix(a) * b, Matrix4x4::MultiplyScalar(a, b)); });
+	CheckTolerance("Affine3x4 TransformPoint", 0.0f, [](Random& r) {
+		const Matrix4x4 a = RandomAffine(r); const Vector3 p = RandomVector(r, -10.0f, 10.0f);
+		return VectorError(Affine3x4::FromMatrix(a).TransformPoint(p), Vector3::Transform(p, a)); });
+	CheckTolerance("Affine3x4(Quaternion) = Matrix4x4", 0.0f, [](Random& r) {
+		const Vector3 s = RandomVector(r, 0.5f, 2.0f), t = RandomVector(r, -10.0f, 10.0f);
+		const Quaternion q = RandomQuaternion(r);
+		return MatrixError(Affine3x4::MakeAffine(s, q, t).ToMatrix(), Matrix4x4::MakeAffineMatrix(s, q, t)); });
+
+	// ---------- 式の形が違うものは丸め誤差の範囲で一致 ---------- //
+	CheckTolerance("Affine3x4 Inverse = Inverse", 1.0e-4f, [](Random& r) {
+		const Matrix4x4 a = RandomAffine(r);
+		return MatrixError(Affine3x4::Inverse(Affine3x4::FromMatrix(a)).ToMatrix(), Matrix4x4::InverseScalar(a)); });
+	CheckTolerance("Affine3x4 TransformVector", 1.0e-5f, [](Random& r) {
+		const Matrix4x4 a = RandomAffine(r); const Vector3 v = RandomVector(r, -10.0f, 10.0f);
+		return VectorError(Affine3x4::FromMatrix(a).TransformVector(v), Vector3::Transform(v, a) - a.GetTranslation()); });
+}
+
+
+/// -------------------------------------------------------------
+///				　	Vector3 の一括変換の計測
+/// -------------------------------------------------------------
+void MathBenchmark::RunTransformBenchmarks()
+{
+	Random random(2u);
+	const Matrix4x4 matrix = RandomAffine(random);
+	const Affine3x4 affine = Affine3x4::FromMatrix(matrix);
+	auto points = [](Random& r) { return RandomPoints(r, kSampleCount); };
+
+	// 1点ずつ（Wireframe::DrawSphere などの元のループ）
+	MeasureThroughput("Transform (per point)", "points", points, [&](const PointSet& in, PointSet& out) {
+		for (size_t i = 0; i < in.points.size(); ++i) out.points[i] = Vector3::Transform(in.points[i], matrix); });
+	MeasureThroughput("TransformPoint (Affine3x4)", "points", points, [&](const PointSet& in, PointSet& out) {
+		for (size_t i = 0; i < in.points.size(); ++i) out.points[i] = affine.TransformPoint(in.points[i]); });
+
+	// 一括
+	MeasureThroughput("TransformPoints (AoS)", "points", points, [&](const PointSet& in, PointSet& out) {
+		Vector3::TransformPoints(in.points, matrix, out.points); });
+	MeasureThroughput("TransformPoints (SoA)", "points", points, [&](const PointSet& in, PointSet& out) {
+		Vector3::TransformPoints(in.x, in.y, in.z, matrix, out.x, out.y, out.z); });
+	MeasureThroughput("TransformPointsAffine (AoS)", "points", points, [&](const PointSet& in, PointSet& out) {
+		Vector3::TransformPointsAffine(in.points, affine, out.points); });
+	MeasureThroughput("TransformPointsAffine (SoA)", "points", points, [&](const PointSet& in, PointSet& out) {
+		Vector3::TransformPointsAffine(in.x, in.y, in.z, affine, out.x, out.y, out.z); });
+	MeasureThroughput("TransformVectors (AoS)", "points", points, [&](const PointSet& in, PointSet& out) {
+		Vector3::TransformVectors(in.points, matrix, out.points); });
+	MeasureThroughput("TransformVectors (SoA)", "points", points, [&](const PointSet& in, PointSet& out) {
+		Vector3::TransformVectors(in.x, in.y, in.z, matrix, out.x, out.y, out.z); });
+}
+
+
+/// -------------------------------------------------------------
+///				　一括変換と1点ずつの変換の一致テスト
+/// -------------------------------------------------------------
+void MathBenchmark::RunTransformTests()
+{
+	// 4点ずつの処理と余りの処理の両方を通すように、点の数は 0～13 でばらつかせる
+	auto count = [](Random& r) { return static_cast<size_t>(r() % 14); };
+
+	CheckTolerance("TransformPoints = Transform", 0.0f, [&](Random& r) {
+		const Matrix4x4 m = (r() % 8 == 0) ? RandomMatrixWithZeroW(r) : RandomMatrix(r);
+		const PointSet in = RandomPoints(r, count(r));
+		PointSet out(in.points.size());
+		Vector3::TransformPoints(in.points, m, out.points);
+		Vector3::TransformPoints(in.x, in.y, in.z, m, out.x, out.y, out.z);
+		return PointSetError(out, [&](size_t i) { return Vector3::Transform(in.points[i], m); }); });
+	CheckTolerance("TransformVectors = Transform(3x3)", 0.0f, [&](Random& r) {
+		const Matrix4x4 m = RandomMatrix(r);
+		const PointSet in = RandomPoints(r, count(r));
+		PointSet out(in.points.size());
+		Vector3::TransformVectors(in.points, m, out.points);
+		Vector3::TransformVectors(in.x, in.y, in.z, m, out.x, out.y, out.z);
+		return PointSetError(out, [&](size_t i) { return Vector3::Transform(in.points[i], Upper3x3(m)); }); });
+	CheckTolerance("TransformPointsAffine = Transform", 0.0f, [&](Random& r) {
+		const Matrix4x4 m = RandomAffine(r);
+		const Affine3x4 affine = Affine3x4::FromMatrix(m);
+		const PointSet in = RandomPoints(r, count(r));
+		PointSet out(in.points.size());
+		Vector3::TransformPointsAffine(in.points, affine, out.points);
+		Vector3::TransformPointsAffine(in.x, in.y, in.z, affine, out.x, out.y, out.z);
+		return PointSetError(out, [&](size_t i) { return Vector3::Transform(in.points[i], m); }); });
+	CheckTolerance("TransformPoints in place", 0.0f, [&](Random& r) {
+		const Matrix4x4 m = RandomMatrix(r);
+		PointSet set = RandomPoints(r, count(r));
+		const PointSet in = set;
+		Vector3::TransformPoints(set.points, m, set.points);
+		Vector3::TransformPoints(set.x, set.y, set.z, m, set.x, set.y, set.z);
+		return PointSetError(set, [&](size_t i) { return Vector3::Transform(in.points[i], m); }); });
+}
+
+
+/// -------------------------------------------------------------
+///				　	クォータニオンの補間の計測
+/// -------------------------------------------------------------
+void MathBenchmark::RunQuaternionBenchmarks()
+{
+	// 隣り合うキー程度（30度以内）の組
+	auto rotations = [](Random& r) { return RandomRotations(r, kSampleCount, 0.5f); };
+
+	// 1つずつ（AnimationModel::CalculateValue の元のループ）
+	MeasureThroughput("Slerp (per key)", "quats", rotations, [](const RotationSet& in, RotationSet& out) {
+		for (size_t i = 0; i < in.t.size(); ++i) out.result[i] = Quaternion::Slerp(in.from[i], in.to[i], in.t[i]); });
+	MeasureThroughput("SlerpFast (per key)", "quats", rotations, [](const RotationSet& in, RotationSet& out) {
+		for (size_t i = 0; i < in.t.size(); ++i) out.result[i] = Quaternion::SlerpFast(in.from[i], in.to[i], in.t[i]); });
+	MeasureThroughput("Nlerp (per key)", "quats", rotations, [](const RotationSet& in, RotationSet& out) {
+		for (size_t i = 0; i < in.t.size(); ++i) out.result[i] = Quaternion::Nlerp(in.from[i], in.to[i], in.t[i]); });
+
+	// 一括（SoA）
+	MeasureThroughput("SlerpN (SoA)", "quats", rotations, [](const RotationSet& in, RotationSet& out) {
+		Quaternion::SlerpN(out.fromSoA.View(), out.toSoA.View(), in.t, out.resultSoA.View()); });
+	MeasureThroughput("NlerpN (SoA)", "quats", rotations, [](const RotationSet& in, RotationSet& out) {
+		Quaternion::NlerpN(out.fromSoA.View(), out.toSoA.View(), in.t, out.resultSoA.View()); });
+}
+
+
+/// -------------------------------------------------------------
+///				　クォータニオンの補間の誤差テスト
+/// -------------------------------------------------------------
+void MathBenchmark::RunQuaternionTests()
+{
+	// 4つずつの処理と余りの処理の両方を通すように、件数は 0～13 でばらつかせる
+	auto count = [](Random& r) { return static_cast<size_t>(r() % 14); };
+
+	// 半分は隣り合うキー程度、半分は向きのばらばらな組（180度近くまで）
+	auto rotations = [&](Random& r) { return RandomRotations(r, count(r), (r() % 2 == 0) ? 0.5f : 0.0f); };
+
+	CheckTolerance("Slerp ~ Slerp(double)", 1.0e-5f, [&](Random& r) {
+		RotationSet set = rotations(r);
+		for (size_t i = 0; i < set.t.size(); ++i)
+		{
+			set.result[i] = Quaternion::Slerp(set.from[i], set.to[i], set.t[i]);
+			set.resultSoA.Set(i, set.result[i]);
+		}
+		return RotationSetError(set, [&](size_t i) { return ReferenceSlerp(set.from[i], set.to[i], set.t[i]); }); });
+	CheckTolerance("SlerpFast ~ Slerp(double)", 4.0e-5f, [&](Random& r) {
+		RotationSet set = rotations(r);
+		for (size_t i = 0; i < set.t.size(); ++i) set.result[i] = Quaternion::SlerpFast(set.from[i], set.to[i], set.t[i]);
+		Quaternion::SlerpN(set.fromSoA.View(), set.toSoA.View(), set.t, set.resultSoA.View());
+		return RotationSetError(set, [&](size_t i) { return ReferenceSlerp(set.from[i], set.to[i], set.t[i]); }); });
+	CheckTolerance("Nlerp ~ Slerp (keys <= 30 deg)", 5.0e-4f, [&](Random& r) {
+		RotationSet set = RandomRotations(r, count(r), 0.5f);
+		for (size_t i = 0; i < set.t.size(); ++i) set.result[i] = Quaternion::Nlerp(set.from[i], set.to[i], set.t[i]);
+		Quaternion::NlerpN(set.fromSoA.View(), set.toSoA.View(), set.t, set.resultSoA.View());
+		return RotationSetError(set, [&](size_t i) { return ReferenceSlerp(set.from[i], set.to[i], set.t[i]); }); });
+	CheckTolerance("SlerpN = SlerpFast", 0.0f, [&](Random& r) {
+		RotationSet set = rotations(r);
+		for (size_t i = 0; i < set.t.size(); ++i) set.result[i] = Quaternion::SlerpFast(set.from[i], set.to[i], set.t[i]);
+		Quaternion::SlerpN(set.fromSoA.View(), set.toSoA.View(), set.t, set.resultSoA.View());
+		return RotationSetError(set, [&](size_t i) { return set.result[i]; }); });
+	CheckTolerance("NlerpN = Nlerp", 0.0f, [&](Random& r) {
+		RotationSet set = rotations(r);
+		for (size_t i = 0; i < set.t.size(); ++i) set.result[i] = Quaternion::Nlerp(set.from[i], set.to[i], set.t[i]);
+		Quaternion::NlerpN(set.fromSoA.View(), set.toSoA.View(), set.t, set.resultSoA.View());
+		return RotationSetError(set, [&](size_t i) { return set.result[i]; }); });
+	CheckTolerance("SlerpN in place", 0.0f, [&](Random& r) {
+		RotationSet set = rotations(r);
+		for (size_t i = 0; i < set.t.size(); ++i) set.result[i] = Quaternion::SlerpFast(set.from[i], set.to[i], set.t[i]);
+		Quaternion::SlerpN(set.fromSoA.View(), set.toSoA.View(), set.t, set.fromSoA.View());
+		set.resultSoA = set.fromSoA;
+		return RotationSetError(set, [&](size_t i) { return set.result[i]; }); });
+}
+
+
+/// -------------------------------------------------------------
+///				　			結果をログに出す
+/// -------------------------------------------------------------
+void MathBenchmark::LogResults() const
+{
+	Log(std::format("[MathBenchmark] total {:.1f} ms, Matrix4x4 backend {}, Affine3x4 backend {}\n", totalMilliseconds_, Matrix4x4::GetBackendName(), Affine3x4::GetBackendName()));
+
+	for (const OperationResult& result : operationResults_)
+	{
+		Log(std::format("  {:<32} {:8.2f} ns/op\n", result.name, result.nsPerOperation));
+	}
+
+	for (const ThroughputResult& result : throughputResults_)
+	{
+		Log(std::format("  {:<32} {:8.1f} M {}/s\n", result.name, result.itemsPerSecond * 1.0e-6f, result.unit));
+	}
+
+	for (const ToleranceResult& result : toleranceResults_)
+	{
+		Log(std::format("  {:<32} max error {:.2e} (tolerance {:.0e}) {} / {} failed\n", result.name, result.maxError, result.tolerance, result.failureCount, result.caseCount));
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　			ImGui描画処理
+/// -------------------------------------------------------------
+void MathBenchmark::DrawImGui() const
+{
+	if (!hasRun_) return;
+
+	ImGui::Text("Benchmark : %.1f ms (Matrix4x4 %s, Affine3x4 %s)", totalMilliseconds_, Matrix4x4::GetBackendName(), Affine3x4::GetBackendName());
+
+	if (ImGui::CollapsingHeader("Operations", ImGuiTreeNodeFlags_DefaultOpen))
+	{
+		for (const OperationResult& result : operationResults_)
+			ImGui::Text("%-32s %8.2f ns", result.name, result.nsPerOperation);
+	}
+
+	if (ImGui::CollapsingHeader("Throughput", ImGuiTreeNodeFlags_DefaultOpen))
+	{
+		ImGui::Text("Batch : Vector3 %s, Quaternion %s", Vector3::GetBatchBackendName(), Quaternion::GetBatchBackendName());
+		for (const ThroughputResult& result : throughputResults_)
+			ImGui::Text("%-32s %8.1f M %s/s", result.name, result.itemsPerSecond * 1.0e-6f, result.unit);
+	}
+
+	if (ImGui::CollapsingHeader("Tolerances", ImGuiTreeNodeFlags_DefaultOpen))
+	{
+		ImGui::Text("Failures : %u", GetTotalFailureCount());
+		for (const ToleranceResult& result : toleranceResults_)
+			ImGui::Text("%-32s %.2e / %.0e  %u", result.name, result.maxError, result.tolerance, result.failureCount);
+	}
+}
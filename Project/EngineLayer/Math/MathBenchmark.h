@@ -0,0 +1,118 @@
+#pragma once
+#include <cstdint>
+#include <random>
+#include <vector>
+
+
+/// -------------------------------------------------------------
+///	　　数学ライブラリのベンチマークと許容誤差テスト
+/// -------------------------------------------------------------
+class MathBenchmark
+{
+public: /// ---------- 構造体 ---------- ///
+
+	// 演算ごとの計測結果
+	struct OperationResult
+	{
+		const char* name = "";
+		float nsPerOperation = 0.0f; // 1回あたりの時間
+		float checksum = 0.0f;       // 結果の合計（最適化で計算が消えていないかの目安）
+	};
+
+	// 一括処理の計測結果
+	struct ThroughputResult
+	{
+		const char* name = "";
+		const char* unit = "";      // 1件の呼び名（"points" / "quats"）
+		float itemsPerSecond = 0.0f;
+		float checksum = 0.0f;
+	};
+
+	// 許容誤差テストの結果
+	struct ToleranceResult
+	{
+		const char* name = "";
+		float tolerance = 0.0f; // 0 ならビット単位で一致（-0 と +0 は同じとみなす）
+		float maxError = 0.0f;  // 要素ごとの |差| / max(1, |正解|) の最大
+		uint32_t caseCount = 0;
+		uint32_t failureCount = 0;
+	};
+
+public: /// ---------- メンバ関数 ---------- ///
+
+	// すべて実行（数百ミリ秒かかるので、ボタンを押したときだけ呼ぶ）
+	void Run();
+
+	// ImGui描画処理（呼び出し側のウィンドウ内に描く）
+	void DrawImGui() const;
+
+public: /// ---------- ゲッター ---------- ///
+
+	const std::vector<OperationResult>& GetOperationResults() const { return operationResults_; }
+	const std::vector<ThroughputResult>& GetThroughputResults() const { return throughputResults_; }
+	const std::vector<ToleranceResult>& GetToleranceResults() const { return toleranceResults_; }
+
+	// 許容誤差テストの失敗数の合計
+	uint32_t GetTotalFailureCount() const;
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	// Matrix4x4 の演算ごとの ns/回（スカラー版と並べる）
+	void RunMatrixBenchmarks();
+
+	// Matrix4x4 の SIMD 版とスカラー版の一致
+	void RunMatrixTests();
+
+	// アフィン行列専用の逆行列・法線行列・合成（1オブジェクト・1ジョイントあたりの前後）
+	void RunAffineBenchmarks();
+
+	// アフィン行列専用の処理と一般の処理の一致
+	void RunAffineTests();
+
+	// Affine3x4 と Matrix4x4 の同じ処理を並べる
+	void RunAffine3x4Benchmarks();
+
+	// Affine3x4 の並びと結果が Matrix4x4 と対応しているか
+	void RunAffine3x4Tests();
+
+	// Vector3 の一括変換（1点ずつの Transform と並べて 点/秒）
+	void RunTransformBenchmarks();
+
+	// 一括変換と1点ずつの変換の一致
+	void RunTransformTests();
+
+	// クォータニオンの補間（1つずつの Slerp と一括の SlerpN / NlerpN を並べて 個/秒）
+	void RunQuaternionBenchmarks();
+
+	// SlerpFast / Nlerp の Slerp との差と、一括補間と1つずつの補間の一致
+	void RunQuaternionTests();
+
+	// 結果をログに出す
+	void LogResults() const;
+
+	// make で作った入力に operation をかけて計測
+	template <typename Make, typename Operation>
+	void Measure(const char* name, Make&& make, Operation&& operation);
+
+	// make で作った kSampleCount 件の入力に operation をかけて計測（入力はすべての行で同じ）
+	template <typename Make, typename Operation>
+	void MeasureThroughput(const char* name, const char* unit, Make&& make, Operation&& operation);
+
+	// 1件ごとに誤差を返す関数で、誤差が tolerance を超えた件を数える
+	template <typename Case>
+	void CheckTolerance(const char* name, float tolerance, Case&& testCase);
+
+private: /// ---------- 定数 ---------- ///
+
+	static constexpr uint32_t kSampleCount = 4096;    // 演算ごとの入力の数
+	static constexpr uint32_t kRepeatCount = 64;      // 計測の繰り返し回数
+	static constexpr uint32_t kCaseCount = 20000;     // テストごとの件数
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	std::vector<OperationResult> operationResults_;
+	std::vector<ThroughputResult> throughputResults_;
+	std::vector<ToleranceResult> toleranceResults_;
+	float totalMilliseconds_ = 0.0f;
+	bool hasRun_ = false;
+};
@@ -0,0 +1,323 @@
+#include "Affine3x4.h"
+#include "Matrix4x4.h"
+#include "Vector3.h"
+#include "Quaternion.h"
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#include <emmintrin.h>
+#define AFFINE3X4_SSE2
+#endif
+
+
+namespace
+{
+#if defined(AFFINE3X4_SSE2)
+	/// -------------------------------------------------------------
+	///		SSE2 の行演算（3x4 の1行を __m128 1本で扱う）
+	/// -------------------------------------------------------------
+
+	__m128 LoadRow(const Affine3x4& a, int row) { return _mm_loadu_ps(a.m[row]); }
+	void StoreRow(Affine3x4& a, int row, __m128 value) { _mm_storeu_ps(a.m[row], value); }
+
+	template <int x, int y, int z, int w>
+	__m128 Swizzle(__m128 v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(w, z, y, x)); }
+
+	template <int i>
+	__m128 Splat(__m128 v) { return Swizzle<i, i, i, i>(v); }
+
+	// 3要素の外積（w は 0 になる）
+	__m128 Cross(__m128 a, __m128 b)
+	{
+		return _mm_sub_ps(_mm_mul_ps(Swizzle<1, 2, 0, 3>(a), Swizzle<2, 0, 1, 3>(b)), _mm_mul_ps(Swizzle<2, 0, 1, 3>(a), Swizzle<1, 2, 0, 3>(b)));
+	}
+
+	// 3行それぞれと v の内積を x, y, z に並べる（Vector3::Transform と同じ順に足す）
+	Vector3 Dot3Rows(const Affine3x4& a, __m128 v)
+	{
+		__m128 x = _mm_mul_ps(LoadRow(a, 0), v);
+		__m128 y = _mm_mul_ps(LoadRow(a, 1), v);
+		__m128 z = _mm_mul_ps(LoadRow(a, 2), v);
+		__m128 w = _mm_setzero_ps();
+		_MM_TRANSPOSE4_PS(x, y, z, w);
+
+		alignas(16) float result[4];
+		_mm_store_ps(result, _mm_add_ps(_mm_add_ps(_mm_add_ps(x, y), z), w));
+		return { result[0], result[1], result[2] };
+	}
+#endif
+}
+
+
+/// -------------------------------------------------------------
+///				　		Matrix4x4 との変換
+/// -------------------------------------------------------------
+Affine3x4 Affine3x4::FromMatrix(const Matrix4x4& matrix)
+{
+	Affine3x4 result(Uninitialized{});
+#if defined(AFFINE3X4_SSE2)
+	__m128 r0 = _mm_loadu_ps(matrix.m[0]);
+	__m128 r1 = _mm_loadu_ps(matrix.m[1]);
+	__m128 r2 = _mm_loadu_ps(matrix.m[2]);
+	__m128 r3 = _mm_loadu_ps(matrix.m[3]);
+	_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+	StoreRow(result, 0, r0);
+	StoreRow(result, 1, r1);
+	StoreRow(result, 2, r2);
+#else
+	for (int i = 0; i < 3; ++i)
+	{
+		for (int j = 0; j < 4; ++j) result.m[i][j] = matrix.m[j][i];
+	}
+#endif
+	return result;
+}
+
+Matrix4x4 Affine3x4::ToMatrix() const
+{
+	Matrix4x4 result(Matrix4x4::Uninitialized{});
+#if defined(AFFINE3X4_SSE2)
+	__m128 r0 = LoadRow(*this, 0);
+	__m128 r1 = LoadRow(*this, 1);
+	__m128 r2 = LoadRow(*this, 2);
+	__m128 r3 = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+	_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+	_mm_storeu_ps(result.m[0], r0);
+	_mm_storeu_ps(result.m[1], r1);
+	_mm_storeu_ps(result.m[2], r2);
+	_mm_storeu_ps(result.m[3], r3);
+#else
+	for (int i = 0; i < 4; ++i)
+	{
+		for (int j = 0; j < 3; ++j) result.m[i][j] = m[j][i];
+		result.m[i][3] = (i == 3) ? 1.0f : 0.0f;
+	}
+#endif
+	return result;
+}
+
+
+/// -------------------------------------------------------------
+///				　			作成
+/// -------------------------------------------------------------
+Affine3x4 Affine3x4::MakeIdentity()
+{
+	Affine3x4 result;
+	result.m[0][0] = result.m[1][1] = result.m[2][2] = 1.0f;
+	return result;
+}
+
+Affine3x4 Affine3x4::MakeAffine(const Vector3& scale, const Vector3& rotate, const Vector3& translate)
+{
+	// sin / cos が大半なので、Matrix4x4 の展開済みの式を並べ替えるだけにする
+	return FromMatrix(Matrix4x4::MakeAffineMatrix(scale, rotate, translate));
+}
+
+Affine3x4 Affine3x4::MakeAffine(const Vector3& scale, const Quaternion& rotate, const Vector3& translate)
+{
+	// Matrix4x4::MakeAffineMatrix（Quaternion）と同じ式を列ごとに並べたもの
+	const float xx = rotate.x * rotate.x, yy = rotate.y * rotate.y, zz = rotate.z * rotate.z, ww = rotate.w * rotate.w;
+	const float xy = rotate.x * rotate.y, xz = rotate.x * rotate.z, yz = rotate.y * rotate.z;
+	const float wx = rotate.w * rotate.x, wy = rotate.w * rotate.y, wz = rotate.w * rotate.z;
+
+	Affine3x4 result(Uninitialized{});
+	result.m[0][0] = (ww + xx - yy - zz) * scale.x;
+	result.m[0][1] = (2.0f * (xy - wz)) * scale.y;
+	result.m[0][2] = (2.0f * (xz + wy)) * scale.z;
+	result.m[0][3] = translate.x;
+
+	result.m[1][0] = (2.0f * (xy + wz)) * scale.x;
+	result.m[1][1] = (ww - xx + yy - zz) * scale.y;
+	result.m[1][2] = (2.0f * (yz - wx)) * scale.z;
+	result.m[1][3] = translate.y;
+
+	result.m[2][0] = (2.0f * (xz - wy)) * scale.x;
+	result.m[2][1] = (2.0f * (yz + wx)) * scale.y;
+	result.m[2][2] = (ww - xx - yy + zz) * scale.z;
+	result.m[2][3] = translate.z;
+	return result;
+}
+
+
+/// -------------------------------------------------------------
+///				　			積
+/// -------------------------------------------------------------
+Affine3x4 operator*(const Affine3x4& a1, const Affine3x4& a2)
+{
+	return Affine3x4::Multiply(a1, a2);
+}
+
+Matrix4x4 operator*(const Affine3x4& a, const Matrix4x4& matrix)
+{
+	return Affine3x4::Multiply(a, matrix);
+}
+
+Affine3x4 Affine3x4::Multiply(const Affine3x4& a1, const Affine3x4& a2)
+{
+	// 結果の i 行 = a2 の i 行の係数で a1 の行（と4行目の (0,0,0,1)）を足し合わせる
+	// 足す順番は Matrix4x4::Multiply と同じなので、ToMatrix した積とビット単位で一致する
+	Affine3x4 result(Uninitialized{});
+#if defined(AFFINE3X4_SSE2)
+	const __m128 r0 = LoadRow(a1, 0);
+	const __m128 r1 = LoadRow(a1, 1);
+	const __m128 r2 = LoadRow(a1, 2);
+	const __m128 r3 = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+
+	for (int i = 0; i < 3; ++i)
+	{
+		const __m128 b = LoadRow(a2, i);
+		__m128 row = _mm_mul_ps(Splat<0>(b), r0);
+		row = _mm_add_ps(row, _mm_mul_ps(Splat<1>(b), r1));
+		row = _mm_add_ps(row, _mm_mul_ps(Splat<2>(b), r2));
+		StoreRow(result, i, _mm_add_ps(row, _mm_mul_ps(Splat<3>(b), r3)));
+	}
+#else
+	for (int i = 0; i < 3; ++i)
+	{
+		const float* b = a2.m[i];
+		for (int j = 0; j < 3; ++j)
+		{
+			result.m[i][j] = b[0] * a1.m[0][j] + b[1] * a1.m[1][j] + b[2] * a1.m[2][j];
+		}
+		result.m[i][3] = b[0] * a1.m[0][3] + b[1] * a1.m[1][3] + b[2] * a1.m[2][3] + b[3];
+	}
+#endif
+	return result;
+}
+
+Matrix4x4 Affine3x4::Multiply(const Affine3x4& a, const Matrix4x4& matrix)
+{
+	Matrix4x4 result(Matrix4x4::Uninitialized{});
+#if defined(AFFINE3X4_SSE2)
+	// Matrix4x4 の i 行目の係数は a.m[0..2][i]（4列目の 0 と 1 は掛けずに省く）
+	const __m128 b0 = _mm_loadu_ps(matrix.m[0]);
+	const __m128 b1 = _mm_loadu_ps(matrix.m[1]);
+	const __m128 b2 = _mm_loadu_ps(matrix.m[2]);
+	const __m128 b3 = _mm_loadu_ps(matrix.m[3]);
+
+	for (int i = 0; i < 4; ++i)
+	{
+		__m128 row = _mm_mul_ps(_mm_set1_ps(a.m[0][i]), b0);
+		row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(a.m[1][i]), b1));
+		row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(a.m[2][i]), b2));
+		if (i == 3) row = _mm_add_ps(row, b3);
+		_mm_storeu_ps(result.m[i], row);
+	}
+#else
+	for (int i = 0; i < 4; ++i)
+	{
+		for (int j = 0; j < 4; ++j)
+		{
+			result.m[i][j] = a.m[0][i] * matrix.m[0][j] + a.m[1][i] * matrix.m[1][j] + a.m[2][i] * matrix.m[2][j];
+			if (i == 3) result.m[i][j] += matrix.m[3][j];
+		}
+	}
+#endif
+	return result;
+}
+
+
+/// -------------------------------------------------------------
+///				　			逆行列
+/// -------------------------------------------------------------
+Affine3x4 Affine3x4::Inverse(const Affine3x4& a)
+{
+	// 3x3部分 S（Matrix4x4 の転置）の余因子の行 c0..c2 から
+	// 逆行列の i 行 = (c0[i], c1[i], c2[i], -(t・c)[i]) / 行列式（t は平行移動）
+	Affine3x4 result(Uninitialized{});
+#if defined(AFFINE3X4_SSE2)
+	const __m128 r0 = LoadRow(a, 0);
+	const __m128 r1 = LoadRow(a, 1);
+	const __m128 r2 = LoadRow(a, 2);
+
+	__m128 c0 = Cross(r1, r2);
+	__m128 c1 = Cross(r2, r0);
+	__m128 c2 = Cross(r0, r1);
+
+	__m128 det = _mm_mul_ps(r0, c0);
+	det = _mm_add_ps(det, Swizzle<2, 3, 0, 1>(det));
+	det = _mm_add_ps(det, Swizzle<1, 0, 3, 2>(det));
+	const __m128 inverseDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+
+	__m128 translate = _mm_mul_ps(Splat<3>(r0), c0);
+	translate = _mm_add_ps(translate, _mm_mul_ps(Splat<3>(r1), c1));
+	translate = _mm_add_ps(translate, _mm_mul_ps(Splat<3>(r2), c2));
+	translate = _mm_sub_ps(_mm_setzero_ps(), translate);
+
+	_MM_TRANSPOSE4_PS(c0, c1, c2, translate);
+	StoreRow(result, 0, _mm_mul_ps(c0, inverseDet));
+	StoreRow(result, 1, _mm_mul_ps(c1, inverseDet));
+	StoreRow(result, 2, _mm_mul_ps(c2, inverseDet));
+#else
+	const auto& s = a.m;
+	float c[3][3];
+	for (int i = 0; i < 3; ++i)
+	{
+		const float* u = s[(i + 1) % 3];
+		const float* v = s[(i + 2) % 3];
+		c[i][0] = u[1] * v[2] - u[2] * v[1];
+		c[i][1] = u[2] * v[0] - u[0] * v[2];
+		c[i][2] = u[0] * v[1] - u[1] * v[0];
+	}
+	const float inverseDet = 1.0f / (s[0][0] * c[0][0] + s[0][1] * c[0][1] + s[0][2] * c[0][2]);
+
+	for (int i = 0; i < 3; ++i)
+	{
+		for (int j = 0; j < 3; ++j) result.m[i][j] = c[j][i] * inverseDet;
+		result.m[i][3] = -(s[0][3] * c[0][i] + s[1][3] * c[1][i] + s[2][3] * c[2][i]) * inverseDet;
+	}
+#endif
+	return result;
+}
+
+
+/// -------------------------------------------------------------
+///				　		点・方向の変換
+/// -------------------------------------------------------------
+Vector3 Affine3x4::TransformPoint(const Vector3& point) const
+{
+#if defined(AFFINE3X4_SSE2)
+	return Dot3Rows(*this, _mm_setr_ps(point.x, point.y, point.z, 1.0f));
+#else
+	return {
+		m[0][0] * point.x + m[0][1] * point.y + m[0][2] * point.z + m[0][3],
+		m[1][0] * point.x + m[1][1] * point.y + m[1][2] * point.z + m[1][3],
+		m[2][0] * point.x + m[2][1] * point.y + m[2][2] * point.z + m[2][3] };
+#endif
+}
+
+Vector3 Affine3x4::TransformVector(const Vector3& vector) const
+{
+#if defined(AFFINE3X4_SSE2)
+	return Dot3Rows(*this, _mm_setr_ps(vector.x, vector.y, vector.z, 0.0f));
+#else
+	return {
+		m[0][0] * vector.x + m[0][1] * vector.y + m[0][2] * vector.z,
+		m[1][0] * vector.x + m[1][1] * vector.y + m[1][2] * vector.z,
+		m[2][0] * vector.x + m[2][1] * vector.y + m[2][2] * vector.z };
+#endif
+}
+
+
+/// -------------------------------------------------------------
+///				　		平行移動成分
+/// -------------------------------------------------------------
+Vector3 Affine3x4::GetTranslation() const
+{
+	return { m[0][3], m[1][3], m[2][3] };
+}
+
+void Affine3x4::SetTranslation(const Vector3& translate)
+{
+	m[0][3] = translate.x;
+	m[1][3] = translate.y;
+	m[2][3] = translate.z;
+}
+
+const char* Affine3x4::GetBackendName()
+{
+#if defined(AFFINE3X4_SSE2)
+	return "SSE2";
+#else
+	return "Scalar";
+#endif
+}
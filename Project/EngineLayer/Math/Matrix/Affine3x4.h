@@ -0,0 +1,70 @@
+#pragma once
+
+class Vector3;
+class Quaternion;
+class Matrix4x4;
+
+/// <summary>
+/// アフィン変換（4列目が (0,0,0,1) の Matrix4x4 を 3x4 = 48バイトで持つ）
+/// </summary>
+class Affine3x4 final
+{
+public:
+
+	// Matrix4x4 の列を行として持つ（m[i] = { M[0][i], M[1][i], M[2][i], M[3][i] }）
+	// 変換後の i 成分が m[i] と (x, y, z, 1) の内積になり、1行が __m128 1本に収まる
+	float m[3][4];
+
+	// デフォルトコンストラクタ（ゼロで埋める）
+	Affine3x4() : m{} {}
+
+	friend Affine3x4 operator*(const Affine3x4& a1, const Affine3x4& a2);
+	friend Matrix4x4 operator*(const Affine3x4& a, const Matrix4x4& matrix);
+
+
+	// Matrix4x4 から（4列目は読まない）
+	static Affine3x4 FromMatrix(const Matrix4x4& matrix);
+
+	// Matrix4x4 へ（GPU に送るとき）
+	Matrix4x4 ToMatrix() const;
+
+	// 単位行列
+	static Affine3x4 MakeIdentity();
+
+	// アフィン変換（Vector3）
+	static Affine3x4 MakeAffine(const Vector3& scale, const Vector3& rotate, const Vector3& translate);
+
+	// アフィン変換（Quaternion）
+	static Affine3x4 MakeAffine(const Vector3& scale, const Quaternion& rotate, const Vector3& translate);
+
+	// 積（Matrix4x4::Multiply と同じく a1 の後に a2 をかける）
+	static Affine3x4 Multiply(const Affine3x4& a1, const Affine3x4& a2);
+
+	// 射影などアフィンでない行列との積
+	static Matrix4x4 Multiply(const Affine3x4& a, const Matrix4x4& matrix);
+
+	// 逆行列
+	static Affine3x4 Inverse(const Affine3x4& a);
+
+	// 点の変換（平行移動を含む）
+	Vector3 TransformPoint(const Vector3& point) const;
+
+	// 方向の変換（平行移動を含まない）
+	Vector3 TransformVector(const Vector3& vector) const;
+
+	// 平行移動成分
+	Vector3 GetTranslation() const;
+	void SetTranslation(const Vector3& translate);
+
+	// 積・逆行列・変換で使っている実装の名前（"SSE2" / "Scalar"）
+	static const char* GetBackendName();
+
+private:
+
+	// すべての要素を書き込む計算用（ゼロ埋めを省く）
+	struct Uninitialized {};
+	explicit Affine3x4(Uninitialized) {}
+};
+
+// Matrix4x4（64バイト）の 3/4
+static_assert(sizeof(Affine3x4) == sizeof(float) * 12);
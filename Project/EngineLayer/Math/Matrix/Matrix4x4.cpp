@@ -2,18 +2,128 @@
 #include "Vector3.h"
 #include "Quaternion.h"
 
-Vector3 Matrix4x4::GetTranslation() const
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define MATRIX4X4_AVX2
+#define MATRIX4X4_SSE2
+#elif defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#include <emmintrin.h>
+#define MATRIX4X4_SSE2
+#endif
+
+
+namespace
 {
-	return { m[3][0], m[3][1], m[3][2] };
+#if defined(MATRIX4X4_SSE2)
+	/// -------------------------------------------------------------
+	///		SSE2 の行演算（行優先のまま1行を __m128 1本で扱う）
+	/// -------------------------------------------------------------
+
+	__m128 LoadRow(const Matrix4x4& matrix, int row) { return _mm_loadu_ps(matrix.m[row]); }
+	void StoreRow(Matrix4x4& matrix, int row, __m128 value) { _mm_storeu_ps(matrix.m[row], value); }
+
+	// 要素の並べ替え（v1 から2つ、v2 から2つ）
+	template <int x, int y, int z, int w>
+	__m128 Shuffle(__m128 v1, __m128 v2) { return _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(w, z, y, x)); }
+
+	template <int x, int y, int z, int w>
+	__m128 Swizzle(__m128 v) { return Shuffle<x, y, z, w>(v, v); }
+
+	template <int i>
+	__m128 Splat(__m128 v) { return Swizzle<i, i, i, i>(v); }
+
+#if !defined(MATRIX4X4_AVX2)
+	// 1行 × 行列（スカラー版と同じ順に足すので結果も同じ。AVX2 では Multiply が2行ずつ計算するので使わない）
+	__m128 MultiplyRow(__m128 a, __m128 b0, __m128 b1, __m128 b2, __m128 b3)
+	{
+		__m128 result = _mm_mul_ps(Splat<0>(a), b0);
+		result = _mm_add_ps(result, _mm_mul_ps(Splat<1>(a), b1));
+		result = _mm_add_ps(result, _mm_mul_ps(Splat<2>(a), b2));
+		return _mm_add_ps(result, _mm_mul_ps(Splat<3>(a), b3));
+	}
+#endif
+
+	// 3要素の外積（w は 0 になる）
+	__m128 Cross(__m128 a, __m128 b)
+	{
+		return _mm_sub_ps(_mm_mul_ps(Swizzle<1, 2, 0, 3>(a), Swizzle<2, 0, 1, 3>(b)), _mm_mul_ps(Swizzle<2, 0, 1, 3>(a), Swizzle<1, 2, 0, 3>(b)));
+	}
+
+	// 3x3部分の余因子行列の行（残りの2行の外積）と、全レーンに広げた 1 / 行列式
+	__m128 Cofactor3x3(__m128 r0, __m128 r1, __m128 r2, __m128& c0, __m128& c1, __m128& c2)
+	{
+		c0 = Cross(r1, r2);
+		c1 = Cross(r2, r0);
+		c2 = Cross(r0, r1);
+
+		__m128 det = _mm_mul_ps(r0, c0);
+		det = _mm_add_ps(det, Swizzle<2, 3, 0, 1>(det));
+		det = _mm_add_ps(det, Swizzle<1, 0, 3, 2>(det));
+		return _mm_div_ps(_mm_set1_ps(1.0f), det);
+	}
+
+	// 2x2 行列（a b / c d を1本に詰めたもの）の積 A * B
+	__m128 Mat2Mul(__m128 a, __m128 b)
+	{
+		return _mm_add_ps(_mm_mul_ps(a, Swizzle<0, 3, 0, 3>(b)), _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+	}
+
+	// 余因子行列との積 adj(A) * B
+	__m128 Mat2AdjMul(__m128 a, __m128 b)
+	{
+		return _mm_sub_ps(_mm_mul_ps(Swizzle<3, 3, 0, 0>(a), b), _mm_mul_ps(Swizzle<1, 1, 2, 2>(a), Swizzle<2, 3, 0, 1>(b)));
+	}
+
+	// 余因子行列との積 A * adj(B)
+	__m128 Mat2MulAdj(__m128 a, __m128 b)
+	{
+		return _mm_sub_ps(_mm_mul_ps(a, Swizzle<3, 0, 3, 0>(b)), _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+	}
+#endif
+
+#if !defined(MATRIX4X4_SSE2)
+	// 3x3部分の余因子行列（i 行目は残りの2行の外積）と行列式
+	float Cofactor3x3(const Matrix4x4& matrix, float out[3][3])
+	{
+		const auto& m = matrix.m;
+		out[0][0] = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+		out[0][1] = m[1][2] * m[2][0] - m[1][0] * m[2][2];
+		out[0][2] = m[1][0] * m[2][1] - m[1][1] * m[2][0];
+		out[1][0] = m[2][1] * m[0][2] - m[2][2] * m[0][1];
+		out[1][1] = m[2][2] * m[0][0] - m[2][0] * m[0][2];
+		out[1][2] = m[2][0] * m[0][1] - m[2][1] * m[0][0];
+		out[2][0] = m[0][1] * m[1][2] - m[0][2] * m[1][1];
+		out[2][1] = m[0][2] * m[1][0] - m[0][0] * m[1][2];
+		out[2][2] = m[0][0] * m[1][1] - m[0][1] * m[1][0];
+		return m[0][0] * out[0][0] + m[0][1] * out[0][1] + m[0][2] * out[0][2];
+	}
+#endif
+
+	// XYZ回転（Rx * Ry * Rz を展開したもの）の3x3部分
+	void WriteRotateXYZ(const Vector3& radian, float out[3][3])
+	{
+		const float sx = std::sin(radian.x), cx = std::cos(radian.x);
+		const float sy = std::sin(radian.y), cy = std::cos(radian.y);
+		const float sz = std::sin(radian.z), cz = std::cos(radian.z);
+
+		out[0][0] = cy * cz;
+		out[0][1] = cy * sz;
+		out[0][2] = sy;
+		out[1][0] = -sx * sy * cz - cx * sz;
+		out[1][1] = -sx * sy * sz + cx * cz;
+		out[1][2] = sx * cy;
+		out[2][0] = -cx * sy * cz + sx * sz;
+		out[2][1] = -cx * sy * sz - sx * cz;
+		out[2][2] = cx * cy;
+	}
 }
 
-Matrix4x4::Matrix4x4()
+
+Vector3 Matrix4x4::GetTranslation() const
 {
-	for (int i = 0; i < 4; ++i) {
-		for (int j = 0; j < 4; ++j) {
-			m[i][j] = 0.0f;
-		}
-	}
+	return { m[3][0], m[3][1], m[3][2] };
 }
 
 Matrix4x4::Matrix4x4(float elements[4][4])
@@ -46,16 +156,7 @@ Matrix4x4& Matrix4x4::operator-=(const Matrix4x4& other)
 Matrix4x4& Matrix4x4::operator*=(const Matrix4x4& other)
 {
 	// 乗算の実装
-	Matrix4x4 result;
-	for (int i = 0; i < 4; ++i) {
-		for (int j = 0; j < 4; ++j) {
-			result.m[i][j] = 0;
-			for (int k = 0; k < 4; ++k) {
-				result.m[i][j] += m[i][k] * other.m[k][j];
-			}
-		}
-	}
-	*this = result;
+	*this = Multiply(*this, other);
 	return *this;
 }
 
@@ -83,9 +184,7 @@ Matrix4x4 operator-(const Matrix4x4& m1, const Matrix4x4& m2)
 
 Matrix4x4 operator*(const Matrix4x4& m1, const Matrix4x4& m2)
 {
-	Matrix4x4 result = m1;
-	result *= m2;
-	return result;
+	return Matrix4x4::Multiply(m1, m2);
 }
 
 Matrix4x4 Matrix4x4::Add(const Matrix4x4& m1, const Matrix4x4& m2)
@@ -115,6 +214,37 @@ Matrix4x4 Matrix4x4::Subtract(const Matrix4x4& m1, const Matrix4x4& m2)
 }
 
 Matrix4x4 Matrix4x4::Multiply(const Matrix4x4& m1, const Matrix4x4& m2)
+{
+#if defined(MATRIX4X4_AVX2)
+	// 2行ずつ：各行の k 番目の要素を128bitレーン内で広げ、B の k 行目（両レーンに複製）に掛けて足す
+	const __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m2.m[0]));
+	const __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m2.m[1]));
+	const __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m2.m[2]));
+	const __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m2.m[3]));
+
+	Matrix4x4 result(Uninitialized{});
+	for (int row = 0; row < 4; row += 2)
+	{
+		const __m256 a = _mm256_loadu_ps(m1.m[row]);
+		__m256 r = _mm256_mul_ps(_mm256_shuffle_ps(a, a, 0x00), b0);
+		r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_shuffle_ps(a, a, 0x55), b1));
+		r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_shuffle_ps(a, a, 0xAA), b2));
+		r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_shuffle_ps(a, a, 0xFF), b3));
+		_mm256_storeu_ps(result.m[row], r);
+	}
+	return result;
+#elif defined(MATRIX4X4_SSE2)
+	const __m128 b0 = LoadRow(m2, 0), b1 = LoadRow(m2, 1), b2 = LoadRow(m2, 2), b3 = LoadRow(m2, 3);
+
+	Matrix4x4 result(Uninitialized{});
+	for (int row = 0; row < 4; ++row) StoreRow(result, row, MultiplyRow(LoadRow(m1, row), b0, b1, b2, b3));
+	return result;
+#else
+	return MultiplyScalar(m1, m2);
+#endif
+}
+
+Matrix4x4 Matrix4x4::MultiplyScalar(const Matrix4x4& m1, const Matrix4x4& m2)
 {
 	Matrix4x4 result{};
 	for (int i = 0; i < 4; i++)
@@ -131,6 +261,134 @@ Matrix4x4 Matrix4x4::Multiply(const Matrix4x4& m1, const Matrix4x4& m2)
 }
 
 Matrix4x4 Matrix4x4::Inverse(const Matrix4x4& matrix)
+{
+#if defined(MATRIX4X4_SSE2)
+	// 2x2 のブロックに分けて求める（M = [A B; C D]、各ブロックは行優先で1本に詰める）
+	const __m128 r0 = LoadRow(matrix, 0), r1 = LoadRow(matrix, 1), r2 = LoadRow(matrix, 2), r3 = LoadRow(matrix, 3);
+	const __m128 a = _mm_movelh_ps(r0, r1);
+	const __m128 b = _mm_movehl_ps(r1, r0);
+	const __m128 c = _mm_movelh_ps(r2, r3);
+	const __m128 d = _mm_movehl_ps(r3, r2);
+
+	// 各ブロックの行列式 (|A|, |B|, |C|, |D|)
+	const __m128 detSub = _mm_sub_ps(
+		_mm_mul_ps(Shuffle<0, 2, 0, 2>(r0, r2), Shuffle<1, 3, 1, 3>(r1, r3)),
+		_mm_mul_ps(Shuffle<1, 3, 1, 3>(r0, r2), Shuffle<0, 2, 0, 2>(r1, r3)));
+	const __m128 detA = Splat<0>(detSub);
+	const __m128 detB = Splat<1>(detSub);
+	const __m128 detC = Splat<2>(detSub);
+	const __m128 detD = Splat<3>(detSub);
+
+	const __m128 adjDC = Mat2AdjMul(d, c);
+	const __m128 adjAB = Mat2AdjMul(a, b);
+
+	// 逆行列の各ブロック × |M|（この時点では余因子の形）
+	__m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), Mat2Mul(b, adjDC));
+	__m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), Mat2Mul(c, adjAB));
+	__m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), Mat2MulAdj(d, adjAB));
+	__m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), Mat2MulAdj(a, adjDC));
+
+	// |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+	__m128 trace = _mm_mul_ps(adjAB, Swizzle<0, 2, 1, 3>(adjDC));
+	trace = _mm_add_ps(trace, Swizzle<2, 3, 0, 1>(trace));
+	trace = _mm_add_ps(trace, Swizzle<1, 0, 3, 2>(trace));
+	const __m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+
+	// 余因子の符号を付けて |M| で割る
+	const __m128 inverseDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+	x = _mm_mul_ps(x, inverseDet);
+	y = _mm_mul_ps(y, inverseDet);
+	z = _mm_mul_ps(z, inverseDet);
+	w = _mm_mul_ps(w, inverseDet);
+
+	// 余因子行列の並べ替えと行への詰め直しをまとめて行う
+	Matrix4x4 result(Uninitialized{});
+	StoreRow(result, 0, Shuffle<3, 1, 3, 1>(x, y));
+	StoreRow(result, 1, Shuffle<2, 0, 2, 0>(x, y));
+	StoreRow(result, 2, Shuffle<3, 1, 3, 1>(z, w));
+	StoreRow(result, 3, Shuffle<2, 0, 2, 0>(z, w));
+	return result;
+#else
+	return InverseScalar(matrix);
+#endif
+}
+
+Matrix4x4 Matrix4x4::InverseAffine(const Matrix4x4& matrix)
+{
+	// [A 0; t 1] の逆行列は [A^-1 0; -t A^-1 1]（A^-1 は余因子行列の転置 / 行列式）
+#if defined(MATRIX4X4_SSE2)
+	const __m128 translate = LoadRow(matrix, 3);
+	__m128 c0, c1, c2;
+	const __m128 inverseDet = Cofactor3x3(LoadRow(matrix, 0), LoadRow(matrix, 1), LoadRow(matrix, 2), c0, c1, c2);
+
+	// 余因子の行を転置して 1 / 行列式 を掛ける（4行目に0を入れて w 列も0にする）
+	__m128 zero = _mm_setzero_ps();
+	_MM_TRANSPOSE4_PS(c0, c1, c2, zero);
+	const __m128 i0 = _mm_mul_ps(c0, inverseDet);
+	const __m128 i1 = _mm_mul_ps(c1, inverseDet);
+	const __m128 i2 = _mm_mul_ps(c2, inverseDet);
+
+	// 平行移動は (0,0,0,1) - t * A^-1
+	__m128 i3 = _mm_mul_ps(Splat<0>(translate), i0);
+	i3 = _mm_add_ps(i3, _mm_mul_ps(Splat<1>(translate), i1));
+	i3 = _mm_add_ps(i3, _mm_mul_ps(Splat<2>(translate), i2));
+	i3 = _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), i3);
+
+	Matrix4x4 result(Uninitialized{});
+	StoreRow(result, 0, i0);
+	StoreRow(result, 1, i1);
+	StoreRow(result, 2, i2);
+	StoreRow(result, 3, i3);
+	return result;
+#else
+	float cofactor[3][3];
+	const float inverseDet = 1.0f / Cofactor3x3(matrix, cofactor);
+
+	Matrix4x4 result(Uninitialized{});
+	for (int i = 0; i < 3; ++i)
+	{
+		for (int j = 0; j < 3; ++j) result.m[i][j] = cofactor[j][i] * inverseDet;
+		result.m[i][3] = 0.0f;
+	}
+	for (int j = 0; j < 3; ++j)
+	{
+		result.m[3][j] = -(matrix.m[3][0] * result.m[0][j] + matrix.m[3][1] * result.m[1][j] + matrix.m[3][2] * result.m[2][j]);
+	}
+	result.m[3][3] = 1.0f;
+	return result;
+#endif
+}
+
+Matrix4x4 Matrix4x4::InverseTransposeUpper3x3(const Matrix4x4& matrix)
+{
+	// 逆行列の転置は余因子行列 / 行列式なので、転置も4x4の逆行列もいらない
+#if defined(MATRIX4X4_SSE2)
+	__m128 c0, c1, c2;
+	const __m128 inverseDet = Cofactor3x3(LoadRow(matrix, 0), LoadRow(matrix, 1), LoadRow(matrix, 2), c0, c1, c2);
+
+	Matrix4x4 result(Uninitialized{});
+	StoreRow(result, 0, _mm_mul_ps(c0, inverseDet));
+	StoreRow(result, 1, _mm_mul_ps(c1, inverseDet));
+	StoreRow(result, 2, _mm_mul_ps(c2, inverseDet));
+	StoreRow(result, 3, _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
+	return result;
+#else
+	float cofactor[3][3];
+	const float inverseDet = 1.0f / Cofactor3x3(matrix, cofactor);
+
+	Matrix4x4 result(Uninitialized{});
+	for (int i = 0; i < 3; ++i)
+	{
+		for (int j = 0; j < 3; ++j) result.m[i][j] = cofactor[i][j] * inverseDet;
+		result.m[i][3] = 0.0f;
+		result.m[3][i] = 0.0f;
+	}
+	result.m[3][3] = 1.0f;
+	return result;
+#endif
+}
+
+Matrix4x4 Matrix4x4::InverseScalar(const Matrix4x4& matrix)
 {
 	Matrix4x4 result{};
 
@@ -164,6 +422,23 @@ Matrix4x4 Matrix4x4::Inverse(const Matrix4x4& matrix)
 }
 
 Matrix4x4 Matrix4x4::Transpose(const Matrix4x4& m)
+{
+#if defined(MATRIX4X4_SSE2)
+	__m128 r0 = LoadRow(m, 0), r1 = LoadRow(m, 1), r2 = LoadRow(m, 2), r3 = LoadRow(m, 3);
+	_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+	Matrix4x4 result(Uninitialized{});
+	StoreRow(result, 0, r0);
+	StoreRow(result, 1, r1);
+	StoreRow(result, 2, r2);
+	StoreRow(result, 3, r3);
+	return result;
+#else
+	return TransposeScalar(m);
+#endif
+}
+
+Matrix4x4 Matrix4x4::TransposeScalar(const Matrix4x4& m)
 {
 	Matrix4x4 result{};
 	for (int i = 0; i < 4; i++)
@@ -244,7 +519,17 @@ Matrix4x4 Matrix4x4::MakeRotateZMatrix(float radian)
 
 Matrix4x4 Matrix4x4::MakeRotateMatrix(const Vector3& radian)
 {
-	return Multiply(Multiply(MakeRotateXMatrix(radian.x), MakeRotateYMatrix(radian.y)), MakeRotateZMatrix(radian.z));
+	// 3つの回転行列を作って掛ける代わりに、展開した式で直接埋める
+	float rotate[3][3];
+	WriteRotateXYZ(radian, rotate);
+
+	Matrix4x4 result{};
+	for (int i = 0; i < 3; ++i)
+	{
+		for (int j = 0; j < 3; ++j) result.m[i][j] = rotate[i][j];
+	}
+	result.m[3][3] = 1.0f;
+	return result;
 }
 
 Matrix4x4 Matrix4x4::MakeTranslateMatrix(const Vector3& translate)
@@ -272,12 +557,59 @@ Matrix4x4 Matrix4x4::MakeTranslateMatrix(const Vector3& translate)
 
 Matrix4x4 Matrix4x4::MakeAffineMatrix(const Vector3& scale, const Vector3& rotate, const Vector3& translate)
 {
-	return  Multiply(Multiply(MakeScaleMatrix(scale), MakeRotateMatrix(rotate)), MakeTranslateMatrix(translate));
+	// S * R * T は「回転の各行を拡大率倍したもの + 最後の行に平行移動」なので直接埋める
+	float rotation[3][3];
+	WriteRotateXYZ(rotate, rotation);
+
+	Matrix4x4 result(Uninitialized{});
+	const float scales[3] = { scale.x, scale.y, scale.z };
+	for (int i = 0; i < 3; ++i)
+	{
+		result.m[i][0] = rotation[i][0] * scales[i];
+		result.m[i][1] = rotation[i][1] * scales[i];
+		result.m[i][2] = rotation[i][2] * scales[i];
+		result.m[i][3] = 0.0f;
+	}
+	result.m[3][0] = translate.x;
+	result.m[3][1] = translate.y;
+	result.m[3][2] = translate.z;
+	result.m[3][3] = 1.0f;
+	return result;
+}
+
+Matrix4x4 Matrix4x4::MakeAffineMatrixScalar(const Vector3& scale, const Vector3& rotate, const Vector3& translate)
+{
+	return MultiplyScalar(MultiplyScalar(MakeScaleMatrix(scale), MultiplyScalar(MultiplyScalar(MakeRotateXMatrix(rotate.x), MakeRotateYMatrix(rotate.y)), MakeRotateZMatrix(rotate.z))), MakeTranslateMatrix(translate));
 }
 
 Matrix4x4 Matrix4x4::MakeAffineMatrix(const Vector3& scale, const Quaternion& rotate, const Vector3& translate)
 {
-	return Multiply(Multiply(MakeScaleMatrix(scale), Quaternion::MakeRotateMatrix(rotate)), MakeTranslateMatrix(translate));
+	// Quaternion::MakeRotateMatrix と同じ式の各行を拡大率倍し、最後の行に平行移動を入れる
+	const float xx = rotate.x * rotate.x, yy = rotate.y * rotate.y, zz = rotate.z * rotate.z, ww = rotate.w * rotate.w;
+	const float xy = rotate.x * rotate.y, xz = rotate.x * rotate.z, yz = rotate.y * rotate.z;
+	const float wx = rotate.w * rotate.x, wy = rotate.w * rotate.y, wz = rotate.w * rotate.z;
+
+	Matrix4x4 result(Uninitialized{});
+	result.m[0][0] = (ww + xx - yy - zz) * scale.x;
+	result.m[0][1] = (2.0f * (xy + wz)) * scale.x;
+	result.m[0][2] = (2.0f * (xz - wy)) * scale.x;
+	result.m[0][3] = 0.0f;
+
+	result.m[1][0] = (2.0f * (xy - wz)) * scale.y;
+	result.m[1][1] = (ww - xx + yy - zz) * scale.y;
+	result.m[1][2] = (2.0f * (yz + wx)) * scale.y;
+	result.m[1][3] = 0.0f;
+
+	result.m[2][0] = (2.0f * (xz + wy)) * scale.z;
+	result.m[2][1] = (2.0f * (yz - wx)) * scale.z;
+	result.m[2][2] = (ww - xx - yy + zz) * scale.z;
+	result.m[2][3] = 0.0f;
+
+	result.m[3][0] = translate.x;
+	result.m[3][1] = translate.y;
+	result.m[3][2] = translate.z;
+	result.m[3][3] = 1.0f;
+	return result;
 }
 
 Matrix4x4 Matrix4x4::MakePerspectiveFovMatrix(float fovY, float aspectRatio, float nearClip, float farClip)
@@ -352,3 +684,14 @@ Matrix4x4 Matrix4x4::MakeRotateAxisAngleMatrix(const Vector3& axis, float angle)
 
 	return result;
 }
+
+const char* Matrix4x4::GetBackendName()
+{
+#if defined(MATRIX4X4_AVX2)
+	return "AVX2";
+#elif defined(MATRIX4X4_SSE2)
+	return "SSE2";
+#else
+	return "Scalar";
+#endif
+}
@@ -16,8 +16,8 @@ public:
 
 	float m[4][4];
 
-	// デフォルトコンストラクタ
-	Matrix4x4();
+	// デフォルトコンストラクタ（ゼロで埋める）
+	Matrix4x4() : m{} {}
 
 	// 指定された値で初期化するコンストラクタ
 	Matrix4x4(float elements[4][4]);
@@ -66,6 +66,12 @@ public:
 	// 逆行列
 	static Matrix4x4 Inverse(const Matrix4x4& matrix);
 
+	// アフィン行列（最後の列が (0,0,0,1)）の逆行列。3x3部分の余因子と平行移動だけで求める
+	static Matrix4x4 InverseAffine(const Matrix4x4& matrix);
+
+	// 法線用の Transpose(Inverse(matrix)) の3x3部分（残りは単位行列と同じ。シェーダーは float3x3 でしか読まない）
+	static Matrix4x4 InverseTransposeUpper3x3(const Matrix4x4& matrix);
+
 	// 転置行列
 	static Matrix4x4 Transpose(const Matrix4x4& m);
 
@@ -107,4 +113,20 @@ public:
 
 	// 軸と角度から回転行列を生成
 	static Matrix4x4 MakeRotateAxisAngleMatrix(const Vector3& axis, float angle);
+
+	// 積・逆行列・転置で使っている実装の名前（"AVX2" / "SSE2" / "Scalar"）
+	static const char* GetBackendName();
+
+	// スカラー版（SIMD版の正解として比較・計測に使う）
+	static Matrix4x4 MultiplyScalar(const Matrix4x4& m1, const Matrix4x4& m2);
+	static Matrix4x4 InverseScalar(const Matrix4x4& matrix);
+	static Matrix4x4 TransposeScalar(const Matrix4x4& m);
+	static Matrix4x4 MakeAffineMatrixScalar(const Vector3& scale, const Vector3& rotate, const Vector3& translate);
+
+private:
+
+	// すべての要素を書き込む計算用（ゼロ埋めを省く。Affine3x4 からの変換でも使う）
+	friend class Affine3x4;
+	struct Uninitialized {};
+	explicit Matrix4x4(Uninitialized) {}
 };
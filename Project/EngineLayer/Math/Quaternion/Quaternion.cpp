@@ -1,5 +1,168 @@
 #include "Quaternion.h"
-#include <corecrt_math.h>
+#include <cmath>
+
+#include <cassert>
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#include <emmintrin.h>
+#define QUATERNION_SSE2
+#endif
+
+
+namespace
+{
+	/// -------------------------------------------------------------
+	///		SlerpFast の係数（Eberly "A Fast and Accurate Algorithm for Computing SLERP"）
+	/// -------------------------------------------------------------
+
+	// sin(tθ) / sinθ = t * (1 + b1 * (1 + b2 * (... (1 + b8)))) , bi = (u[i] * t^2 - v[i]) * (cosθ - 1)
+	// u[i] = 1 / (i(2i+1)), v[i] = i / (2i+1)。打ち切った8項目だけ (1 + μ) 倍して最大誤差を 2e-5 程度まで下げる
+	constexpr int kSlerpTermCount = 8;
+	constexpr float kOnePlusMu = 1.85298109240830f;
+	constexpr float kSlerpU[kSlerpTermCount] = {
+		1.0f / (1.0f * 3.0f), 1.0f / (2.0f * 5.0f), 1.0f / (3.0f * 7.0f), 1.0f / (4.0f * 9.0f),
+		1.0f / (5.0f * 11.0f), 1.0f / (6.0f * 13.0f), 1.0f / (7.0f * 15.0f), kOnePlusMu / (8.0f * 17.0f)
+	};
+	constexpr float kSlerpV[kSlerpTermCount] = {
+		1.0f / 3.0f, 2.0f / 5.0f, 3.0f / 7.0f, 4.0f / 9.0f,
+		5.0f / 11.0f, 6.0f / 13.0f, 7.0f / 15.0f, kOnePlusMu * 8.0f / 17.0f
+	};
+
+	// sin(tθ) / sinθ の近似（cosMinusOne = cosθ - 1）
+	float SlerpWeight(float t, float cosMinusOne)
+	{
+		const float t2 = t * t;
+		float sum = 1.0f;
+		for (int i = kSlerpTermCount - 1; i >= 0; --i)
+		{
+			sum = 1.0f + ((kSlerpU[i] * t2 - kSlerpV[i]) * cosMinusOne) * sum;
+		}
+		return t * sum;
+	}
+
+#if defined(QUATERNION_SSE2)
+
+	// 4つ分（x, y, z, w をそれぞれ1本ずつ）
+	struct Lanes
+	{
+		__m128 x, y, z, w;
+	};
+
+	Lanes Load(const QuaternionSoA& q, size_t i)
+	{
+		return { _mm_loadu_ps(&q.x[i]), _mm_loadu_ps(&q.y[i]), _mm_loadu_ps(&q.z[i]), _mm_loadu_ps(&q.w[i]) };
+	}
+
+	void Store(const QuaternionSoA& q, size_t i, const Lanes& v)
+	{
+		_mm_storeu_ps(&q.x[i], v.x);
+		_mm_storeu_ps(&q.y[i], v.y);
+		_mm_storeu_ps(&q.z[i], v.z);
+		_mm_storeu_ps(&q.w[i], v.w);
+	}
+
+	// 1つずつの式と同じ順に足す
+	__m128 Dot(const Lanes& a, const Lanes& b)
+	{
+		__m128 dot = _mm_add_ps(_mm_mul_ps(a.x, b.x), _mm_mul_ps(a.y, b.y));
+		dot = _mm_add_ps(dot, _mm_mul_ps(a.z, b.z));
+		return _mm_add_ps(dot, _mm_mul_ps(a.w, b.w));
+	}
+
+	// 内積が負なら -1、それ以外は 1
+	__m128 SignOf(__m128 dot)
+	{
+		const __m128 negative = _mm_cmplt_ps(dot, _mm_setzero_ps());
+		return _mm_or_ps(_mm_and_ps(negative, _mm_set1_ps(-0.0f)), _mm_set1_ps(1.0f));
+	}
+
+	// a * q0 + b * q1
+	Lanes Combine(__m128 a, const Lanes& q0, __m128 b, const Lanes& q1)
+	{
+		return {
+			_mm_add_ps(_mm_mul_ps(a, q0.x), _mm_mul_ps(b, q1.x)),
+			_mm_add_ps(_mm_mul_ps(a, q0.y), _mm_mul_ps(b, q1.y)),
+			_mm_add_ps(_mm_mul_ps(a, q0.z), _mm_mul_ps(b, q1.z)),
+			_mm_add_ps(_mm_mul_ps(a, q0.w), _mm_mul_ps(b, q1.w))
+		};
+	}
+
+	__m128 SlerpWeight(__m128 t, __m128 cosMinusOne)
+	{
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 t2 = _mm_mul_ps(t, t);
+		__m128 sum = one;
+		for (int i = kSlerpTermCount - 1; i >= 0; --i)
+		{
+			const __m128 b = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(_mm_set1_ps(kSlerpU[i]), t2), _mm_set1_ps(kSlerpV[i])), cosMinusOne);
+			sum = _mm_add_ps(one, _mm_mul_ps(b, sum));
+		}
+		return _mm_mul_ps(t, sum);
+	}
+
+	Lanes SlerpLanes(const Lanes& q0, const Lanes& q1, __m128 t)
+	{
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 dot = Dot(q0, q1);
+		const __m128 sign = SignOf(dot);
+		const __m128 cosMinusOne = _mm_sub_ps(_mm_mul_ps(dot, sign), one);
+		const __m128 a = SlerpWeight(_mm_sub_ps(one, t), cosMinusOne);
+		const __m128 b = _mm_mul_ps(sign, SlerpWeight(t, cosMinusOne));
+		return Combine(a, q0, b, q1);
+	}
+
+	Lanes NlerpLanes(const Lanes& q0, const Lanes& q1, __m128 t)
+	{
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 sign = SignOf(Dot(q0, q1));
+		Lanes result = Combine(_mm_sub_ps(one, t), q0, _mm_mul_ps(sign, t), q1);
+		const __m128 inverseNorm = _mm_div_ps(one, _mm_sqrt_ps(Dot(result, result)));
+		result.x = _mm_mul_ps(result.x, inverseNorm);
+		result.y = _mm_mul_ps(result.y, inverseNorm);
+		result.z = _mm_mul_ps(result.z, inverseNorm);
+		result.w = _mm_mul_ps(result.w, inverseNorm);
+		return result;
+	}
+
+#endif
+
+	/// -------------------------------------------------------------
+	///		一括補間（4つずつ SIMD、余りは1つずつの関数）
+	/// -------------------------------------------------------------
+
+	Quaternion Get(const QuaternionSoA& q, size_t i)
+	{
+		return { q.x[i], q.y[i], q.z[i], q.w[i] };
+	}
+
+	void Set(const QuaternionSoA& q, size_t i, const Quaternion& value)
+	{
+		q.x[i] = value.x;
+		q.y[i] = value.y;
+		q.z[i] = value.z;
+		q.w[i] = value.w;
+	}
+
+	template <typename LaneOperation, typename ScalarOperation>
+	void InterpolateN(const QuaternionSoA& q0, const QuaternionSoA& q1, std::span<const float> t, const QuaternionSoA& out, [[maybe_unused]] LaneOperation&& laneOperation, ScalarOperation&& scalarOperation)
+	{
+		const size_t count = t.size();
+		assert(q0.x.size() >= count && q0.y.size() >= count && q0.z.size() >= count && q0.w.size() >= count);
+		assert(q1.x.size() >= count && q1.y.size() >= count && q1.z.size() >= count && q1.w.size() >= count);
+		assert(out.x.size() >= count && out.y.size() >= count && out.z.size() >= count && out.w.size() >= count);
+		size_t i = 0;
+#if defined(QUATERNION_SSE2)
+		for (; i + 4 <= count; i += 4)
+		{
+			Store(out, i, laneOperation(Load(q0, i), Load(q1, i), _mm_loadu_ps(&t[i])));
+		}
+#endif
+		for (; i < count; ++i)
+		{
+			Set(out, i, scalarOperation(Get(q0, i), Get(q1, i), t[i]));
+		}
+	}
+}
 
 Quaternion Quaternion::Multiply(const Quaternion& lhs, const Quaternion& rhs)
 {
@@ -161,3 +324,71 @@ Quaternion Quaternion::Slerp(const Quaternion& q0, const Quaternion& q1, float t
 
 	return result;
 }
+
+Quaternion Quaternion::SlerpFast(const Quaternion& q0, const Quaternion& q1, float t)
+{
+	// 内積が負なら q1 を反転した側へ（反転は b の符号に含める）
+	const float dot = q0.x * q1.x + q0.y * q1.y + q0.z * q1.z + q0.w * q1.w;
+	const float sign = dot < 0.0f ? -1.0f : 1.0f;
+	const float cosMinusOne = dot * sign - 1.0f;
+
+	// 補間係数（Slerp の a, b と同じもの）
+	const float a = SlerpWeight(1.0f - t, cosMinusOne);
+	const float b = sign * SlerpWeight(t, cosMinusOne);
+
+	Quaternion result{};
+	result.x = a * q0.x + b * q1.x;
+	result.y = a * q0.y + b * q1.y;
+	result.z = a * q0.z + b * q1.z;
+	result.w = a * q0.w + b * q1.w;
+	return result;
+}
+
+Quaternion Quaternion::Nlerp(const Quaternion& q0, const Quaternion& q1, float t)
+{
+	// 内積が負なら q1 を反転して最短経路にする
+	const float dot = q0.x * q1.x + q0.y * q1.y + q0.z * q1.z + q0.w * q1.w;
+	const float a = 1.0f - t;
+	const float b = (dot < 0.0f ? -1.0f : 1.0f) * t;
+
+	Quaternion result{};
+	result.x = a * q0.x + b * q1.x;
+	result.y = a * q0.y + b * q1.y;
+	result.z = a * q0.z + b * q1.z;
+	result.w = a * q0.w + b * q1.w;
+
+	// 正規化（同じ半球どうしなので長さは 0 にならない）
+	const float inverseNorm = 1.0f / sqrtf(result.x * result.x + result.y * result.y + result.z * result.z + result.w * result.w);
+	result.x *= inverseNorm;
+	result.y *= inverseNorm;
+	result.z *= inverseNorm;
+	result.w *= inverseNorm;
+	return result;
+}
+
+void Quaternion::SlerpN(const QuaternionSoA& q0, const QuaternionSoA& q1, std::span<const float> t, const QuaternionSoA& out)
+{
+#if defined(QUATERNION_SSE2)
+	InterpolateN(q0, q1, t, out, SlerpLanes, SlerpFast);
+#else
+	InterpolateN(q0, q1, t, out, nullptr, SlerpFast);
+#endif
+}
+
+void Quaternion::NlerpN(const QuaternionSoA& q0, const QuaternionSoA& q1, std::span<const float> t, const QuaternionSoA& out)
+{
+#if defined(QUATERNION_SSE2)
+	InterpolateN(q0, q1, t, out, NlerpLanes, Nlerp);
+#else
+	InterpolateN(q0, q1, t, out, nullptr, Nlerp);
+#endif
+}
+
+const char* Quaternion::GetBatchBackendName()
+{
+#if defined(QUATERNION_SSE2)
+	return "SSE2";
+#else
+	return "Scalar";
+#endif
+}
@@ -2,6 +2,14 @@
 #include "Vector3.h"
 #include "Matrix4x4.h"
 
+#include <span>
+
+// x, y, z, w を別々の配列で持つクォータニオンの並び（一括補間用。4本とも同じ長さ）
+struct QuaternionSoA
+{
+	std::span<float> x, y, z, w;
+};
+
 class Quaternion
 {
 public:
@@ -37,4 +45,21 @@ public:
 	
 	// 球面線形補間
 	static Quaternion Slerp(const Quaternion& q0, const Quaternion& q1, float t);
+
+	// 球面線形補間の近似（acos / sin の代わりに多項式。Slerp との差は各成分 4e-5 以下）
+	static Quaternion SlerpFast(const Quaternion& q0, const Quaternion& q1, float t);
+
+	// 正規化線形補間（最速だが角速度が一定にならない。キー間の角度が小さいほど Slerp に近い）
+	static Quaternion Nlerp(const Quaternion& q0, const Quaternion& q1, float t);
+
+	// ---------- 配列の一括補間（out は q0 / q1 と同じ配列でもよい。結果は1つずつの関数とビット単位で一致） ---------- //
+
+	// SlerpFast を4つずつ
+	static void SlerpN(const QuaternionSoA& q0, const QuaternionSoA& q1, std::span<const float> t, const QuaternionSoA& out);
+
+	// Nlerp を4つずつ
+	static void NlerpN(const QuaternionSoA& q0, const QuaternionSoA& q1, std::span<const float> t, const QuaternionSoA& out);
+
+	// 一括補間で使っている実装の名前（"SSE2" / "Scalar"）
+	static const char* GetBatchBackendName();
 };
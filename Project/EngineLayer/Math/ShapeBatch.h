@@ -0,0 +1,21 @@
+#pragma once
+#include <cstdint>
+
+// 一括判定の最大レーン数
+constexpr uint32_t kShapeBatchWidth = 8;
+
+// カプセルの一括判定用（SoA。segment.origin が a、segment.diff（終点）が b）
+struct alignas(32) CapsuleBatch
+{
+	float ax[kShapeBatchWidth], ay[kShapeBatchWidth], az[kShapeBatchWidth];
+	float bx[kShapeBatchWidth], by[kShapeBatchWidth], bz[kShapeBatchWidth];
+	float radius[kShapeBatchWidth];
+};
+
+// OBBの一括判定用（SoA。axis[軸][成分][レーン]）
+struct alignas(32) OBBBatch
+{
+	float cx[kShapeBatchWidth], cy[kShapeBatchWidth], cz[kShapeBatchWidth];
+	float axis[3][3][kShapeBatchWidth];
+	float sx[kShapeBatchWidth], sy[kShapeBatchWidth], sz[kShapeBatchWidth];
+};
@@ -1,5 +1,207 @@
 #include "Vector3.h"
 #include "Matrix4x4.h"
+#include "Affine3x4.h"
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#include <emmintrin.h>
+#define VECTOR3_SSE2
+#endif
+
+// 一括変換は Vector3 の配列を float の並びとして読む
+static_assert(sizeof(Vector3) == sizeof(float) * 3);
+
+
+namespace
+{
+	/// -------------------------------------------------------------
+	///		一括変換の係数（1点ずつの式と同じ順に足すための並び）
+	/// -------------------------------------------------------------
+
+	// out[k] = ((x * c[0][k] + y * c[1][k]) + z * c[2][k]) + c[3][k]（c[3] がなければ足さない）
+	struct Coefficients
+	{
+		float c[4][4];
+		bool hasTranslate; // c[3] を足すか
+		bool hasDivide;    // k = 3 の結果（w）で割るか
+	};
+
+	Coefficients MakePointCoefficients(const Matrix4x4& matrix)
+	{
+		Coefficients result{};
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int k = 0; k < 4; ++k) result.c[i][k] = matrix.m[i][k];
+		}
+		result.hasTranslate = true;
+		result.hasDivide = true;
+		return result;
+	}
+
+	Coefficients MakeVectorCoefficients(const Matrix4x4& matrix)
+	{
+		Coefficients result = MakePointCoefficients(matrix);
+		result.hasTranslate = false;
+		result.hasDivide = false;
+		return result;
+	}
+
+	Coefficients MakeAffineCoefficients(const Affine3x4& affine)
+	{
+		Coefficients result{};
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int k = 0; k < 3; ++k) result.c[i][k] = affine.m[k][i];
+		}
+		result.hasTranslate = true;
+		result.hasDivide = false;
+		return result;
+	}
+
+	// 1点分（余りの点とスカラー版）
+	void TransformScalar(const Coefficients& k, float x, float y, float z, float& outX, float& outY, float& outZ)
+	{
+		float result[4];
+		for (int i = 0; i < 4; ++i)
+		{
+			result[i] = x * k.c[0][i] + y * k.c[1][i] + z * k.c[2][i];
+			if (k.hasTranslate) result[i] = result[i] + k.c[3][i];
+		}
+		if (k.hasDivide)
+		{
+			const float w = (result[3] == 0.0f) ? 1.0f : result[3]; // w除算対策
+			result[0] /= w;
+			result[1] /= w;
+			result[2] /= w;
+		}
+		outX = result[0];
+		outY = result[1];
+		outZ = result[2];
+	}
+
+#if defined(VECTOR3_SSE2)
+	/// -------------------------------------------------------------
+	///		SSE2 で4点ずつ（x, y, z をそれぞれ __m128 1本に並べる）
+	/// -------------------------------------------------------------
+
+	template <int x, int y, int z, int w>
+	__m128 Shuffle(__m128 v1, __m128 v2) { return _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(w, z, y, x)); }
+
+	struct Lanes
+	{
+		__m128 x, y, z;
+	};
+
+	// 係数を全レーンに広げたもの
+	struct Broadcast
+	{
+		__m128 c[4][4];
+
+		explicit Broadcast(const Coefficients& k)
+		{
+			for (int i = 0; i < 4; ++i)
+			{
+				for (int j = 0; j < 4; ++j) c[i][j] = _mm_set1_ps(k.c[i][j]);
+			}
+		}
+	};
+
+	template <bool hasTranslate, bool hasDivide>
+	Lanes TransformLanes(const Broadcast& b, const Lanes& v)
+	{
+		__m128 result[4];
+		for (int i = 0; i < (hasDivide ? 4 : 3); ++i)
+		{
+			__m128 sum = _mm_add_ps(_mm_mul_ps(v.x, b.c[0][i]), _mm_mul_ps(v.y, b.c[1][i]));
+			sum = _mm_add_ps(sum, _mm_mul_ps(v.z, b.c[2][i]));
+			if constexpr (hasTranslate) sum = _mm_add_ps(sum, b.c[3][i]);
+			result[i] = sum;
+		}
+
+		if constexpr (hasDivide)
+		{
+			// w が 0 のレーンは 1 にする
+			const __m128 one = _mm_set1_ps(1.0f);
+			const __m128 zero = _mm_cmpeq_ps(result[3], _mm_setzero_ps());
+			const __m128 w = _mm_or_ps(_mm_and_ps(zero, one), _mm_andnot_ps(zero, result[3]));
+			return { _mm_div_ps(result[0], w), _mm_div_ps(result[1], w), _mm_div_ps(result[2], w) };
+		}
+		else
+		{
+			return { result[0], result[1], result[2] };
+		}
+	}
+
+	// x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3 → x0..x3 / y0..y3 / z0..z3
+	Lanes LoadAoS(const Vector3* points)
+	{
+		const float* p = &points->x;
+		const __m128 a = _mm_loadu_ps(p);
+		const __m128 b = _mm_loadu_ps(p + 4);
+		const __m128 c = _mm_loadu_ps(p + 8);
+
+		const __m128 x = Shuffle<0, 3, 0, 2>(a, Shuffle<2, 2, 1, 1>(b, c));
+		const __m128 y = Shuffle<0, 2, 0, 2>(Shuffle<1, 1, 0, 0>(a, b), Shuffle<3, 3, 2, 2>(b, c));
+		const __m128 z = Shuffle<0, 2, 0, 3>(Shuffle<2, 2, 1, 1>(a, b), c);
+		return { x, y, z };
+	}
+
+	// LoadAoS の逆
+	void StoreAoS(Vector3* points, const Lanes& v)
+	{
+		float* p = &points->x;
+		_mm_storeu_ps(p, Shuffle<0, 2, 0, 2>(Shuffle<0, 0, 0, 0>(v.x, v.y), Shuffle<0, 0, 1, 1>(v.z, v.x)));
+		_mm_storeu_ps(p + 4, Shuffle<0, 2, 0, 2>(Shuffle<1, 1, 1, 1>(v.y, v.z), Shuffle<2, 2, 2, 2>(v.x, v.y)));
+		_mm_storeu_ps(p + 8, Shuffle<0, 2, 0, 2>(Shuffle<2, 2, 3, 3>(v.z, v.x), Shuffle<3, 3, 3, 3>(v.y, v.z)));
+	}
+#endif
+
+	/// -------------------------------------------------------------
+	///		並び（AoS / SoA）ごとの一括変換
+	/// -------------------------------------------------------------
+
+	template <bool hasTranslate, bool hasDivide>
+	void TransformAoS(const Coefficients& k, std::span<const Vector3> points, std::span<Vector3> out)
+	{
+		assert(out.size() >= points.size());
+		size_t i = 0;
+#if defined(VECTOR3_SSE2)
+		const Broadcast b(k);
+		for (; i + 4 <= points.size(); i += 4)
+		{
+			StoreAoS(&out[i], TransformLanes<hasTranslate, hasDivide>(b, LoadAoS(&points[i])));
+		}
+#endif
+		for (; i < points.size(); ++i)
+		{
+			const Vector3 p = points[i];
+			TransformScalar(k, p.x, p.y, p.z, out[i].x, out[i].y, out[i].z);
+		}
+	}
+
+	template <bool hasTranslate, bool hasDivide>
+	void TransformSoA(const Coefficients& k, std::span<const float> x, std::span<const float> y, std::span<const float> z, std::span<float> outX, std::span<float> outY, std::span<float> outZ)
+	{
+		const size_t count = x.size();
+		assert(y.size() == count && z.size() == count);
+		assert(outX.size() >= count && outY.size() >= count && outZ.size() >= count);
+		size_t i = 0;
+#if defined(VECTOR3_SSE2)
+		const Broadcast b(k);
+		for (; i + 4 <= count; i += 4)
+		{
+			const Lanes v = TransformLanes<hasTranslate, hasDivide>(b, { _mm_loadu_ps(&x[i]), _mm_loadu_ps(&y[i]), _mm_loadu_ps(&z[i]) });
+			_mm_storeu_ps(&outX[i], v.x);
+			_mm_storeu_ps(&outY[i], v.y);
+			_mm_storeu_ps(&outZ[i], v.z);
+		}
+#endif
+		for (; i < count; ++i)
+		{
+			TransformScalar(k, x[i], y[i], z[i], outX[i], outY[i], outZ[i]);
+		}
+	}
+}
+
 
 Vector3 Vector3::Add(const Vector3& v1, const Vector3& v2)
 {
@@ -65,6 +267,45 @@ Vector3 Vector3::Transform(const Vector3& vector, const Matrix4x4& matrix)
 	return result;
 }
 
+void Vector3::TransformPoints(std::span<const Vector3> points, const Matrix4x4& matrix, std::span<Vector3> out)
+{
+	TransformAoS<true, true>(MakePointCoefficients(matrix), points, out);
+}
+
+void Vector3::TransformVectors(std::span<const Vector3> vectors, const Matrix4x4& matrix, std::span<Vector3> out)
+{
+	TransformAoS<false, false>(MakeVectorCoefficients(matrix), vectors, out);
+}
+
+void Vector3::TransformPointsAffine(std::span<const Vector3> points, const Affine3x4& affine, std::span<Vector3> out)
+{
+	TransformAoS<true, false>(MakeAffineCoefficients(affine), points, out);
+}
+
+void Vector3::TransformPoints(std::span<const float> x, std::span<const float> y, std::span<const float> z, const Matrix4x4& matrix, std::span<float> outX, std::span<float> outY, std::span<float> outZ)
+{
+	TransformSoA<true, true>(MakePointCoefficients(matrix), x, y, z, outX, outY, outZ);
+}
+
+void Vector3::TransformVectors(std::span<const float> x, std::span<const float> y, std::span<const float> z, const Matrix4x4& matrix, std::span<float> outX, std::span<float> outY, std::span<float> outZ)
+{
+	TransformSoA<false, false>(MakeVectorCoefficients(matrix), x, y, z, outX, outY, outZ);
+}
+
+void Vector3::TransformPointsAffine(std::span<const float> x, std::span<const float> y, std::span<const float> z, const Affine3x4& affine, std::span<float> outX, std::span<float> outY, std::span<float> outZ)
+{
+	TransformSoA<true, false>(MakeAffineCoefficients(affine), x, y, z, outX, outY, outZ);
+}
+
+const char* Vector3::GetBatchBackendName()
+{
+#if defined(VECTOR3_SSE2)
+	return "SSE2";
+#else
+	return "Scalar";
+#endif
+}
+
 Vector3 Vector3::Cross(const Vector3& v1, const Vector3& v2)
 {
 	Vector3 result{};
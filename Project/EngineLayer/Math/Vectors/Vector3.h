@@ -3,8 +3,10 @@
 #include <cassert>
 #include <cmath>
 #include <numbers>
+#include <span>
 
 class Matrix4x4;
+class Affine3x4;
 
 /// <summary>
 /// 3次元ベクトル
@@ -42,6 +44,25 @@ public:
 	//座標変換
 	static Vector3 Transform(const Vector3& vector, const Matrix4x4& matrix);
 
+	// ---------- 配列の一括変換（out は入力と同じ配列でもよい。結果は1点ずつの変換とビット単位で一致） ---------- //
+
+	// 点（Transform と同じく w で割る）
+	static void TransformPoints(std::span<const Vector3> points, const Matrix4x4& matrix, std::span<Vector3> out);
+
+	// 方向（平行移動も w 除算もしない）
+	static void TransformVectors(std::span<const Vector3> vectors, const Matrix4x4& matrix, std::span<Vector3> out);
+
+	// アフィン変換の点（w 除算を省く。Affine3x4::TransformPoint と同じ）
+	static void TransformPointsAffine(std::span<const Vector3> points, const Affine3x4& affine, std::span<Vector3> out);
+
+	// SoA 版（x, y, z を別々の配列で持つ）
+	static void TransformPoints(std::span<const float> x, std::span<const float> y, std::span<const float> z, const Matrix4x4& matrix, std::span<float> outX, std::span<float> outY, std::span<float> outZ);
+	static void TransformVectors(std::span<const float> x, std::span<const float> y, std::span<const float> z, const Matrix4x4& matrix, std::span<float> outX, std::span<float> outY, std::span<float> outZ);
+	static void TransformPointsAffine(std::span<const float> x, std::span<const float> y, std::span<const float> z, const Affine3x4& affine, std::span<float> outX, std::span<float> outY, std::span<float> outZ);
+
+	// 一括変換で使っている実装の名前（"SSE2" / "Scalar"）
+	static const char* GetBatchBackendName();
+
 	//クロス積
 	static Vector3 Cross(const Vector3& v1, const Vector3& v2);
 
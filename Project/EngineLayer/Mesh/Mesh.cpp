@@ -51,7 +51,7 @@ void Mesh::Initialize(const std::vector<VertexData>& modelVertices, const std::v
 /// -------------------------------------------------------------
 ///				　			描画処理
 /// -------------------------------------------------------------
-void Mesh::Draw()
+void Mesh::Draw() const
 {
 	ID3D12GraphicsCommandList* commandList = DirectXCommon::GetInstance()->GetCommandManager()->GetCommandList();
 
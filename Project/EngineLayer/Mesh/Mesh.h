@@ -17,7 +17,7 @@ public: /// ---------- メンバ関数 ---------- ///
 	void Initialize(const std::vector<VertexData>& modelVertices, const std::vector<uint32_t>& modelIndices);
 
 	// 描画処理
-	void Draw();
+	void Draw() const;
 
 public: /// ---------- ゲッタ ---------- ///
 
@@ -1,34 +1,22 @@
 #include "ParticleTransform.h"
 #include <DirectXCommon.h>
 
-void ParticleTransform::UpdateMatrix(const Matrix4x4& viewProjection, bool useBillboard, const Matrix4x4& billboardMatrix)
+void ParticleTransform::UpdateMatrix(const Matrix4x4& viewProjection, bool useBillboard, const Affine3x4& billboardMatrix)
 {
 	// 行列構築
     if (useBillboard)
     {
-        // Z軸回転のみ行列を作成
-        Matrix4x4 rotZMat = Matrix4x4::MakeRotateZMatrix(rotate_.z);
+        // スケールとZ軸回転をビルボードの基底に乗せる（ローカル回転として合成）
+        worldMatrix_ = Affine3x4::Multiply(Affine3x4::MakeAffine(scale_, Vector3{ 0.0f, 0.0f, rotate_.z }, Vector3{}), billboardMatrix);
 
-        // スケール
-        Matrix4x4 scaleMat = Matrix4x4::MakeScaleMatrix(scale_);
-
-        // 平面に向けたビルボードの基底を作成
-        Matrix4x4 facingMat = billboardMatrix;
-
-        // Z回転は facingMat の上に乗せる（ローカル回転として合成）
-        Matrix4x4 combinedRot = Matrix4x4::Multiply(rotZMat, facingMat); // ←ここが重要
-
-        // 平行移動
-        Matrix4x4 transMat = Matrix4x4::MakeTranslateMatrix(translate_);
-
-        // 合成：scale → rotation → translation
-        worldMatrix_ = Matrix4x4::Multiply(Matrix4x4::Multiply(scaleMat, combinedRot), transMat);
+        // 平行移動（ビルボード行列の平行移動は消してあるので置くだけ）
+        worldMatrix_.SetTranslation(translate_);
     }
 	else
 	{
-		worldMatrix_ = Matrix4x4::MakeAffineMatrix(scale_, rotate_, translate_);
+		worldMatrix_ = Affine3x4::MakeAffine(scale_, rotate_, translate_);
 	}
 
 	// WVP更新
-	wvpMatrix_ = Matrix4x4::Multiply(worldMatrix_, viewProjection);
+	wvpMatrix_ = Affine3x4::Multiply(worldMatrix_, viewProjection);
 }
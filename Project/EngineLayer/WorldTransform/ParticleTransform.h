@@ -2,6 +2,7 @@
 #include <DX12Include.h>
 #include "Vector3.h"
 #include "Matrix4x4.h"
+#include "Affine3x4.h"
 #include "Camera.h"
 
 
@@ -19,17 +20,17 @@ public: /// ---------- メンバ変数 ---------- ///
 public: /// ---------- メンバ関数 ---------- ///
 
 	// 更新処理
-	void UpdateMatrix(const Matrix4x4& viewProjection, bool useBillboard, const Matrix4x4& billboardMatrix);
+	void UpdateMatrix(const Matrix4x4& viewProjection, bool useBillboard, const Affine3x4& billboardMatrix);
 
-	/// @brief ワールド行列の取得
-	const Matrix4x4& GetWorldMatrix() const { return worldMatrix_; }
+	/// @brief ワールド行列の取得（GPU に送るときは ToMatrix）
+	const Affine3x4& GetWorldMatrix() const { return worldMatrix_; }
 
 	/// @brief WVP行列の取得
 	const Matrix4x4& GetWVPMatrix() const { return wvpMatrix_; }
 
 private: /// ---------- メンバ変数 ---------- ///
 
-	Matrix4x4 worldMatrix_ = Matrix4x4::MakeIdentity();
+	Affine3x4 worldMatrix_ = Affine3x4::MakeIdentity();
 	Matrix4x4 wvpMatrix_ = Matrix4x4::MakeIdentity();
 
 };
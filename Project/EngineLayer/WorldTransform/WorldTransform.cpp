@@ -24,30 +24,31 @@ void WorldTransform::Initialize()
 void WorldTransform::Update()
 {
     // ローカル変換行列を作成
-    Matrix4x4 worldMatrix = Matrix4x4::MakeAffineMatrix(scale_, rotate_, translate_);
+    Affine3x4 worldAffine = Affine3x4::MakeAffine(scale_, rotate_, translate_);
 
     // 親オブジェクトがあれば親のワールド行列を掛ける
     if (parent_)
     {
-        worldMatrix = Matrix4x4::Multiply(worldMatrix, parent_->matWorld_);
+        worldAffine = Affine3x4::Multiply(worldAffine, parent_->matWorld_);
     }
+    const Matrix4x4 worldMatrix = worldAffine.ToMatrix();
 
     // 親の回転を引き継ぐ
     worldRotate_ = parent_ ? parent_->worldRotate_ + rotate_ : rotate_;
 
     // ワールド座標を取得
-    worldTranslate_ = { worldMatrix.m[3][0], worldMatrix.m[3][1], worldMatrix.m[3][2] };
+    worldTranslate_ = worldAffine.GetTranslation();
 
     // ビュー・プロジェクション変換
     Matrix4x4 worldViewProjectionMatrix = camera_
-        ? Matrix4x4::Multiply(worldMatrix, camera_->GetViewProjectionMatrix())
+        ? Affine3x4::Multiply(worldAffine, camera_->GetViewProjectionMatrix())
         : worldMatrix;
 
     // ワールド行列を保存
-    matWorld_ = worldMatrix;
+    matWorld_ = worldAffine;
     wvpData->WVP = worldViewProjectionMatrix;
     wvpData->World = worldMatrix;
-    wvpData->WorldInversedTranspose = Matrix4x4::Transpose(Matrix4x4::Inverse(worldMatrix));
+    wvpData->WorldInversedTranspose = Matrix4x4::InverseTransposeUpper3x3(worldMatrix);
 }
 
 void WorldTransform::SetPipeline(UINT rootParameterIndex)
@@ -2,6 +2,7 @@
 #include <DX12Include.h>
 #include "Vector3.h"
 #include "Matrix4x4.h"
+#include "Affine3x4.h"
 
 /// ---------- 前方宣言 ---------- ///
 class Camera;
@@ -33,8 +34,8 @@ public: /// ---------- メンバ変数 ---------- ///
 	Vector3 worldTranslate_ = { 0.0f, 0.0f, 0.0f };
 	// ワールド回転
 	Vector3 worldRotate_ = { 0.0f, 0.0f, 0.0f };
-	// ワールド変換行列
-	Matrix4x4 matWorld_;
+	// ワールド変換行列（親子の合成は 3x4 で行う）
+	Affine3x4 matWorld_;
 	// 親となるワールド変換ポインタ
 	const WorldTransform* parent_ = nullptr;
 
@@ -50,7 +51,7 @@ public: /// ---------- メンバ関数 ---------- ///
 	void SetPipeline(UINT rootParameterIndex = 1);
 
 	// ワールド変換行列を取得
-	const Matrix4x4& GetWorldMatrix() const { return matWorld_; }
+	const Affine3x4& GetWorldMatrix() const { return matWorld_; }
 
 private: /// ---------- メンバ変数 ---------- ///
 
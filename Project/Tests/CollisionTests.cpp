@@ -0,0 +1,52 @@
+#include "CollisionBenchmark.h"
+#include "AssetCacheBenchmark.h"
+#include "MathBenchmark.h"
+#include "CharacterController.h"
+#include "JobSystem.h"
+
+#include <algorithm>
+#include <cstdio>
+
+/// -------------------------------------------------------------
+///	　衝突判定・数学・アセットキャッシュのテストと計測（ウィンドウなしで実行する）
+/// -------------------------------------------------------------
+int main()
+{
+	JobSystem::GetInstance()->Initialize();
+
+	// 性質テスト・形状の組ごとの ns/回・ワールド全体のシナリオ（結果は Log で標準出力へ）
+	CollisionBenchmark benchmark;
+	benchmark.Run();
+
+	// ブロードフェーズを変えても応答処理に届く組は総当たりと同じでなければならない
+	// （スレッド数を変えても同じ。入れ物を変えても残る要素は同じ。敵弾の掃引は経路が的を通る弾を取りこぼさない）
+	const auto& scenes = benchmark.GetSceneResults();
+	const auto& sweeps = benchmark.GetThreadSweepResults();
+	const auto& containers = benchmark.GetContainerResults();
+	const auto& projectiles = benchmark.GetProjectileResults();
+	const auto mismatchCount =
+		std::count_if(scenes.begin(), scenes.end(), [](const CollisionBenchmark::SceneResult& scene) { return !scene.matchesBruteForce; }) +
+		std::count_if(sweeps.begin(), sweeps.end(), [](const CollisionBenchmark::ThreadSweepResult& sweep) { return !sweep.matchesBruteForce; }) +
+		std::count_if(containers.begin(), containers.end(), [](const CollisionBenchmark::ContainerResult& container) { return !container.matches; }) +
+		std::count_if(projectiles.begin(), projectiles.end(), [](const CollisionBenchmark::ProjectileResult& projectile) { return !projectile.matchesPath; });
+
+	// モデルキャッシュのキーの正規化・ヒット数とミス数・アセットの共有（デバイスなしで回せる部分）
+	AssetCacheBenchmark assetCacheBenchmark;
+	assetCacheBenchmark.Run();
+
+	// 行列・Affine3x4・クォータニオンの SIMD 版や近似とスカラー版の許容誤差（ビット一致・並びの対応・誤差上限）
+	MathBenchmark mathBenchmark;
+	mathBenchmark.Run();
+
+	// キャラクター移動（1000体 × 1000箱。全箱と総当たりで残っためり込みと、直列と並列の差を調べる）
+	const CharacterController::BenchmarkResult character = CharacterController::RunBenchmark(1000, 1000);
+
+	JobSystem::GetInstance()->Finalize();
+
+	const uint32_t failureCount = benchmark.GetTotalFailureCount() + assetCacheBenchmark.GetTotalFailureCount() + mathBenchmark.GetTotalFailureCount();
+
+	// めり込みは 1mm まで（押し出し後は skinWidth だけ離れているはず）、並列でも1体ずつ独立なので直列と同じ位置
+	const bool isCharacterOk = character.maxPenetration <= 1.0e-3f && character.maxParallelError == 0.0f;
+	std::printf("property failures %u, scene mismatches %d, character %s\n", failureCount, static_cast<int>(mismatchCount), isCharacterOk ? "OK" : "NG");
+	return (failureCount == 0 && mismatchCount == 0 && isCharacterOk) ? 0 : 1;
+}
@@ -0,0 +1,16 @@
+#pragma once
+#include <cstdio>
+#include <string>
+#include <version>
+
+// ヘッドレスのテスト用（エンジンの LogString.h は Windows.h に依存するので差し替える）
+// <format> のない標準ライブラリでは {fmt} で同じ書式を使う
+#ifdef __cpp_lib_format
+#include <format>
+#else
+#include <fmt/format.h>
+namespace std { using fmt::format; }
+#endif
+
+// ログ出力（標準出力へ）
+inline void Log(const std::string& message) { std::fputs(message.c_str(), stdout); }
@@ -0,0 +1,23 @@
+#pragma once
+#include "Vector3.h"
+#include "Vector4.h"
+#include "OBB.h"
+#include "Segment.h"
+#include "Capsule.h"
+
+/// -------------------------------------------------------------
+///		ヘッドレスのテスト用の線描画（何も描かない）
+/// -------------------------------------------------------------
+class Wireframe
+{
+public: /// ---------- メンバ関数 ---------- ///
+
+	// シングルトンインスタンス
+	static Wireframe* GetInstance() { static Wireframe instance; return &instance; }
+
+	void DrawSegment(const Segment&, const Vector4&) {}
+	void DrawOBB(const OBB&, const Vector4&) {}
+	void DrawSphere(const Vector3&, const float, const Vector4&) {}
+	void DrawCapsule(const Vector3&, float, float, const Vector3&, int, const Vector4&) {}
+	void DrawCapsule(const Capsule&, const Vector4&) {}
+};